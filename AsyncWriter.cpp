@@ -0,0 +1,361 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: AsyncWriter.cpp
+Purpose: Provides the implementation of an async writer.
+*/
+
+#include "AsyncWriter.h"
+#include "MemoryProfile.h"		//Counting spilled solution copies
+#include "PathWriter.h"			//Solution file format
+#include <chrono>				//Idle sleep
+#include <cstring>				//memcpy
+#include <algorithm>			//min
+
+using namespace std;
+
+//int constants
+const int IDLE_SPINS = 256;				//Empty checks before the writer yields the processor
+const int IDLE_YIELDS = 1024;			//Empty checks before the writer sleeps
+const int IDLE_SLEEP_US = 100;			//Writer sleep while the ring stays empty
+const int FULL_SPINS = 64;				//Full checks before the search yields the processor
+
+
+//pre: outdat is a valid output stream, ringSize is greater than zero
+//post: A writer has been created and its thread started
+AsyncWriter::AsyncWriter(	/*inout*/ostream &inOutdat,			//stream to write solutions to
+							/*in*/int ringSize,					//number of records the ring holds
+							/*in*/Backpressure inBackpressure)	//what to do when the ring is full
+	: outdat(inOutdat), ring(ringSize)
+{
+	size_t address;
+
+	backpressure = inBackpressure;
+	stalls = 0;
+	spilled = 0;
+	finished.store(false);
+	bytesWritten.store(0);
+	index.store(nullptr);
+	flushRequested.store(0);
+	flushCompleted.store(0);
+
+	//Carve an aligned block out of the backing storage
+	storage.resize(WRITE_BLOCK_SIZE + WRITE_ALIGNMENT);
+	address = size_t(&storage[0]);
+	block = &storage[0] + (WRITE_ALIGNMENT - address % WRITE_ALIGNMENT) % WRITE_ALIGNMENT;
+
+	writer = thread(&AsyncWriter::WriterLoop, this);
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: AsyncWriter has been initialized
+//post: every submitted solution has been written and the writer thread stopped
+AsyncWriter::~AsyncWriter()
+{
+	Finish();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the search thread before the first Submit. The stream was empty when
+//		the writer was created
+//post: the offset of every record written is added to index, on the writer thread
+void AsyncWriter::SetIndex(/*inout*/SolutionIndexWriter *inIndex)	//index to add records to
+{
+	index.store(inIndex, memory_order_release);
+
+}//end SetIndex
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the search thread before the first Submit, starts and ends hold as many lines,
+//		each of the ends ending with END_PATH
+//post: a solution submitted with label l is written between starts[l] and ends[l]
+void AsyncWriter::SetLabels(	/*in*/const vector<string> &starts,	//entry line of each label
+								/*in*/const vector<string> &ends)	//exit line of each label
+{
+	//The writer thread only reads them for a record pushed after this
+	startLabels = starts;
+	endLabels = ends;
+
+}//end SetLabels
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the search thread, Finish has not been called,
+//		moves holds numMoves movements from the entry point
+//post: the solution will be written after every solution submitted before it
+void AsyncWriter::Submit(	/*in*/const Direction moves[],		//movements taken from the entry point
+							/*in*/int numMoves,					//number of movements in moves
+							/*in*/int solutionNum)				//solution number
+{
+	Submit(moves, numMoves, solutionNum, NO_LABEL);
+
+}//end Submit
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the search thread, Finish has not been called, moves holds numMoves
+//		movements from the entry point, label is NO_LABEL or one given to SetLabels
+//post: the solution will be written after every solution submitted before it, between the
+//		entry and exit lines of label
+void AsyncWriter::Submit(	/*in*/const Direction moves[],		//movements taken from the entry point
+							/*in*/int numMoves,					//number of movements in moves
+							/*in*/int solutionNum,				//solution number
+							/*in*/int label)					//entry and exit lines of the solution
+{
+	//Records already spilled must reach the ring first to keep the order
+	if (!spill.empty())
+		DrainSpill();
+
+	if (spill.empty() && ring.TryPush(moves, numMoves, solutionNum, label))
+		return;
+
+	if (backpressure == BACKPRESSURE_SPILL)
+	{
+		spill.push_back(SolutionRecord());
+		spill.back().number = solutionNum;
+		spill.back().label = label;
+		spill.back().moves.assign(moves, moves + numMoves);
+		CountAllocation(HOOK_SOLUTION_COPY, spill.back().moves.capacity() * sizeof(Direction));
+		spilled++;
+		return;
+
+	}//end spill
+
+	//Wait for the writer to free a slot
+	stalls++;
+	for (int spins = 0; !ring.TryPush(moves, numMoves, solutionNum, label); spins++)
+	{
+		if (spins >= FULL_SPINS)
+			this_thread::yield();
+
+	}//end for
+
+}//end Submit
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the search thread, Finish has not been called
+//post: every submitted solution has been written to the stream and the stream flushed.
+//		This is the only call that makes the search wait on the stream
+void AsyncWriter::Flush()
+{
+	int request;
+
+	while (!spill.empty())
+	{
+		DrainSpill();
+		if (!spill.empty())
+			this_thread::yield();
+
+	}//end while
+
+	request = flushRequested.load(memory_order_relaxed) + 1;
+	flushRequested.store(request, memory_order_release);
+
+	while (flushCompleted.load(memory_order_acquire) != request)
+		this_thread::yield();
+
+}//end Flush
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the search thread
+//post: every submitted solution has been written to the stream and the writer thread stopped
+void AsyncWriter::Finish()
+{
+	if (!writer.joinable())
+		return;
+
+	while (!spill.empty())
+	{
+		DrainSpill();
+		if (!spill.empty())
+			this_thread::yield();
+
+	}//end while
+
+	finished.store(true, memory_order_release);
+	writer.join();
+	outdat.flush();
+
+}//end Finish
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of bytes written to the stream so far
+/*out*/long long AsyncWriter::GetBytesWritten() const	//bytes written
+{
+	return bytesWritten.load();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of times the search waited for a full ring
+/*out*/long long AsyncWriter::GetStalls() const			//number of waits
+{
+	return stalls;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of records kept on the search side because the ring was full
+/*out*/long long AsyncWriter::GetSpilled() const		//number of spilled records
+{
+	return spilled;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the search thread
+//post: spilled records have been moved into the ring while it had room
+void AsyncWriter::DrainSpill()
+{
+	while (!spill.empty())
+	{
+		SolutionRecord &oldest = spill.front();
+
+		if (!ring.TryPush(oldest.moves.empty() ? nullptr : &oldest.moves[0],
+						int(oldest.moves.size()), oldest.number, oldest.label))
+			break;
+
+		spill.pop_front();
+
+	}//end while
+
+}//end DrainSpill
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the writer thread
+//post: records have been written until the search finished and the ring emptied
+void AsyncWriter::WriterLoop()
+{
+	size_t used = 0;		//bytes of the block in use
+	int idle = 0;			//consecutive checks that found the ring empty
+
+	while (true)
+	{
+		SolutionRecord *next = ring.Front();
+
+		if (next == nullptr)
+		{
+			//Every record is visible once the search has said it is finished
+			if (finished.load(memory_order_acquire) && ring.IsEmpty())
+				break;
+
+			//Every record submitted before a flush request is visible once the request is
+			int request = flushRequested.load(memory_order_acquire);
+			if (request != flushCompleted.load(memory_order_relaxed))
+			{
+				if (!ring.IsEmpty())
+					continue;
+
+				if (used > 0)
+					WriteBlock(used);
+				used = 0;
+				outdat.flush();
+				flushCompleted.store(request, memory_order_release);
+				continue;
+
+			}//end flush
+
+			idle++;
+			if (idle == IDLE_YIELDS && used > 0)
+			{
+				//The search has gone quiet, don't sit on what it found
+				WriteBlock(used);
+				used = 0;
+			}
+
+			if (idle >= IDLE_YIELDS)
+				this_thread::sleep_for(chrono::microseconds(IDLE_SLEEP_US));
+			else if (idle >= IDLE_SPINS)
+				this_thread::yield();
+
+			continue;
+
+		}//end empty ring
+
+		idle = 0;
+		record.clear();
+		if (next->label == NO_LABEL)
+			AppendMoves(record, next->moves.empty() ? nullptr : &next->moves[0],
+						int(next->moves.size()), next->number);
+		else
+			AppendMoves(record, next->moves.empty() ? nullptr : &next->moves[0],
+						int(next->moves.size()), next->number, startLabels[next->label], endLabels[next->label]);
+
+		//The record starts after everything written and everything waiting in the block
+		SolutionIndexWriter *recordIndex = index.load(memory_order_acquire);
+		if (recordIndex != nullptr)
+			recordIndex->Add(next->number, bytesWritten.load(memory_order_relaxed) + (long long)used);
+
+		ring.Pop();
+
+		//Copy the record into the block, writing each block as it fills
+		for (size_t pos = 0; pos < record.size(); )
+		{
+			size_t count = min(record.size() - pos, size_t(WRITE_BLOCK_SIZE) - used);
+
+			memcpy(block + used, record.data() + pos, count);
+			used += count;
+			pos += count;
+
+			if (used == size_t(WRITE_BLOCK_SIZE))
+			{
+				WriteBlock(used);
+				used = 0;
+			}
+
+		}//end for
+
+	}//end while
+
+	if (used > 0)
+		WriteBlock(used);
+
+}//end WriterLoop
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the writer thread, length bytes of the block are in use
+//post: the first length bytes of the block have been written to the stream
+void AsyncWriter::WriteBlock(/*in*/size_t length)		//bytes of the block to write
+{
+	outdat.write(block, length);
+	bytesWritten.fetch_add((long long)length);
+
+}//end WriteBlock
@@ -0,0 +1,208 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: AsyncWriter.h
+Purpose: Provides the specification for an AsyncWriter. An async writer separates the search from the
+			disk. The search hands each solution to a bounded SolutionRing and carries on; a dedicated
+			writer thread formats the records into a large block-aligned buffer and writes it out a
+			whole block at a time. What the search does when the ring is full is configurable.
+			Given an index, the writer thread also notes where each record starts as it formats it.
+			Given labels, a solution can be written between entry and exit lines of its own.
+*/
+
+#ifndef ASYNCWRITER_H
+#define ASYNCWRITER_H
+
+#include "Direction.h"			//Direction enum
+#include "SolutionRing.h"		//Queue between the search and the writer
+#include "SolutionIndex.h"		//Offsets of the records
+#include <atomic>				//Finished flag
+#include <deque>				//Spilled records
+#include <ostream>				//Output stream
+#include <string>				//Block buffer
+#include <thread>				//Writer thread
+#include <vector>				//Labels
+
+using namespace std;
+
+//What the search does when the ring is full
+enum Backpressure
+{
+	BACKPRESSURE_BLOCK,			//wait for the writer to free a slot
+	BACKPRESSURE_SPILL			//keep the record in memory on the search side and carry on
+};
+
+//int constants
+const int DEFAULT_RING_SIZE = 4096;				//Default number of records in the ring
+const int WRITE_BLOCK_SIZE = 1 << 20;			//Bytes written to the stream at a time
+const int WRITE_ALIGNMENT = 4096;				//Alignment of the block buffer
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+AsyncWriter(ostream &outdat, int ringSize, Backpressure backpressure);
+	Creates a new AsyncWriter writing to outdat and starts its writer thread
+
+~AsyncWriter();
+	Finishes writing if Finish has not been called
+
+void SetIndex(SolutionIndexWriter *index);
+	Notes the offset of every record written from now on in index
+
+void SetLabels(const vector<string> &starts, const vector<string> &ends);
+	Gives the entry and exit lines of each label solutions may be submitted with
+
+void Submit(const Direction moves[], int numMoves, int solutionNum);
+	Hands a solution to the writer. Never waits on the output stream
+
+void Submit(const Direction moves[], int numMoves, int solutionNum, int label);
+	Hands a solution to the writer, to be written between the lines of label
+
+void Flush();
+	Waits until every submitted solution has been written to the stream
+
+void Finish();
+	Writes every submitted solution and stops the writer thread
+
+long long GetBytesWritten() const;
+	Returns the number of bytes written to the stream so far
+
+long long GetStalls() const;
+	Returns the number of times the search waited for a full ring
+
+long long GetSpilled() const;
+	Returns the number of records kept on the search side because the ring was full
+*/
+
+class AsyncWriter
+{
+
+	public:
+
+		//pre: outdat is a valid output stream, ringSize is greater than zero
+		//post: A writer has been created and its thread started
+		AsyncWriter(	/*inout*/ostream &outdat,			//stream to write solutions to
+						/*in*/int ringSize,					//number of records the ring holds
+						/*in*/Backpressure backpressure);	//what to do when the ring is full
+
+		/***************************************************************************************************/
+
+		//pre: AsyncWriter has been initialized
+		//post: every submitted solution has been written and the writer thread stopped
+		~AsyncWriter();
+
+		/***************************************************************************************************/
+
+		//pre: called from the search thread before the first Submit. The stream was empty when
+		//		the writer was created
+		//post: the offset of every record written is added to index, on the writer thread
+		void SetIndex(/*inout*/SolutionIndexWriter *index);	//index to add records to
+
+		/***************************************************************************************************/
+
+		//pre: called from the search thread before the first Submit, starts and ends hold as many lines,
+		//		each of the ends ending with END_PATH
+		//post: a solution submitted with label l is written between starts[l] and ends[l]
+		void SetLabels(	/*in*/const vector<string> &starts,	//entry line of each label
+						/*in*/const vector<string> &ends);	//exit line of each label
+
+		/***************************************************************************************************/
+
+		//pre: called from the search thread, Finish has not been called,
+		//		moves holds numMoves movements from the entry point
+		//post: the solution will be written after every solution submitted before it
+		void Submit(	/*in*/const Direction moves[],		//movements taken from the entry point
+						/*in*/int numMoves,					//number of movements in moves
+						/*in*/int solutionNum);				//solution number
+
+		/***************************************************************************************************/
+
+		//pre: called from the search thread, Finish has not been called, moves holds numMoves
+		//		movements from the entry point, label is NO_LABEL or one given to SetLabels
+		//post: the solution will be written after every solution submitted before it, between the
+		//		entry and exit lines of label
+		void Submit(	/*in*/const Direction moves[],		//movements taken from the entry point
+						/*in*/int numMoves,					//number of movements in moves
+						/*in*/int solutionNum,				//solution number
+						/*in*/int label);					//entry and exit lines of the solution
+
+		/***************************************************************************************************/
+
+		//pre: called from the search thread, Finish has not been called
+		//post: every submitted solution has been written to the stream and the stream flushed.
+		//		This is the only call that makes the search wait on the stream
+		void Flush();
+
+		/***************************************************************************************************/
+
+		//pre: called from the search thread
+		//post: every submitted solution has been written to the stream and the writer thread stopped
+		void Finish();
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of bytes written to the stream so far
+		/*out*/long long GetBytesWritten() const;	//bytes written
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of times the search waited for a full ring
+		/*out*/long long GetStalls() const;			//number of waits
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of records kept on the search side because the ring was full
+		/*out*/long long GetSpilled() const;		//number of spilled records
+
+		/***************************************************************************************************/
+
+	private:
+
+		AsyncWriter(const AsyncWriter &orig);		//not copyable
+		void operator=(const AsyncWriter &orig);	//not assignable
+
+		//pre: called from the search thread
+		//post: spilled records have been moved into the ring while it had room
+		void DrainSpill();
+
+		/***************************************************************************************************/
+
+		//pre: called from the writer thread
+		//post: records have been written until the search finished and the ring emptied
+		void WriterLoop();
+
+		/***************************************************************************************************/
+
+		//pre: called from the writer thread, length bytes of the block are in use
+		//post: the first length bytes of the block have been written to the stream
+		void WriteBlock(/*in*/size_t length);		//bytes of the block to write
+
+		/***************************************************************************************************/
+
+		//PDM's
+
+		ostream &outdat;					//stream to write solutions to
+		SolutionRing ring;					//records waiting for the writer
+		Backpressure backpressure;			//what to do when the ring is full
+		deque<SolutionRecord> spill;		//records that did not fit in the ring, oldest first
+		string storage;						//backing memory for the block buffer
+		char *block;						//block buffer, aligned to WRITE_ALIGNMENT
+		string record;						//formatting space for a single record
+		vector<string> startLabels;			//entry line of each label, read by the writer thread
+		vector<string> endLabels;			//exit line of each label, read by the writer thread
+		thread writer;						//writer thread
+		atomic<bool> finished;				//the search has submitted its last solution
+		atomic<long long> bytesWritten;		//bytes written to the stream
+		atomic<SolutionIndexWriter*> index;	//index of the records written, null for none
+		atomic<int> flushRequested;			//number of flushes the search has asked for
+		atomic<int> flushCompleted;			//number of flushes the writer has done
+		long long stalls;					//times the search waited for the ring
+		long long spilled;					//records kept on the search side
+};
+
+#endif
@@ -0,0 +1,53 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Barrier.cpp
+Purpose: Provides the implementation of a barrier.
+*/
+
+#include "Barrier.h"
+#include <thread>				//yield
+
+using namespace std;
+
+//int constants
+const int BARRIER_SPINS = 1000;			//Checks made before yielding the processor
+
+
+//pre: numThreads is greater than zero
+//post: A barrier for numThreads threads has been created
+Barrier::Barrier(/*in*/int inNumThreads)	//number of threads meeting at the barrier
+{
+	numThreads = inNumThreads;
+	arrived.store(0);
+	generation.store(0);
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: Barrier has been initialized
+//post: every thread has reached the barrier
+void Barrier::Wait()
+{
+	int gen = generation.load(memory_order_acquire);
+
+	//Last thread to arrive releases the others
+	if (arrived.fetch_add(1, memory_order_acq_rel) == numThreads - 1)
+	{
+		arrived.store(0, memory_order_relaxed);
+		generation.fetch_add(1, memory_order_release);
+		return;
+
+	}//end if
+
+	for (int spins = 0; generation.load(memory_order_acquire) == gen; spins++)
+	{
+		if (spins >= BARRIER_SPINS)
+			this_thread::yield();
+
+	}//end for
+
+}//end Wait
@@ -0,0 +1,58 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Barrier.h
+Purpose: Provides the specification for a Barrier. A barrier holds each of a fixed number of threads
+			until all of them have reached it, then releases them together. Waiting threads spin briefly
+			and then yield, since the threads of a level-synchronous search meet many times a second.
+*/
+
+#ifndef BARRIER_H
+#define BARRIER_H
+
+#include <atomic>				//Arrival count and generation
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+Barrier(int numThreads);
+	Creates a new Barrier for the given number of threads
+
+void Wait();
+	Blocks until every thread has called Wait, then releases them all
+*/
+
+class Barrier
+{
+
+	public:
+
+		//pre: numThreads is greater than zero
+		//post: A barrier for numThreads threads has been created
+		Barrier(/*in*/int numThreads);			//number of threads meeting at the barrier
+
+		/***************************************************************************************************/
+
+		//pre: Barrier has been initialized
+		//post: every thread has reached the barrier
+		void Wait();
+
+		/***************************************************************************************************/
+
+	private:
+
+		Barrier(const Barrier &orig);			//not copyable
+		void operator=(const Barrier &orig);	//not assignable
+
+		//PDM's
+
+		int numThreads;					//number of threads meeting at the barrier
+		atomic<int> arrived;			//threads waiting in the current generation
+		atomic<int> generation;			//number of times the barrier has released
+};
+
+#endif
@@ -0,0 +1,661 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Benchmark.cpp
+Purpose: Provides the implementation of the benchmarks.
+*/
+
+#include "Benchmark.h"
+#include "Board.h"				//For use of a board
+#include "BitBoard.h"			//Bit-packed board
+#include "FrontierBfs.h"		//Bit-parallel breadth first search
+#include "GridSolver.h"			//Solvers of a flat grid
+#include "HpaGraph.h"			//Hierarchical pathfinding graph
+#include "Location.h"			//Location struct
+#include "MazeBatch.h"			//Many small mazes at once
+#include "ParallelBfs.h"		//Multi-threaded breadth first search
+#include "PathGenerator.h"		//Paths handed back one at a time
+#include "SmallMazeSolver.h"		//Bitboard solver for small boards
+#include "PathEnumerator.h"		//Exhaustive search of a board
+#include "WeightedSolver.h"		//Cheapest path search
+#include <algorithm>			//equal
+#include <chrono>				//Timing
+#include <random>				//Random walls
+#include <vector>				//Distance fields
+
+using namespace std;
+
+//double constants
+const double WALL_DENSITY = 0.3;			//Fraction of cells that are walls on a random board
+const double MIN_BENCH_SECONDS = 0.5;		//Each timing is repeated until it takes this long
+
+//int constants
+const unsigned BENCH_SEED = 20141105;		//Seed for random boards, so runs are comparable
+const int BENCH_MAX_COST = 9;				//Largest cost given to a cell of the weighted board
+const int BENCH_BATCH_MAZES = 4096;			//Small mazes solved by the batch benchmark
+const int BENCH_BATCH_SIZE = 8;				//Height and length of each of them
+const int BENCH_SMALL_MAZES = 1024;			//Small mazes whose every path the small maze benchmark finds
+const int BENCH_SMALL_SIZE = 4;				//Height and length of each of them
+const long long BENCH_ENUM_NODES = 1 << 24;	//Cells expanded by the exhaustive search benchmarks
+const int BENCH_HPA_CHANGES = 256;			//Cells whose wall is flipped by the cluster graph benchmark
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void AddRandomWalls(Board &gb, double density, unsigned seed, bool corridor);
+	Closes a random fraction of the cells of gb, leaving the entry and exit open, and a random corridor
+	between them if asked for
+
+double Seconds(chrono::steady_clock::time_point start);
+	Returns the number of seconds since start
+
+void BenchmarkFrontier(Board &gb, ostream &out);
+	Times the flood fill against each supported frontier kernel
+
+void BenchmarkParallelBfs(Board &gb, int maxThreads, ostream &out);
+	Times the parallel shortest path search from one thread up to maxThreads
+
+void BenchmarkWeighted(Board &gb, ostream &out);
+	Times the cheapest path search with a radix heap against a binary heap, on random costs
+
+void BenchmarkHpa(Board &gb, ostream &out);
+	Times flipping walls through the cluster graph against building it again, and checks the two agree
+
+void BenchmarkBatch(ostream &out);
+	Times many small mazes solved one at a time against solved together in a batch
+
+void BenchmarkSmallMaze(ostream &out);
+	Times every path of many small mazes found by the small maze solver against the exhaustive search
+
+void BenchmarkGenerator(ostream &out);
+	Times every path of many small mazes handed back by a path generator, checked against the exhaustive search
+
+void BenchmarkGrid(Board &gb, ostream &out);
+	Times the solvers of a flat grid on gb against those of the board
+*/
+
+
+//pre: gb has been initialized, 0 <= density <= 1
+//post: a random fraction of the cells of gb have been closed. The entry and exit are open. If corridor
+//		is true, a random staircase of south and east moves from the entry to the exit is left open, so
+//		the exit can always be reached
+static void AddRandomWalls(	/*inout*/Board &gb,			//board to add walls to
+							/*in*/double density,		//fraction of cells to close
+							/*in*/unsigned seed,		//random seed
+							/*in*/bool corridor)		//keep a path from the entry to the exit
+{
+	mt19937 rng(seed);
+	uniform_real_distribution<double> coin(0.0, 1.0);
+	vector<bool> keep(size_t(gb.GetHeight()) * gb.GetLength(), false);	//cells of the corridor
+	Location loc;
+
+	//The corridor is carved before any wall, each move south or east at random until an edge is reached
+	if (corridor)
+	{
+		loc.row = 0; loc.col = 0;
+		keep[0] = true;
+		while (loc.row < gb.GetHeight() - 1 || loc.col < gb.GetLength() - 1)
+		{
+			if (loc.col == gb.GetLength() - 1 || (loc.row < gb.GetHeight() - 1 && coin(rng) < 0.5))
+				loc.row++;
+			else
+				loc.col++;
+
+			keep[size_t(loc.row) * gb.GetLength() + loc.col] = true;
+
+		}//end while
+
+	}//end corridor
+
+	for (loc.row = 0; loc.row < gb.GetHeight(); loc.row++)
+	{
+		for (loc.col = 0; loc.col < gb.GetLength(); loc.col++)
+		{
+			if (coin(rng) < density && !keep[size_t(loc.row) * gb.GetLength() + loc.col])
+				gb.SetOpen(loc, false);
+		}
+	}
+
+	loc.row = 0; loc.col = 0;
+	gb.SetOpen(loc, true);
+	loc.row = gb.GetHeight() - 1; loc.col = gb.GetLength() - 1;
+	gb.SetOpen(loc, true);
+
+}//end AddRandomWalls
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the number of seconds since start has been returned to the caller
+static /*out*/double Seconds(								//elapsed seconds
+				/*in*/chrono::steady_clock::time_point start)	//time to measure from
+{
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+}//end Seconds
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized, out is a valid output stream
+//post: the flood fill and every supported frontier kernel have been timed on gb, their distance
+//		fields compared, and the results written to out
+static void BenchmarkFrontier(	/*in*/Board &gb,			//board to search
+								/*inout*/ostream &out)		//stream to write the results to
+{
+	const FrontierKernel KERNELS[] = {KERNEL_SCALAR, KERNEL_AVX2};
+	double cells = double(gb.GetHeight()) * gb.GetLength();	//cells on the board
+	vector<int> expected, distance;							//distance fields
+	Location entry, exit;									//corners of the board
+	int layers = 0;											//number of layers
+	int runs;												//timed repetitions
+	double seconds;											//time taken
+
+	entry.row = 0; entry.col = 0;
+	exit.row = gb.GetHeight() - 1; exit.col = gb.GetLength() - 1;
+
+	//Reference: one cell at a time over the board
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+		layers = FloodFillDistances(gb, entry, expected);
+	seconds = Seconds(start) / runs;
+
+	out << "flood fill            " << seconds * 1000.0 << " ms, "
+		<< cells / seconds / 1e6 << " Mcells/s, " << layers << " layers" << endl;
+
+	BitBoard bb(gb);
+
+	for (int k = 0; k < 2; k++)
+	{
+		FrontierKernel kernel = KERNELS[k];
+
+		if (!IsKernelSupported(kernel))
+		{
+			out << "frontier " << KernelName(kernel) << "        not supported" << endl;
+			continue;
+
+		}//end if
+
+		start = chrono::steady_clock::now();
+		for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+			layers = ComputeDistanceLayers(bb, entry, distance, kernel);
+		seconds = Seconds(start) / runs;
+
+		out << "frontier " << KernelName(kernel) << " layers  " << seconds * 1000.0 << " ms, "
+			<< cells / seconds / 1e6 << " Mcells/s, " << layers << " layers, "
+			<< (distance == expected ? "matches" : "MISMATCH") << endl;
+
+		bool reachable = false;
+		start = chrono::steady_clock::now();
+		for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+			reachable = IsExitReachable(bb, entry, exit, kernel);
+		seconds = Seconds(start) / runs;
+
+		out << "frontier " << KernelName(kernel) << " reach   " << seconds * 1000.0 << " ms, "
+			<< (reachable ? "reachable, " : "unreachable, ")
+			<< ((reachable == (expected.back() != UNREACHABLE)) ? "matches" : "MISMATCH") << endl;
+
+	}//end for
+
+}//end BenchmarkFrontier
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized, maxThreads is greater than zero, out is a valid output stream
+//post: the parallel shortest path search has been timed with 1, 2, 4, ... threads up to maxThreads,
+//		its path length checked against the flood fill, and the speedup over one thread written to out.
+//		Nothing is timed unless the search expands a layer for each move of the shortest path
+static void BenchmarkParallelBfs(	/*in*/Board &gb,			//board to search
+									/*in*/int maxThreads,		//most threads to use
+									/*inout*/ostream &out)		//stream to write the results to
+{
+	vector<int> expected;					//distance field from the flood fill
+	vector<Direction> moves;				//shortest path found
+	BfsStats stats;							//description of the last search
+	Location entry, exit;					//corners of the board
+	double baseline = 0.0;					//time taken by one thread
+	int runs;								//timed repetitions
+
+	entry.row = 0; entry.col = 0;
+	exit.row = gb.GetHeight() - 1; exit.col = gb.GetLength() - 1;
+
+	FloodFillDistances(gb, entry, expected);
+	BitBoard bb(gb);
+
+	//Threads only share work across the layers of a search that crosses the board, one for each move
+	//of the shortest path. A search that stops after a few layers says nothing about scaling
+	bool crosses = ParallelShortestPath(bb, entry, exit, 1, moves, stats) && expected.back() != UNREACHABLE &&
+				   stats.levels >= expected.back() && stats.levels <= expected.back() + 1;
+
+	if (!crosses)
+	{
+		out << "parallel bfs          " << stats.levels << " layers, shortest path "
+			<< (expected.back() == UNREACHABLE ? string("none") : to_string(expected.back()))
+			<< ", scaling not measured" << endl;
+		return;
+
+	}//end short search
+
+	for (int threads = 1; threads <= maxThreads; threads = (threads * 2 > maxThreads && threads < maxThreads) ? maxThreads : threads * 2)
+	{
+		bool found = false;
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+			found = ParallelShortestPath(bb, entry, exit, threads, moves, stats);
+		double seconds = Seconds(start) / runs;
+
+		if (threads == 1)
+			baseline = seconds;
+
+		out << "parallel bfs " << threads << " threads  " << seconds * 1000.0 << " ms, speedup "
+			<< baseline / seconds << ", " << stats.topDownLevels << " top-down / "
+			<< stats.bottomUpLevels << " bottom-up layers, "
+			<< ((found ? int(moves.size()) : UNREACHABLE) == expected.back() ? "matches" : "MISMATCH") << endl;
+
+	}//end for
+
+}//end BenchmarkParallelBfs
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized, out is a valid output stream
+//post: gb has been given random costs, the cheapest path search has been timed with a radix heap and
+//		with a binary heap, their costs compared, and the speedup of the radix heap written to out
+static void BenchmarkWeighted(	/*inout*/Board &gb,			//board to search
+								/*inout*/ostream &out)		//stream to write the results to
+{
+	mt19937 rng(BENCH_SEED);
+	uniform_int_distribution<int> die(DEFAULT_COST, BENCH_MAX_COST);
+	vector<Direction> moves;				//cheapest path found
+	long long radixCost = 0, binaryCost = 0;	//cost of the path found with each heap
+	bool radixFound = false, binaryFound = false;	//a path was found with each heap
+	Location loc, entry, exit;				//corners of the board
+	int runs;								//timed repetitions
+
+	for (loc.row = 0; loc.row < gb.GetHeight(); loc.row++)
+	{
+		for (loc.col = 0; loc.col < gb.GetLength(); loc.col++)
+			gb.SetCost(loc, die(rng));
+	}
+
+	entry.row = 0; entry.col = 0;
+	exit.row = gb.GetHeight() - 1; exit.col = gb.GetLength() - 1;
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+		binaryFound = CheapestPathBinaryHeap(gb, entry, exit, moves, binaryCost);
+	double binarySeconds = Seconds(start) / runs;
+
+	start = chrono::steady_clock::now();
+	for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+		radixFound = CheapestPath(gb, entry, exit, moves, radixCost);
+	double radixSeconds = Seconds(start) / runs;
+
+	out << "dijkstra binary heap  " << binarySeconds * 1000.0 << " ms, ";
+	if (binaryFound)
+		out << "cost " << binaryCost << endl;
+	else
+		out << "no path" << endl;
+
+	//Two searches that reach nothing agree, but that says nothing about the heaps
+	out << "dijkstra radix heap   " << radixSeconds * 1000.0 << " ms, speedup "
+		<< binarySeconds / radixSeconds << ", "
+		<< (radixFound != binaryFound || radixCost != binaryCost ? "MISMATCH" : radixFound ? "matches" : "no path") << endl;
+
+}//end BenchmarkWeighted
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized, out is a valid output stream
+//post: the cluster graph of a copy of gb has been built, BENCH_HPA_CHANGES random cells of the copy
+//		flipped through it, and the graph compared with one built from scratch. The time of a build and
+//		of a single flip has been written to out
+static void BenchmarkHpa(	/*in*/Board &gb,			//board to search
+							/*inout*/ostream &out)		//stream to write the results to
+{
+	Board changed(gb);						//board whose walls are flipped
+	HpaGraph graph(DEFAULT_CLUSTER_SIZE);	//graph kept up to date cell by cell
+	HpaGraph fresh(DEFAULT_CLUSTER_SIZE);	//graph built from the changed board
+	mt19937 rng(BENCH_SEED);
+	uniform_int_distribution<int> pickRow(0, gb.GetHeight() - 1);
+	uniform_int_distribution<int> pickCol(0, gb.GetLength() - 1);
+	vector<Direction> updatedMoves, freshMoves;	//path found through each graph
+	Location loc, entry, exit;				//corners of the board
+
+	entry.row = 0; entry.col = 0;
+	exit.row = gb.GetHeight() - 1; exit.col = gb.GetLength() - 1;
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	graph.Build(changed);
+	double buildSeconds = Seconds(start);
+
+	//The corners stay open, so both graphs are asked the same question
+	start = chrono::steady_clock::now();
+	for (int i = 0; i < BENCH_HPA_CHANGES; i++)
+	{
+		loc.row = pickRow(rng);
+		loc.col = pickCol(rng);
+		if ((loc.row != entry.row || loc.col != entry.col) && (loc.row != exit.row || loc.col != exit.col))
+			graph.SetOpen(changed, loc, !changed.IsOpen(loc));
+	}
+	double changeSeconds = Seconds(start) / BENCH_HPA_CHANGES;
+
+	fresh.Build(changed);
+	bool updatedFound = graph.FindPath(changed, entry, exit, updatedMoves);
+	bool freshFound = fresh.FindPath(changed, entry, exit, freshMoves);
+	bool same = graph.GetNumNodes() == fresh.GetNumNodes() && graph.GetNumEdges() == fresh.GetNumEdges() &&
+				updatedFound == freshFound && updatedMoves.size() == freshMoves.size();
+
+	out << "hpa build             " << buildSeconds * 1000.0 << " ms, " << fresh.GetNumNodes() << " nodes" << endl;
+	out << "hpa set open          " << changeSeconds * 1000000.0 << " us per cell, speedup "
+		<< buildSeconds / changeSeconds << ", "
+		<< (!same ? "MISMATCH" : updatedFound ? "matches" : "no path") << endl;
+
+}//end BenchmarkHpa
+
+
+/***************************************************************************************************/
+
+
+//pre: out is a valid output stream
+//post: BENCH_BATCH_MAZES random small mazes have been solved one at a time with the frontier search
+//		and together with each supported batch kernel, their distances compared, and the mazes solved
+//		each second written to out
+static void BenchmarkBatch(/*inout*/ostream &out)		//stream to write the results to
+{
+	const FrontierKernel KERNELS[] = {KERNEL_SCALAR, KERNEL_AVX2};
+	vector<BitBoard> boards;								//mazes to solve, packed
+	vector<int> expected(BENCH_BATCH_MAZES), moves;			//distance to the exit of each maze
+	vector<int> distance;									//distance field of a single maze
+	Location entry, exit;									//corners of the mazes
+	int runs;												//timed repetitions
+	double seconds;											//time taken
+
+	entry.row = 0; entry.col = 0;
+	exit.row = BENCH_BATCH_SIZE - 1; exit.col = BENCH_BATCH_SIZE - 1;
+
+	MazeBatch batch(BENCH_BATCH_SIZE, BENCH_BATCH_SIZE);
+
+	for (int m = 0; m < BENCH_BATCH_MAZES; m++)
+	{
+		Board board(BENCH_BATCH_SIZE, BENCH_BATCH_SIZE);
+
+		AddRandomWalls(board, WALL_DENSITY, BENCH_SEED + m, false);
+		boards.push_back(BitBoard(board));
+		batch.AddMaze(board);
+	}
+
+	//Reference: each maze searched on its own
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+	{
+		for (int m = 0; m < BENCH_BATCH_MAZES; m++)
+		{
+			ComputeDistanceLayers(boards[m], entry, distance, KERNEL_SCALAR);
+			expected[m] = distance.back();
+		}
+	}
+	seconds = Seconds(start) / runs;
+
+	out << "single mazes          " << BENCH_BATCH_MAZES / seconds / 1e6 << " Mmazes/s" << endl;
+
+	for (int k = 0; k < 2; k++)
+	{
+		FrontierKernel kernel = KERNELS[k];
+
+		if (!IsKernelSupported(kernel))
+		{
+			out << "batch " << KernelName(kernel) << "           not supported" << endl;
+			continue;
+
+		}//end if
+
+		start = chrono::steady_clock::now();
+		for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+			batch.Solve(entry, exit, kernel, moves);
+		seconds = Seconds(start) / runs;
+
+		out << "batch " << KernelName(kernel) << "          " << BENCH_BATCH_MAZES / seconds / 1e6 << " Mmazes/s, "
+			<< (moves == expected ? "matches" : "MISMATCH") << endl;
+
+	}//end for
+
+}//end BenchmarkBatch
+
+
+/***************************************************************************************************/
+
+
+//pre: out is a valid output stream
+//post: every path of BENCH_SMALL_MAZES random small mazes has been found by the exhaustive search and
+//		by the small maze solver, their numbers of solutions compared, and the mazes solved each
+//		second written to out
+static void BenchmarkSmallMaze(/*inout*/ostream &out)		//stream to write the results to
+{
+	vector<Board> boards;									//mazes to solve
+	vector<int> expected(BENCH_SMALL_MAZES);				//solutions of each maze
+	vector<int> found(BENCH_SMALL_MAZES);					//solutions the small maze solver found
+	double paths = 0;										//solutions of every maze
+	Location entry, exit;									//corners of the mazes
+	int runs;												//timed repetitions
+	double seconds;											//time taken
+
+	entry.row = 0; entry.col = 0;
+	exit.row = BENCH_SMALL_SIZE - 1; exit.col = BENCH_SMALL_SIZE - 1;
+
+	boards.reserve(BENCH_SMALL_MAZES);
+	for (int m = 0; m < BENCH_SMALL_MAZES; m++)
+	{
+		boards.push_back(Board(BENCH_SMALL_SIZE, BENCH_SMALL_SIZE));
+		AddRandomWalls(boards[m], WALL_DENSITY, BENCH_SEED + m, false);
+	}
+
+	//Reference: each maze searched by the exhaustive search, on the heap
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+	{
+		for (int m = 0; m < BENCH_SMALL_MAZES; m++)
+		{
+			PathEnumerator search(boards[m], entry, exit);
+
+			expected[m] = 0;
+			while (search.Next() == SEARCH_SOLUTION)
+				expected[m]++;
+		}
+	}
+	seconds = Seconds(start) / runs;
+
+	out << "enumerator small      " << BENCH_SMALL_MAZES / seconds / 1e6 << " Msolves/s" << endl;
+
+	start = chrono::steady_clock::now();
+	for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+	{
+		for (int m = 0; m < BENCH_SMALL_MAZES; m++)
+			found[m] = SolveSmallMaze(boards[m], nullptr, nullptr, nullptr);
+	}
+	seconds = Seconds(start) / runs;
+
+	//A maze with many paths takes longer to solve, so the paths found each second are shown as well
+	for (int m = 0; m < BENCH_SMALL_MAZES; m++)
+		paths += found[m];
+
+	out << "small maze solver     " << BENCH_SMALL_MAZES / seconds / 1e6 << " Msolves/s, "
+		<< paths / seconds / 1e6 << " Mpaths/s, " << (found == expected ? "matches" : "MISMATCH") << endl;
+
+}//end BenchmarkSmallMaze
+
+
+/***************************************************************************************************/
+
+
+//pre: out is a valid output stream
+//post: every path of BENCH_SMALL_MAZES random small mazes has been handed back by a path generator
+//		and checked, movement by movement, against the path the exhaustive search found in the same
+//		order, then the generators timed and the mazes solved each second written to out
+static void BenchmarkGenerator(/*inout*/ostream &out)		//stream to write the results to
+{
+	vector<Board> boards;									//mazes to solve
+	bool matches = true;									//every path was the same as the search's
+	Location entry, exit;									//corners of the mazes
+	long long paths = 0;									//solutions of every maze
+	int runs;												//timed repetitions
+	double seconds;											//time taken
+
+	entry.row = 0; entry.col = 0;
+	exit.row = BENCH_SMALL_SIZE - 1; exit.col = BENCH_SMALL_SIZE - 1;
+
+	boards.reserve(BENCH_SMALL_MAZES);
+	for (int m = 0; m < BENCH_SMALL_MAZES; m++)
+	{
+		boards.push_back(Board(BENCH_SMALL_SIZE, BENCH_SMALL_SIZE));
+		AddRandomWalls(boards[m], WALL_DENSITY, BENCH_SEED + m, false);
+	}
+
+	//Each path handed back must be the next one the exhaustive search finds, and none may be left over
+	for (int m = 0; m < BENCH_SMALL_MAZES && matches; m++)
+	{
+		PathGenerator generator(boards[m], entry, exit);
+		PathEnumerator search(boards[m], entry, exit);
+
+		for (const PathView &path : generator)
+		{
+			if (search.Next() != SEARCH_SOLUTION || search.GetNumMoves() != path.size() ||
+				!equal(path.begin(), path.end(), search.GetMoves()))
+			{
+				matches = false;
+				break;
+			}
+		}
+
+		if (matches && search.Next() == SEARCH_SOLUTION)
+			matches = false;
+
+	}//end check
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+	{
+		paths = 0;
+		for (int m = 0; m < BENCH_SMALL_MAZES; m++)
+		{
+			PathGenerator generator(boards[m], entry, exit);
+			PathView path;
+
+			while (generator.Next(path))
+				paths++;
+		}
+	}
+	seconds = Seconds(start) / runs;
+
+	out << "path generator        " << BENCH_SMALL_MAZES / seconds / 1e6 << " Msolves/s, "
+		<< paths / seconds / 1e6 << " Mpaths/s, " << (matches ? "matches" : "MISMATCH") << endl;
+
+}//end BenchmarkGenerator
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized, out is a valid output stream
+//post: the shortest path search of a flat grid of gb has been timed and its path length checked
+//		against the flood fill, and the exhaustive searches of the board and of the grid timed over
+//		BENCH_ENUM_NODES expanded cells each, and the results written to out
+static void BenchmarkGrid(	/*in*/Board &gb,			//board to search
+							/*inout*/ostream &out)		//stream to write the results to
+{
+	FlatGrid grid(gb);
+	vector<int> expected;					//distance field from the flood fill
+	vector<int> moves;						//shortest path found
+	vector<int> coords(2, 0);				//coordinates of a corner
+	Location entry, exit;					//corners of the board
+	size_t entryCell, exitCell;				//corners of the grid
+	long long boardNodes = 0, gridNodes = 0;	//cells expanded by each exhaustive search
+	bool found = false;
+	int runs;								//timed repetitions
+	double seconds;							//time taken
+
+	entry.row = 0; entry.col = 0;
+	exit.row = gb.GetHeight() - 1; exit.col = gb.GetLength() - 1;
+	grid.CellOf(coords, entryCell);
+	coords[0] = exit.row; coords[1] = exit.col;
+	grid.CellOf(coords, exitCell);
+
+	FloodFillDistances(gb, entry, expected);
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (runs = 0; runs == 0 || Seconds(start) < MIN_BENCH_SECONDS; runs++)
+		found = GridShortestPath(grid, entryCell, exitCell, moves);
+	seconds = Seconds(start) / runs;
+
+	out << "grid bfs              " << seconds * 1000.0 << " ms, "
+		<< ((found ? int(moves.size()) : UNREACHABLE) == expected.back() ? "matches" : "MISMATCH") << endl;
+
+	//Both searches stop at the same number of expanded cells, on the same cells of the same board
+	{
+		PathEnumerator search(gb, entry, exit);
+
+		search.SetPauseInterval(BENCH_ENUM_NODES);
+		start = chrono::steady_clock::now();
+		while (search.Next() == SEARCH_SOLUTION);
+		seconds = Seconds(start);
+		boardNodes = search.GetNodes();
+
+	}//end board search
+
+	out << "board enumerator      " << boardNodes / seconds / 1e6 << " Mcells/s" << endl;
+
+	{
+		GridEnumerator search(grid, entryCell, exitCell);
+
+		search.SetPauseInterval(BENCH_ENUM_NODES);
+		start = chrono::steady_clock::now();
+		while (search.Next() == SEARCH_SOLUTION);
+		seconds = Seconds(start);
+		gridNodes = search.GetNodes();
+
+	}//end grid search
+
+	out << "grid enumerator       " << gridNodes / seconds / 1e6 << " Mcells/s, "
+		<< (gridNodes == boardNodes ? "matches" : "MISMATCH") << endl;
+
+}//end BenchmarkGrid
+
+
+/***************************************************************************************************/
+
+
+//pre: size and maxThreads are greater than zero, out is a valid output stream
+//post: every benchmark has been run on a size x size board and the results written to out
+void RunBenchmarks(	/*in*/int size,				//height and length of the board
+					/*in*/int maxThreads,		//most threads for the parallel benchmarks
+					/*inout*/ostream &out)		//stream to write the results to
+{
+	Board board(size, size);
+
+	//The searches across the board are only worth timing if they can reach the far corner
+	AddRandomWalls(board, WALL_DENSITY, BENCH_SEED, true);
+
+	out << "Benchmark board: " << size << " x " << size << ", "
+		<< int(WALL_DENSITY * 100) << "% walls" << endl;
+
+	BenchmarkFrontier(board, out);
+	BenchmarkParallelBfs(board, maxThreads, out);
+	BenchmarkWeighted(board, out);
+	BenchmarkHpa(board, out);
+	BenchmarkBatch(out);
+	BenchmarkSmallMaze(out);
+	BenchmarkGenerator(out);
+	BenchmarkGrid(board, out);
+
+}//end RunBenchmarks
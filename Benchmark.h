@@ -0,0 +1,33 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Benchmark.h
+Purpose: Provides the specification for the benchmarks. Each benchmark builds a random board, times the
+			solvers being compared on it, checks that they agree, and reports the results.
+*/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <ostream>				//Output stream
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void RunBenchmarks(int size, int maxThreads, ostream &out);
+	Given: a board size, the most threads to use, and an output stream
+		-> runs every benchmark on a size x size board and writes the results to out
+*/
+
+
+//pre: size and maxThreads are greater than zero, out is a valid output stream
+//post: every benchmark has been run on a size x size board and the results written to out
+void RunBenchmarks(	/*in*/int size,				//height and length of the board
+					/*in*/int maxThreads,		//most threads for the parallel benchmarks
+					/*inout*/ostream &out);		//stream to write the results to
+
+#endif
@@ -0,0 +1,125 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: BitBoard.cpp
+Purpose: Provides the implementation of a bitboard.
+*/
+
+#include "BitBoard.h"
+
+using namespace std;
+
+
+//pre: gb has been initialized
+//post: A bitboard holding the open cells of gb has been created
+BitBoard::BitBoard(/*in*/Board &gb)			//board to pack
+{
+	Location loc;
+
+	height = gb.GetHeight();
+	length = gb.GetLength();
+	rowWords = (length + WORD_BITS * BLOCK_WORDS - 1) / (WORD_BITS * BLOCK_WORDS) * BLOCK_WORDS;
+	bits.assign(size_t(height) * rowWords, 0);
+
+	for (loc.row = 0; loc.row < height; loc.row++)
+	{
+		for (loc.col = 0; loc.col < length; loc.col++)
+		{
+			if (gb.IsOpen(loc))
+				SetOpen(loc, true);
+		}
+	}
+
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: height and length are greater than zero
+//post: A bitboard of the given size with every cell closed has been created
+BitBoard::BitBoard(	/*in*/int inHeight,		//height of the new bitboard
+					/*in*/int inLength)		//length of the new bitboard
+{
+	height = inHeight;
+	length = inLength;
+	rowWords = (length + WORD_BITS * BLOCK_WORDS - 1) / (WORD_BITS * BLOCK_WORDS) * BLOCK_WORDS;
+	bits.assign(size_t(height) * rowWords, 0);
+
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: loc is a valid Location within the bounds of the board
+//post: True is returned to the caller if the given Location is open, false otherwise
+/*out*/bool BitBoard::IsOpen(				//boolean value returned to the caller
+				/*in*/Location loc) const	//valid location within the bounds of the board
+{
+	return (Row(loc.row)[loc.col / WORD_BITS] >> (loc.col % WORD_BITS)) & 1;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: loc is a valid Location within the bounds of the board
+//post:	The given Location's open value has been set appropriately
+void BitBoard::SetOpen(	/*in*/Location loc,		//valid location within the bounds of the board
+						/*in*/bool open)		//desired boolean value for the given location
+{
+	unsigned long long &word = bits[size_t(loc.row) * rowWords + loc.col / WORD_BITS];
+	unsigned long long mask = 1ULL << (loc.col % WORD_BITS);
+
+	if (open)
+		word |= mask;
+	else
+		word &= ~mask;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the height of the board
+/*out*/int BitBoard::GetHeight() const			//height is returned to the caller
+{
+	return height;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the length of the board
+/*out*/int BitBoard::GetLength() const			//length is returned to the caller
+{
+	return length;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of words in each row
+/*out*/int BitBoard::GetRowWords() const		//words per row are returned to the caller
+{
+	return rowWords;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: 0 <= row < GetHeight()
+//post: returns the GetRowWords() packed words of the given row
+/*out*/const unsigned long long* BitBoard::Row(	//packed row returned to the caller
+				/*in*/int row) const				//row to return
+{
+	return &bits[size_t(row) * rowWords];
+}
@@ -0,0 +1,206 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: BitBoard.h
+Purpose: Provides the specification for a BitBoard. A bitboard is a row-major, bit-packed copy of the
+			open cells of a Board. Bit col of a row is column col, and every row is padded with closed
+			cells to a whole number of 256 bit blocks so a row can be processed a block at a time.
+*/
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include "Board.h"				//For use of a board
+#include "Location.h"			//Location struct
+#include <vector>				//Packed rows
+
+#if defined(_MSC_VER)
+#include <intrin.h>				//Bit scan and population count
+#endif
+
+using namespace std;
+
+//Number of bits in a word of a row
+const int WORD_BITS = 64;
+
+//Number of words in a 256 bit block of a row
+const int BLOCK_WORDS = 4;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+BitBoard(Board &gb);
+	Creates a new BitBoard holding the open cells of gb
+
+BitBoard(int height, int length);
+	Creates a new BitBoard of the given size with every cell closed
+
+bool IsOpen(Location loc) const;
+	Returns true if the given location is open
+
+void SetOpen(Location loc, bool open);
+	Sets the given location's open value
+
+int GetHeight() const;
+	Returns the height of the board
+
+int GetLength() const;
+	Returns the length of the board
+
+int GetRowWords() const;
+	Returns the number of words in each row, always a multiple of BLOCK_WORDS
+
+const unsigned long long* Row(int row) const;
+	Returns the packed words of the given row
+
+int CountTrailingZeros(unsigned long long word);
+	Returns the index of the lowest set bit of a nonzero word
+
+int HighestBit(unsigned long long word);
+	Returns the index of the highest set bit of a nonzero word
+
+int PopCount(unsigned long long word);
+	Returns the number of set bits in a word
+*/
+
+
+class BitBoard
+{
+
+	public:
+
+		//pre: gb has been initialized
+		//post: A bitboard holding the open cells of gb has been created
+		BitBoard(/*in*/Board &gb);				//board to pack
+
+		/***************************************************************************************************/
+
+		//pre: height and length are greater than zero
+		//post: A bitboard of the given size with every cell closed has been created
+		BitBoard(	/*in*/int height,			//height of the new bitboard
+					/*in*/int length);			//length of the new bitboard
+
+		/***************************************************************************************************/
+
+		//pre: loc is a valid Location within the bounds of the board
+		//post: True is returned to the caller if the given Location is open, false otherwise
+		/*out*/bool IsOpen(						//boolean value returned to the caller
+					/*in*/Location loc) const;	//valid location within the bounds of the board
+
+		/***************************************************************************************************/
+
+		//pre: loc is a valid Location within the bounds of the board
+		//post:	The given Location's open value has been set appropriately
+		void SetOpen(	/*in*/Location loc,		//valid location within the bounds of the board
+						/*in*/bool open);		//desired boolean value for the given location
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the height of the board
+		/*out*/int GetHeight() const;			//height is returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the length of the board
+		/*out*/int GetLength() const;			//length is returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of words in each row
+		/*out*/int GetRowWords() const;			//words per row are returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: 0 <= row < GetHeight()
+		//post: returns the GetRowWords() packed words of the given row
+		/*out*/const unsigned long long* Row(	//packed row returned to the caller
+					/*in*/int row) const;		//row to return
+
+		/***************************************************************************************************/
+
+	private:
+
+		//PDM's
+
+		vector<unsigned long long> bits;	//packed rows, rowWords words each
+		int height;							//height of the board
+		int length;							//length of the board
+		int rowWords;						//words in each row
+};
+
+
+/***************************************************************************************************/
+
+
+//pre: word is not zero
+//post: the index of the lowest set bit has been returned to the caller
+inline /*out*/int CountTrailingZeros(			//index of the lowest set bit
+				/*in*/unsigned long long word)	//word to scan
+{
+#if defined(__GNUC__)
+	return __builtin_ctzll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, word);
+	return int(index);
+#else
+	int index = 0;
+	while ((word & 1) == 0)
+	{
+		word >>= 1;
+		index++;
+	}
+	return index;
+#endif
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: word is not zero
+//post: the index of the highest set bit has been returned to the caller
+inline /*out*/int HighestBit(					//index of the highest set bit
+				/*in*/unsigned long long word)	//word to scan
+{
+#if defined(__GNUC__)
+	return 63 - __builtin_clzll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanReverse64(&index, word);
+	return int(index);
+#else
+	int index = 0;
+	while ((word >>= 1) != 0)
+		index++;
+	return index;
+#endif
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the number of set bits in word has been returned to the caller
+inline /*out*/int PopCount(						//number of set bits
+				/*in*/unsigned long long word)	//word to count
+{
+#if defined(__GNUC__)
+	return __builtin_popcountll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	return int(__popcnt64(word));
+#else
+	int count = 0;
+	for (; word != 0; word &= word - 1)
+		count++;
+	return count;
+#endif
+}
+
+#endif
@@ -6,7 +6,9 @@ Filename: Board.cpp
 Purpose: Provides the implementation of a board.
 */
 #include "Board.h"
+#include "MemoryProfile.h"
 #include <iostream>
+#include <string>
 
 /*
 
@@ -33,6 +35,7 @@ Board::Board()
 	{
 		gb[i] = new Cell[length];
 	}
+	CountAllocation(HOOK_BOARD, height * (sizeof(Cell*) + length * sizeof(Cell)));
 
 	Setup();
 }
@@ -54,6 +57,7 @@ Board::Board(	/*in*/int inLength,	//length of the new board
 	{
 		gb[i] = new Cell[length/*col*/];
 	}
+	CountAllocation(HOOK_BOARD, height * (sizeof(Cell*) + length * sizeof(Cell)));
 
 	Setup();
 }
@@ -75,6 +79,8 @@ Board::Board(/*in*/const Board &orig)	//board to copy
 	{
 		gb[i] = new Cell[length];
 	}
+	CountAllocation(HOOK_BOARD_COPY, height * (sizeof(Cell*) + length * sizeof(Cell)) +
+					orig.costs.size() * sizeof(unsigned short));
 
 	Setup();
 
@@ -89,6 +95,8 @@ Board::Board(/*in*/const Board &orig)	//board to copy
 		}
 	}
 
+	costs = orig.costs;
+
 }
 
 
@@ -161,19 +169,67 @@ void Board::SetOpen(	/*in*/Location loc,	//valid location within the bounds of t
 //post: prints the current board to the console
 void Board::Print()
 {
+	string text;
+
+	//The board is built up in memory and written to the console at once
+	text.reserve(size_t(height) * (3 * length + 2) + 1);
+
 	for (int i = 1; i < height-1; i++)
 	{
 		for (int j = 1; j < length-1; j++)
 		{
 			if (gb[i][j].open)
-				cout << " O ";
+				text += " O ";
 			else
-				cout << " | ";
+				text += " | ";
 		}
-		cout << endl << endl;
+		text += "\n\n";
 	}
 
-	cout << endl;
+	text += '\n';
+	cout.write(text.data(), text.size());
+	cout.flush();
+}
+
+
+/***************************************************************************************************/
+
+
+
+//pre: Board has been initialized
+//post: returns a hash of the board's dimensions and open cells. Boards with the same
+//		dimensions and walls have the same hash, however the walls were added
+/*out*/unsigned long long Board::Hash()		//hash is returned to the caller
+{
+	const unsigned long long FNV_OFFSET = 14695981039346656037ULL;
+	const unsigned long long FNV_PRIME = 1099511628211ULL;
+	unsigned long long hash = FNV_OFFSET;
+	unsigned char packed = 0;
+	int bits = 0;
+
+	hash = (hash ^ (unsigned long long)GetHeight()) * FNV_PRIME;
+	hash = (hash ^ (unsigned long long)GetLength()) * FNV_PRIME;
+
+	//Eight cells to a byte, row by row
+	for (int i = 1; i < height - 1; i++)
+	{
+		for (int j = 1; j < length - 1; j++)
+		{
+			packed = (unsigned char)((packed << 1) | (gb[i][j].open ? 1 : 0));
+
+			if (++bits == 8)
+			{
+				hash = (hash ^ packed) * FNV_PRIME;
+				packed = 0;
+				bits = 0;
+			}
+		}
+	}
+
+	if (bits > 0)
+		hash = (hash ^ packed) * FNV_PRIME;
+
+	return hash;
 }
 
 
@@ -202,4 +258,52 @@ void Board::Setup()
 		}
 	}
 
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: Board has been initialized, loc is a valid Location within the bounds of the board,
+//		1 <= cost <= MAX_COST
+//post: the cost of moving into the given Location has been set. The cost layer is only
+//		allocated once some Location is given a cost other than DEFAULT_COST
+void Board::SetCost(	/*in*/Location loc,		//valid location within the bounds of the board
+						/*in*/int cost)			//cost of moving into the location
+{
+	if (costs.empty())
+	{
+		if (cost == DEFAULT_COST)
+			return;
+		costs.assign(size_t(height - 2) * (length - 2), (unsigned short)DEFAULT_COST);
+	}
+
+	costs[size_t(loc.row) * (length - 2) + loc.col] = (unsigned short)cost;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: Board has been initialized, loc is a valid Location within the bounds of the board
+//post: the cost of moving into the given Location has been returned to the caller
+/*out*/int Board::GetCost(					//cost returned to the caller
+					/*in*/Location loc)		//valid location within the bounds of the board
+{
+	if (costs.empty())
+		return DEFAULT_COST;
+
+	return costs[size_t(loc.row) * (length - 2) + loc.col];
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: Board has been initialized
+//post: True is returned to the caller if the board has a cost layer, false if every move
+//		costs DEFAULT_COST
+/*out*/bool Board::HasCosts()				//boolean value returned to the caller
+{
+	return !costs.empty();
 }
\ No newline at end of file
@@ -7,13 +7,18 @@ Purpose: Provides the specification for Board. A board is a dynamically allocate
 			A board represents a maze.
 */
 
+#ifndef BOARD_H
+#define BOARD_H
 
 #include "Cell.h"			//For use of a Cell structure
 #include "Location.h"		//For used of a Location structure
 #include <iostream>			//For cout
+#include <vector>			//For the cost layer
 
 const int INIT_HEIGHT = 2;
 const int INIT_LENGTH = 2;
+const int DEFAULT_COST = 1;			//Cost of moving into a cell without a cost of its own
+const int MAX_COST = 65535;			//Largest cost a cell can be given
 
 using namespace std;
 
@@ -67,6 +72,18 @@ int GetLength();
 void Print();
 	Prints the current board
 
+unsigned long long Hash();
+	Returns a hash of the board's dimensions and open cells
+
+void SetCost(Location loc, int cost);
+	Sets the cost of moving into the given location
+
+int GetCost(Location loc);
+	Returns the cost of moving into the given location
+
+bool HasCosts();
+	Returns true to the caller if any location has a cost other than the default
+
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
 void Setup();
@@ -135,6 +152,36 @@ class Board
 
 		/***************************************************************************************************/
 
+		//pre: Board has been initialized
+		//post: returns a hash of the board's dimensions and open cells. Boards with the same
+		//		dimensions and walls have the same hash, however the walls were added
+		/*out*/unsigned long long Hash();		//hash is returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: Board has been initialized, loc is a valid Location within the bounds of the board,
+		//		1 <= cost <= MAX_COST
+		//post: the cost of moving into the given Location has been set. The cost layer is only
+		//		allocated once some Location is given a cost other than DEFAULT_COST
+		void SetCost(	/*in*/Location loc,		//valid location within the bounds of the board
+						/*in*/int cost);		//cost of moving into the location
+
+		/***************************************************************************************************/
+
+		//pre: Board has been initialized, loc is a valid Location within the bounds of the board
+		//post: the cost of moving into the given Location has been returned to the caller
+		/*out*/int GetCost(						//cost returned to the caller
+					/*in*/Location loc);		//valid location within the bounds of the board
+
+		/***************************************************************************************************/
+
+		//pre: Board has been initialized
+		//post: True is returned to the caller if the board has a cost layer, false if every move
+		//		costs DEFAULT_COST
+		/*out*/bool HasCosts();					//boolean value returned to the caller
+
+		/***************************************************************************************************/
+
 	private:
 
 		//pre: Board has been initialized
@@ -148,6 +195,10 @@ class Board
 		//PDM's
 
 		Cell **gb;			//to represent a 2D array of cell pointers
+		vector<unsigned short> costs;	//cost of moving into each cell, row by row without the border.
+										//Empty while every cell costs DEFAULT_COST
 		int height;			//height of the board
 		int length;			//length of the board
-};
\ No newline at end of file
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Checkpoint.cpp
+Purpose: Provides the implementation for saving and loading checkpoints of an exhaustive search.
+*/
+
+#include "Checkpoint.h"
+#include <cstdio>				//rename, remove
+#include <fstream>				//Checkpoint files
+
+#if defined(_WIN32)
+#include <fcntl.h>				//_O_RDWR
+#include <io.h>					//_open, _chsize_s
+#else
+#include <unistd.h>				//truncate
+#endif
+
+using namespace std;
+
+//Checkpoint file identification
+const unsigned int CHECKPOINT_MAGIC = 0x504B434D;		//"MCKP"
+const unsigned int CHECKPOINT_VERSION = 2;
+
+
+//pre: search has been initialized, every solution up to info.counter has been written to the
+//		output file, which ends at info.outputOffset
+//post: a checkpoint of the run has replaced fileName. Returns true to the caller if it was written,
+//		false otherwise, in which case fileName is unchanged
+/*out*/bool SaveCheckpoint(								//boolean value returned to the caller
+				/*in*/const string &fileName,			//checkpoint file
+				/*in*/const PathEnumerator &search,		//search to save
+				/*in*/const CheckpointInfo &info)		//where the run had got to
+{
+	string tempName = fileName + CHECKPOINT_TEMP_SUFFIX;
+	ofstream outdat(tempName.c_str(), ios::out | ios::binary | ios::trunc);
+
+	if (!outdat.good())
+		return false;
+
+	outdat.write(reinterpret_cast<const char*>(&CHECKPOINT_MAGIC), sizeof(CHECKPOINT_MAGIC));
+	outdat.write(reinterpret_cast<const char*>(&CHECKPOINT_VERSION), sizeof(CHECKPOINT_VERSION));
+	outdat.write(reinterpret_cast<const char*>(&info.shard), sizeof(info.shard));
+	outdat.write(reinterpret_cast<const char*>(&info.numShards), sizeof(info.numShards));
+	outdat.write(reinterpret_cast<const char*>(&info.unit), sizeof(info.unit));
+	outdat.write(reinterpret_cast<const char*>(&info.counter), sizeof(info.counter));
+	outdat.write(reinterpret_cast<const char*>(&info.outputOffset), sizeof(info.outputOffset));
+	search.SaveState(outdat);
+	outdat.close();
+
+	if (outdat.fail())
+	{
+		remove(tempName.c_str());
+		return false;
+
+	}//end write error
+
+	//rename replaces the old checkpoint in one step where the system allows it, Windows
+	//will not rename over an existing file so the old one has to go first there
+	if (rename(tempName.c_str(), fileName.c_str()) != 0)
+	{
+		remove(fileName.c_str());
+
+		if (rename(tempName.c_str(), fileName.c_str()) != 0)
+			return false;
+
+	}//end rename
+
+	return true;
+
+}//end SaveCheckpoint
+
+
+/***************************************************************************************************/
+
+
+//pre: search has been created for the board, entry and exit of the saved run
+//post: if fileName holds a checkpoint of the same search, search continues from it, info holds
+//		where the run had got to and true is returned to the caller. Otherwise false is
+//		returned and search is unchanged
+/*out*/bool LoadCheckpoint(								//boolean value returned to the caller
+				/*in*/const string &fileName,			//checkpoint file
+				/*inout*/PathEnumerator &search,		//search to continue
+				/*out*/CheckpointInfo &info)			//where the run had got to
+{
+	ifstream indat(fileName.c_str(), ios::in | ios::binary);
+	unsigned int magic, version;
+	CheckpointInfo saved;
+
+	if (!indat.good())
+		return false;
+
+	indat.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+	indat.read(reinterpret_cast<char*>(&version), sizeof(version));
+	indat.read(reinterpret_cast<char*>(&saved.shard), sizeof(saved.shard));
+	indat.read(reinterpret_cast<char*>(&saved.numShards), sizeof(saved.numShards));
+	indat.read(reinterpret_cast<char*>(&saved.unit), sizeof(saved.unit));
+	indat.read(reinterpret_cast<char*>(&saved.counter), sizeof(saved.counter));
+	indat.read(reinterpret_cast<char*>(&saved.outputOffset), sizeof(saved.outputOffset));
+
+	if (!indat.good() || magic != CHECKPOINT_MAGIC || version != CHECKPOINT_VERSION ||
+		saved.unit < 0 || saved.counter < 0 || saved.outputOffset < 0)
+		return false;
+
+	if (!search.LoadState(indat))
+		return false;
+
+	info = saved;
+	return true;
+
+}//end LoadCheckpoint
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: if fileName exists and is at least bytes long, everything after its first bytes, such as
+//		the paths and footer of the run stopped after the checkpoint, has been removed and true is
+//		returned to the caller. Otherwise false is returned and the file is unchanged
+/*out*/bool TruncateOutput(								//boolean value returned to the caller
+				/*in*/const string &fileName,			//output file
+				/*in*/long long bytes)					//bytes to keep
+{
+	ifstream indat(fileName.c_str(), ios::in | ios::binary | ios::ate);
+
+	if (!indat.good() || (long long)indat.tellg() < bytes)
+		return false;
+
+	indat.close();
+
+#if defined(_WIN32)
+	int handle = _open(fileName.c_str(), _O_RDWR | _O_BINARY);
+	bool cut;
+
+	if (handle == -1)
+		return false;
+
+	cut = _chsize_s(handle, bytes) == 0;
+	_close(handle);
+	return cut;
+#else
+	return truncate(fileName.c_str(), (off_t)bytes) == 0;
+#endif
+
+}//end TruncateOutput
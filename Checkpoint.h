@@ -0,0 +1,80 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Checkpoint.h
+Purpose: Provides the specification for saving and loading checkpoints of an exhaustive search. A
+			checkpoint holds the state of a PathEnumerator, which unit of a shard it is searching, the
+			number of solutions found so far and how far into the output file they have been written. A checkpoint is written to a
+			temporary file and renamed over the last one, so a run killed while saving still leaves
+			the previous checkpoint whole.
+*/
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "PathEnumerator.h"		//Search state
+#include <string>				//File names
+
+using namespace std;
+
+//String constants
+const string DEFAULT_CHECKPOINT_FILE = "solution.ckpt";			//Default checkpoint file
+const string CHECKPOINT_TEMP_SUFFIX = ".tmp";					//Suffix of a checkpoint being written
+
+
+//Where a run had got to, besides the state of its search
+struct CheckpointInfo
+{
+	int shard;					//shard being searched
+	int numShards;				//number of shards, zero for a serial run
+	int unit;					//unit of the shard being searched
+	int counter;				//current solution number
+	long long outputOffset;		//bytes of the output file in use
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool SaveCheckpoint(const string &fileName, const PathEnumerator &search, const CheckpointInfo &info);
+	Given: a file name, a search and where the run had got to
+		-> writes a checkpoint to fileName, returns false if it could not be written
+
+bool LoadCheckpoint(const string &fileName, PathEnumerator &search, CheckpointInfo &info);
+	Given: a file name and a search of the same board
+		-> continues the search from the checkpoint in fileName, returns false if there is none that fits
+
+bool TruncateOutput(const string &fileName, long long bytes);
+	Given: an output file and the bytes in use when a checkpoint was saved
+		-> cuts the file back to them, returns false if it could not be cut
+*/
+
+
+//pre: search has been initialized, every solution up to info.counter has been written to the
+//		output file, which ends at info.outputOffset
+//post: a checkpoint of the run has replaced fileName. Returns true to the caller if it was written,
+//		false otherwise, in which case fileName is unchanged
+/*out*/bool SaveCheckpoint(								//boolean value returned to the caller
+				/*in*/const string &fileName,			//checkpoint file
+				/*in*/const PathEnumerator &search,		//search to save
+				/*in*/const CheckpointInfo &info);		//where the run had got to
+
+//pre: search has been created for the board, entry and exit of the saved run
+//post: if fileName holds a checkpoint of the same search, search continues from it, info holds
+//		where the run had got to and true is returned to the caller. Otherwise false is
+//		returned and search is unchanged
+/*out*/bool LoadCheckpoint(								//boolean value returned to the caller
+				/*in*/const string &fileName,			//checkpoint file
+				/*inout*/PathEnumerator &search,		//search to continue
+				/*out*/CheckpointInfo &info);			//where the run had got to
+
+//pre: none
+//post: if fileName exists and is at least bytes long, everything after its first bytes, such as
+//		the paths and footer of the run stopped after the checkpoint, has been removed and true is
+//		returned to the caller. Otherwise false is returned and the file is unchanged
+/*out*/bool TruncateOutput(								//boolean value returned to the caller
+				/*in*/const string &fileName,			//output file
+				/*in*/long long bytes);					//bytes to keep
+
+#endif
@@ -0,0 +1,29 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Direction.h
+Purpose: Provides the specification for a Direction. A direction is one of the four possible
+			movements from a given location, along with the string literals used to write them.
+*/
+
+#ifndef DIRECTION_H
+#define DIRECTION_H
+
+#include <string>				//Direction string literals
+
+using namespace std;
+
+//At a given location, possible movements are up(NORTH), down(SOUTH), right(EAST), left(WEST)
+enum Direction {NORTH, SOUTH, EAST, WEST};
+
+//Number of possible movements from a given location
+const int NUM_DIRECTIONS = 4;
+
+//String constants
+const string NORTH_STR = "NORTH";									//North string literal
+const string SOUTH_STR = "SOUTH";									//South string literal
+const string EAST_STR = "EAST";										//East  string literal
+const string WEST_STR = "WEST";										//West string literal
+
+#endif
@@ -0,0 +1,233 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Doors.cpp
+Purpose: Provides the implementation for the doors of a maze.
+*/
+
+#include "Doors.h"
+#include "BitBoard.h"			//CountTrailingZeros
+#include "FrontierBfs.h"		//UNREACHABLE
+#include "PathWriter.h"			//Path exit lines
+#include <algorithm>			//min, fill
+
+using namespace std;
+
+//String constants
+const string ENTER_FROM_STR = "START. ENTER FROM ";				//Start of a door's entry line
+const string EXIT_STR = "EXIT ";								//Start of a door's exit line
+const string DOOR_AT_STR = " AT ";								//Before the cell of a door
+
+
+//pre: none
+//post: if name is NORTH_STR, SOUTH_STR, EAST_STR or WEST_STR, side holds that direction and true has
+//		been returned to the caller. Otherwise false has been returned
+/*out*/bool ReadSide(							//boolean value returned to the caller
+				/*in*/const string &name,		//name of a side
+				/*out*/Direction &side)			//side named
+{
+	if (name == NORTH_STR)
+		side = NORTH;
+	else if (name == SOUTH_STR)
+		side = SOUTH;
+	else if (name == EAST_STR)
+		side = EAST;
+	else if (name == WEST_STR)
+		side = WEST;
+	else
+		return false;
+
+	return true;
+
+}//end ReadSide
+
+
+/***************************************************************************************************/
+
+
+//pre: height and length are greater than zero
+//post: true has been returned to the caller if door's cell is within the board and on the edge its
+//		side opens onto, false otherwise
+/*out*/bool IsOnEdge(							//boolean value returned to the caller
+				/*in*/const Door &door,			//door to check
+				/*in*/int height,				//height of the board
+				/*in*/int length)				//length of the board
+{
+	if (door.cell.row < 0 || door.cell.row >= height || door.cell.col < 0 || door.cell.col >= length)
+		return false;
+
+	switch (door.side)
+	{
+	case NORTH:
+		return door.cell.row == 0;
+
+	case SOUTH:
+		return door.cell.row == height - 1;
+
+	case EAST:
+		return door.cell.col == length - 1;
+
+	default:
+		return door.cell.col == 0;
+
+	}//end switch
+
+}//end IsOnEdge
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the cell and side of door, "row col SIDE", have been returned to the caller
+/*out*/string DoorName(/*in*/const Door &door)	//door to name
+{
+	return to_string(door.cell.row) + " " + to_string(door.cell.col) + " " + DirectionString(door.side);
+
+}//end DoorName
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the entry line of a path entering through door has been returned to the caller
+/*out*/string EntryLine(/*in*/const Door &door)	//door entered by
+{
+	return ENTER_FROM_STR + DirectionString(door.side) + DOOR_AT_STR + to_string(door.cell.row) + " " +
+		   to_string(door.cell.col) + ".";
+
+}//end EntryLine
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the exit line of a path leaving through door, ending with END_PATH, has been returned to
+//		the caller
+/*out*/string ExitLine(/*in*/const Door &door)		//door left by
+{
+	return EXIT_STR + DirectionString(door.side) + DOOR_AT_STR + to_string(door.cell.row) + " " +
+		   to_string(door.cell.col) + ". " + END_PATH;
+
+}//end ExitLine
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, every door is within its bounds
+//post: moves holds, for every entry e and exit x, the fewest movements from e to x over the open
+//		cells of gb at moves[e * exits.size() + x], or UNREACHABLE. The entries are searched
+//		DOOR_LANES at a time
+void DoorDistances(	/*in*/Board &gb,						//board to search
+					/*in*/const vector<Door> &entries,		//entry doors
+					/*in*/const vector<Door> &exits,		//exit doors
+					/*out*/vector<int> &moves)				//movements between each pair
+{
+	size_t width = size_t(gb.GetLength()) + 2;
+	long long offset[NUM_DIRECTIONS] = {-(long long)width, (long long)width, 1, -1};	//NORTH, SOUTH, EAST, WEST
+	vector<unsigned char> open(size_t(gb.GetHeight() + 2) * width, 0);
+	vector<unsigned long long> reached(open.size());		//entries that have reached each cell
+	vector<unsigned long long> fresh(open.size());			//entries that reached each cell in the last layer
+	vector<unsigned long long> next(open.size());			//entries reaching each cell in this layer
+	vector<size_t> frontier;								//cells reached in the last layer
+	vector<size_t> layer;									//cells reached in this layer
+	vector<size_t> exitCells(exits.size());
+	Location loc;
+
+	moves.assign(entries.size() * exits.size(), UNREACHABLE);
+
+	//The board with a border of closed cells, so a neighbor is always a fixed offset away
+	for (loc.row = 0; loc.row < gb.GetHeight(); loc.row++)
+	{
+		for (loc.col = 0; loc.col < gb.GetLength(); loc.col++)
+		{
+			if (gb.IsOpen(loc))
+				open[size_t(loc.row + 1) * width + loc.col + 1] = 1;
+		}
+	}
+
+	for (size_t x = 0; x < exits.size(); x++)
+		exitCells[x] = size_t(exits[x].cell.row + 1) * width + exits[x].cell.col + 1;
+
+	for (size_t first = 0; first < entries.size(); first += DOOR_LANES)
+	{
+		size_t lanes = min(entries.size() - first, size_t(DOOR_LANES));
+		int distance = 0;
+
+		fill(reached.begin(), reached.end(), 0);
+		fill(fresh.begin(), fresh.end(), 0);
+		frontier.clear();
+
+		//Each entry of the group starts at its own cell, on its own bit
+		for (size_t lane = 0; lane < lanes; lane++)
+		{
+			size_t cell = size_t(entries[first + lane].cell.row + 1) * width + entries[first + lane].cell.col + 1;
+
+			if (open[cell] == 0)
+				continue;
+
+			if (fresh[cell] == 0)
+				frontier.push_back(cell);
+			fresh[cell] |= 1ULL << lane;
+			reached[cell] |= 1ULL << lane;
+
+		}//end for
+
+		while (!frontier.empty())
+		{
+			//An exit's cell newly reached by an entry is as far from it as this layer
+			for (size_t x = 0; x < exits.size(); x++)
+			{
+				for (unsigned long long bits = fresh[exitCells[x]]; bits != 0; bits &= bits - 1)
+				{
+					size_t lane = size_t(CountTrailingZeros(bits));
+					moves[(first + lane) * exits.size() + x] = distance;
+				}
+
+			}//end for
+
+			//Every entry that reached a cell in the last layer reaches its open neighbors in this one,
+			//unless it has been there before
+			layer.clear();
+			for (size_t i = 0; i < frontier.size(); i++)
+			{
+				size_t cell = frontier[i];
+
+				for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+				{
+					size_t neighbor = size_t(cell + offset[dir]);
+					unsigned long long bits = fresh[cell] & ~reached[neighbor];
+
+					if (open[neighbor] == 0 || bits == 0)
+						continue;
+
+					if (next[neighbor] == 0)
+						layer.push_back(neighbor);
+					next[neighbor] |= bits;
+
+				}//end for
+
+			}//end for
+
+			for (size_t i = 0; i < frontier.size(); i++)
+				fresh[frontier[i]] = 0;
+
+			for (size_t i = 0; i < layer.size(); i++)
+			{
+				fresh[layer[i]] = next[layer[i]];
+				reached[layer[i]] |= next[layer[i]];
+				next[layer[i]] = 0;
+			}
+
+			frontier.swap(layer);
+			distance++;
+
+		}//end while
+
+	}//end for
+
+}//end DoorDistances
@@ -0,0 +1,100 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Doors.h
+Purpose: Provides the specification for the doors of a maze. A maze may declare any number of entry and
+			exit doors instead of entering at the top left from the north and leaving at the bottom
+			right to the south; each door is a cell on the edge of the maze and the side of the maze it
+			opens onto. The fewest moves between every entry and every exit are found in a single
+			breadth first search: each cell holds a 64 bit word whose bit e is set once entry e has
+			reached it, so one pass over the maze spreads every entry at once, and the layer in which
+			an exit's cell first gets bit e is the distance from entry e to it.
+*/
+
+#ifndef DOORS_H
+#define DOORS_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include <string>				//Door lines
+#include <vector>				//Doors and distances
+
+using namespace std;
+
+//int constants
+const int DOOR_LANES = 64;				//Entries searched together, one to each bit of a cell's word
+
+//A door of the maze
+struct Door
+{
+	Location cell;				//cell on the edge of the maze
+	Direction side;				//side of the maze the door opens onto
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool ReadSide(const string &name, Direction &side);
+	Given: the name of a side
+		-> returns true with side holding it if it names one, false otherwise
+
+bool IsOnEdge(const Door &door, int height, int length);
+	Given: a door and the size of the board
+		-> returns true if the door's cell is on the edge of the board its side opens onto
+
+string DoorName(const Door &door);
+	Returns the cell and side of a door, "row col SIDE"
+
+string EntryLine(const Door &door);
+	Returns the entry line of a path entering through door
+
+string ExitLine(const Door &door);
+	Returns the exit line of a path leaving through door
+
+void DoorDistances(Board &gb, const vector<Door> &entries, const vector<Door> &exits, vector<int> &moves);
+	Given: a board and its entry and exit doors
+		-> moves holds the fewest movements from every entry to every exit
+*/
+
+
+//pre: none
+//post: if name is NORTH_STR, SOUTH_STR, EAST_STR or WEST_STR, side holds that direction and true has
+//		been returned to the caller. Otherwise false has been returned
+/*out*/bool ReadSide(							//boolean value returned to the caller
+				/*in*/const string &name,		//name of a side
+				/*out*/Direction &side);		//side named
+
+//pre: height and length are greater than zero
+//post: true has been returned to the caller if door's cell is within the board and on the edge its
+//		side opens onto, false otherwise
+/*out*/bool IsOnEdge(							//boolean value returned to the caller
+				/*in*/const Door &door,			//door to check
+				/*in*/int height,				//height of the board
+				/*in*/int length);				//length of the board
+
+//pre: none
+//post: the cell and side of door, "row col SIDE", have been returned to the caller
+/*out*/string DoorName(/*in*/const Door &door);	//door to name
+
+//pre: none
+//post: the entry line of a path entering through door has been returned to the caller
+/*out*/string EntryLine(/*in*/const Door &door);	//door entered by
+
+//pre: none
+//post: the exit line of a path leaving through door, ending with END_PATH, has been returned to
+//		the caller
+/*out*/string ExitLine(/*in*/const Door &door);		//door left by
+
+//pre: gb is a valid gameboard, every door is within its bounds
+//post: moves holds, for every entry e and exit x, the fewest movements from e to x over the open
+//		cells of gb at moves[e * exits.size() + x], or UNREACHABLE. The entries are searched
+//		DOOR_LANES at a time
+void DoorDistances(	/*in*/Board &gb,						//board to search
+					/*in*/const vector<Door> &entries,		//entry doors
+					/*in*/const vector<Door> &exits,		//exit doors
+					/*out*/vector<int> &moves);				//movements between each pair
+
+#endif
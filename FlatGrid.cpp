@@ -0,0 +1,363 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: FlatGrid.cpp
+Purpose: Provides the implementation of a flat grid.
+*/
+
+#include "FlatGrid.h"
+#include "Direction.h"			//Direction string literals
+#include <algorithm>			//swap
+#include <fstream>				//Grid files
+#include <sstream>				//Reading the size line
+
+using namespace std;
+
+//String constants
+const string DIMENSION_STR = "DIMENSION ";		//Step along a dimension past the levels
+const string FORWARD_STR = " FORWARD";			//Step forward along it
+const string BACK_STR = " BACK";				//Step back along it
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int ReadCoords(istream &in, vector<int> &coords);
+	Reads a coordinate for each dimension, returns how many were read
+*/
+
+
+//pre: in is a valid input stream, coords holds a coordinate for each dimension
+//post: as many coordinates as could be read, up to coords.size(), have been read into coords and
+//		their number returned to the caller
+static /*out*/int ReadCoords(					//coordinates read
+				/*inout*/istream &in,			//stream to read from
+				/*inout*/vector<int> &coords)	//coordinate along each dimension
+{
+	int read = 0;
+
+	while (read < int(coords.size()) && in >> coords[read])
+		read++;
+
+	return read;
+
+}//end ReadCoords
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: An empty grid with no dimensions and no cells has been created, ready for Load
+FlatGrid::FlatGrid()
+{
+	for (int i = 0; i < 2 * MAX_GRID_DIMS; i++)
+		offset[i] = 0;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: dims holds from 1 to MAX_GRID_DIMS sizes, each greater than zero: the rows, the cols, the
+//		levels and then any more
+//post: A grid of that size with every cell open has been created
+FlatGrid::FlatGrid(/*in*/const vector<int> &inDims)	//size along each dimension
+{
+	dims = inDims;
+	Setup();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard
+//post: A two dimensional grid with the open cells of gb has been created. Its cells are numbered
+//		as the exhaustive search numbers the cells of gb
+FlatGrid::FlatGrid(/*in*/Board &gb)				//board to copy
+{
+	Location loc;
+
+	dims.push_back(gb.GetHeight());
+	dims.push_back(gb.GetLength());
+	Setup();
+
+	for (loc.row = 0; loc.row < gb.GetHeight(); loc.row++)
+	{
+		for (loc.col = 0; loc.col < gb.GetLength(); loc.col++)
+		{
+			if (!gb.IsOpen(loc))
+				open[size_t(loc.row + 1) * stride[0] + loc.col + 1] = 0;
+		}
+	}
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: dims holds from 1 to MAX_GRID_DIMS sizes, each greater than zero
+//post: the grid has been laid out for dims, every cell open and no portals
+void FlatGrid::Setup()
+{
+	int numDims = int(dims.size());
+	size_t cells = 1;
+	vector<int> coords(numDims, 0);
+	size_t cell;
+
+	//The cols are next to each other, then the rows, so a level is laid out as a board is, then
+	//the levels and any further dimensions, each a whole block of the ones before it further on
+	stride.assign(numDims, 0);
+	for (int i = 0; i < numDims; i++)
+	{
+		int dim = numDims == 1 ? 0 : i == 0 ? 1 : i == 1 ? 0 : i;
+
+		stride[dim] = cells;
+		cells *= size_t(dims[dim]) + 2;
+	}
+
+	for (int i = 0; i < 2 * MAX_GRID_DIMS; i++)
+		offset[i] = 0;
+
+	for (int dim = 0; dim < numDims; dim++)
+	{
+		offset[dim] = (long long)stride[dim];
+		offset[numDims + dim] = -(long long)stride[dim];
+	}
+
+	//Every cell off the border is open
+	open.assign(cells, 0);
+	for (;;)
+	{
+		CellOf(coords, cell);
+		open[cell] = 1;
+
+		int dim = 0;
+		while (dim < numDims && ++coords[dim] == dims[dim])
+			coords[dim++] = 0;
+
+		if (dim == numDims)
+			break;
+
+	}//end for
+
+	firstPortal.clear();
+	nextPortal.clear();
+	portalTarget.clear();
+
+}//end Setup
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: if fileName is a grid file, a line reading GRID_HEADER and the length, height and then
+//		the size along each further dimension, followed by the walls as lines of row, col and
+//		the further coordinates, and optionally by a line reading PORTAL_HEADER and lines of
+//		the coordinates of the two cells each portal joins both ways, the grid holds it and true
+//		is returned. Otherwise false is returned and the grid is unchanged
+/*out*/bool FlatGrid::Load(/*in*/const string &fileName)	//grid file to read
+{
+	ifstream indat(fileName.c_str());
+	string header;				//section header
+	string line;				//size line
+	vector<int> fileDims;		//size along each dimension
+	vector<int> coords;			//coordinates of a wall, or of the cell a portal is taken from
+	vector<int> target;			//coordinates of the cell a portal leads to
+	size_t cell, to;
+	int size;
+	int read;
+
+	if (!(indat >> header) || header != GRID_HEADER || !getline(indat, line))
+		return false;
+
+	istringstream sizes(line);
+	while (sizes >> size)
+		fileDims.push_back(size);
+
+	if (!sizes.eof() || fileDims.size() < 2 || fileDims.size() > size_t(MAX_GRID_DIMS))
+		return false;
+
+	for (size_t i = 0; i < fileDims.size(); i++)
+	{
+		if (fileDims[i] <= 0)
+			return false;
+	}
+
+	//The length comes before the height, as in a maze file
+	swap(fileDims[0], fileDims[1]);
+
+	FlatGrid grid(fileDims);
+	coords.resize(fileDims.size());
+	target.resize(fileDims.size());
+
+	while ((read = ReadCoords(indat, coords)) == int(coords.size()))
+	{
+		if (!grid.CellOf(coords, cell))
+			return false;
+
+		grid.SetOpen(cell, false);
+
+	}//end walls
+
+	//Something other than a coordinate, the walls have ended
+	if (read != 0)
+		return false;
+
+	if (!indat.eof())
+	{
+		indat.clear();
+		if (!(indat >> header) || header != PORTAL_HEADER)
+			return false;
+
+		while ((read = ReadCoords(indat, coords)) == int(coords.size()))
+		{
+			if (ReadCoords(indat, target) != int(target.size()) || !grid.CellOf(coords, cell) ||
+				!grid.CellOf(target, to))
+				return false;
+
+			grid.AddPortal(cell, to);
+			grid.AddPortal(to, cell);
+
+		}//end portals
+
+		if (read != 0 || !indat.eof())
+			return false;
+
+	}//end portal section
+
+	*this = grid;
+	return true;
+
+}//end Load
+
+
+/***************************************************************************************************/
+
+
+//pre: coords holds a coordinate for each dimension
+//post: if every coordinate is on the grid, cell holds the cell at them and true is returned to
+//		the caller. Otherwise false is returned
+/*out*/bool FlatGrid::CellOf(	/*in*/const vector<int> &coords,	//coordinate along each dimension
+								/*out*/size_t &cell) const			//cell at the coordinates
+{
+	cell = 0;
+	for (size_t dim = 0; dim < dims.size(); dim++)
+	{
+		if (coords[dim] < 0 || coords[dim] >= dims[dim])
+			return false;
+
+		cell += size_t(coords[dim] + 1) * stride[dim];
+	}
+
+	return true;
+
+}//end CellOf
+
+
+/***************************************************************************************************/
+
+
+//pre: cell is a cell of the grid, not of its border
+//post: coords holds the coordinate of cell along each dimension
+void FlatGrid::CoordsOf(	/*in*/size_t cell,				//cell to look up
+							/*out*/vector<int> &coords) const	//coordinate along each dimension
+{
+	coords.resize(dims.size());
+	for (size_t dim = 0; dim < dims.size(); dim++)
+		coords[dim] = int(cell / stride[dim] % (size_t(dims[dim]) + 2)) - 1;
+
+}//end CoordsOf
+
+
+/***************************************************************************************************/
+
+
+//pre: cell is a cell of the grid, not of its border
+//post: the cell is open if open is true, and a wall otherwise
+void FlatGrid::SetOpen(	/*in*/size_t cell,			//cell to change
+						/*in*/bool isOpen)			//desired boolean value for the cell
+{
+	open[cell] = isOpen ? 1 : 0;
+
+}//end SetOpen
+
+
+/***************************************************************************************************/
+
+
+//pre: from and to are cells of the grid, not of its border
+//post: a path at from may move straight to to, after the portals added from it before
+void FlatGrid::AddPortal(	/*in*/size_t from,			//cell the portal is taken from
+							/*in*/size_t to)			//cell the portal leads to
+{
+	int portal = int(portalTarget.size());
+
+	//Only a grid with portals pays for a portal list of every cell
+	if (firstPortal.empty())
+		firstPortal.assign(open.size(), NO_PORTAL);
+
+	portalTarget.push_back(to);
+	nextPortal.push_back(NO_PORTAL);
+
+	//Portals are taken in the order they were added
+	if (firstPortal[from] == NO_PORTAL)
+		firstPortal[from] = portal;
+	else
+	{
+		int last = firstPortal[from];
+
+		while (nextPortal[last] != NO_PORTAL)
+			last = nextPortal[last];
+		nextPortal[last] = portal;
+	}
+
+}//end AddPortal
+
+
+/***************************************************************************************************/
+
+
+//pre: move is less than GetNumSteps(), or GetNumSteps() plus a portal of the grid
+//post: the name of the movement has been returned to the caller: the direction names along the
+//		rows and cols, UP_STR and DOWN_STR along the levels, the dimension and a sign after them,
+//		and PORTAL_STR and the coordinates it leads to for a portal
+/*out*/string FlatGrid::MoveName(/*in*/int move) const	//movement to name
+{
+	int numDims = int(dims.size());
+	int dim = move % numDims;
+	bool forward = move < numDims;
+
+	if (move >= 2 * numDims)
+	{
+		vector<int> coords;
+		string name = PORTAL_STR;
+
+		CoordsOf(portalTarget[move - 2 * numDims], coords);
+		for (size_t i = 0; i < coords.size(); i++)
+			name += " " + to_string(coords[i]);
+
+		return name;
+
+	}//end portal
+
+	switch (dim)
+	{
+	case 0:
+		return forward ? SOUTH_STR : NORTH_STR;
+
+	case 1:
+		return forward ? EAST_STR : WEST_STR;
+
+	case 2:
+		return forward ? UP_STR : DOWN_STR;
+
+	default:
+		return DIMENSION_STR + to_string(dim) + (forward ? FORWARD_STR : BACK_STR);
+
+	}//end switch
+
+}//end MoveName
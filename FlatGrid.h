@@ -0,0 +1,308 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: FlatGrid.h
+Purpose: Provides the specification for a FlatGrid. A flat grid is a maze of any number of dimensions,
+			such as the floors of a building stacked one above the other, held as a single array of
+			cells with a border of closed cells on every side. The cells are numbered as the board's
+			are, (row+1)*width+(col+1), with each further dimension a whole layer of them further on,
+			so a step along any dimension is a fixed offset from a table and a search never works out
+			a coordinate. A two dimensional grid is laid out exactly as the exhaustive search lays out
+			a board. Cells may also be joined by portals, such as stairs and lifts, which are taken as
+			a movement of their own after the steps.
+*/
+
+#ifndef FLATGRID_H
+#define FLATGRID_H
+
+#include "Board.h"				//For use of a board
+#include <string>				//File names, movement names
+#include <vector>				//Cells, portals
+
+using namespace std;
+
+//int constants
+const int MAX_GRID_DIMS = 8;				//Most dimensions of a grid
+const int NO_PORTAL = -1;					//Portal of a cell without one, or after its last
+
+//String constants
+const string GRID_HEADER = "GRID";			//First word of a grid file
+const string PORTAL_HEADER = "PORTAL";		//Starts the portals of a grid file
+const string UP_STR = "UP";					//Step to the next level
+const string DOWN_STR = "DOWN";				//Step to the level before
+const string PORTAL_STR = "PORTAL TO";		//Movement through a portal
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+FlatGrid();
+	Creates a new, empty FlatGrid with no cells
+
+FlatGrid(const vector<int> &dims);
+	Creates a new FlatGrid of the given size along each dimension, every cell open
+
+FlatGrid(Board &gb);
+	Creates a new two dimensional FlatGrid with the open cells of gb
+
+bool Load(const string &fileName);
+	Replaces the grid with the one in a grid file, returns false if it could not be read
+
+bool CellOf(const vector<int> &coords, size_t &cell) const;
+	Finds the cell at the given coordinates, returns false if they are off the grid
+
+void CoordsOf(size_t cell, vector<int> &coords) const;
+	Finds the coordinates of a cell
+
+void SetOpen(size_t cell, bool open);
+	Opens or closes a cell
+
+bool IsOpen(size_t cell) const;
+	Returns true if the cell is open
+
+void AddPortal(size_t from, size_t to);
+	Adds a portal taking a path from one cell to another
+
+int GetNumDims() const;
+	Returns the number of dimensions
+
+int GetDim(int dim) const;
+	Returns the size of the grid along a dimension
+
+size_t GetNumCells() const;
+	Returns the number of cells, the border included
+
+int GetNumSteps() const;
+	Returns the number of steps from a cell, two along each dimension
+
+const long long* GetOffsets() const;
+	Returns the change of cell taking each step
+
+const unsigned char* GetOpen() const;
+	Returns the open value of every cell
+
+bool HasPortals() const;
+	Returns true if any portal has been added
+
+int GetNumPortals() const;
+	Returns the number of portals, numbered from 0 in the order they were added
+
+int FirstPortal(size_t cell) const;
+	Returns the first portal from a cell, NO_PORTAL for none
+
+int NextPortal(int portal) const;
+	Returns the portal after the given one from the same cell, NO_PORTAL for none
+
+size_t PortalTarget(int portal) const;
+	Returns the cell a portal leads to
+
+string MoveName(int move) const;
+	Returns the name of a step or portal movement
+*/
+
+class FlatGrid
+{
+
+	public:
+
+		//pre: none
+		//post: An empty grid with no dimensions and no cells has been created, ready for Load
+		FlatGrid();
+
+		/***************************************************************************************************/
+
+		//pre: dims holds from 1 to MAX_GRID_DIMS sizes, each greater than zero: the rows, the cols, the
+		//		levels and then any more
+		//post: A grid of that size with every cell open has been created
+		FlatGrid(/*in*/const vector<int> &dims);	//size along each dimension
+
+		/***************************************************************************************************/
+
+		//pre: gb is a valid gameboard
+		//post: A two dimensional grid with the open cells of gb has been created. Its cells are numbered
+		//		as the exhaustive search numbers the cells of gb
+		FlatGrid(/*in*/Board &gb);					//board to copy
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: if fileName is a grid file, a line reading GRID_HEADER and the length, height and then
+		//		the size along each further dimension, followed by the walls as lines of row, col and
+		//		the further coordinates, and optionally by a line reading PORTAL_HEADER and lines of
+		//		the coordinates of the two cells each portal joins both ways, the grid holds it and true
+		//		is returned. Otherwise false is returned and the grid is unchanged
+		/*out*/bool Load(							//boolean value returned to the caller
+					/*in*/const string &fileName);	//grid file to read
+
+		/***************************************************************************************************/
+
+		//pre: coords holds a coordinate for each dimension
+		//post: if every coordinate is on the grid, cell holds the cell at them and true is returned to
+		//		the caller. Otherwise false is returned
+		/*out*/bool CellOf(							//boolean value returned to the caller
+					/*in*/const vector<int> &coords,	//coordinate along each dimension
+					/*out*/size_t &cell) const;		//cell at the coordinates
+
+		/***************************************************************************************************/
+
+		//pre: cell is a cell of the grid, not of its border
+		//post: coords holds the coordinate of cell along each dimension
+		void CoordsOf(	/*in*/size_t cell,				//cell to look up
+						/*out*/vector<int> &coords) const;	//coordinate along each dimension
+
+		/***************************************************************************************************/
+
+		//pre: cell is a cell of the grid, not of its border
+		//post: the cell is open if open is true, and a wall otherwise
+		void SetOpen(	/*in*/size_t cell,			//cell to change
+						/*in*/bool open);			//desired boolean value for the cell
+
+		/***************************************************************************************************/
+
+		//pre: cell is less than GetNumCells()
+		//post: true has been returned to the caller if the cell is open, false if it is a wall or border
+		/*out*/bool IsOpen(/*in*/size_t cell) const	//cell to look up
+		{
+			return open[cell] != 0;
+		}
+
+		/***************************************************************************************************/
+
+		//pre: from and to are cells of the grid, not of its border
+		//post: a path at from may move straight to to, after the portals added from it before
+		void AddPortal(	/*in*/size_t from,			//cell the portal is taken from
+						/*in*/size_t to);			//cell the portal leads to
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the number of dimensions has been returned to the caller
+		/*out*/int GetNumDims() const				//dimensions returned to the caller
+		{
+			return int(dims.size());
+		}
+
+		/***************************************************************************************************/
+
+		//pre: dim is less than GetNumDims()
+		//post: the size of the grid along dim, without the border, has been returned to the caller
+		/*out*/int GetDim(/*in*/int dim) const		//dimension to look up
+		{
+			return dims[dim];
+		}
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the number of cells, the border included, has been returned to the caller
+		/*out*/size_t GetNumCells() const			//cells returned to the caller
+		{
+			return open.size();
+		}
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the number of steps from a cell, two along each dimension, has been returned to the caller
+		/*out*/int GetNumSteps() const				//steps returned to the caller
+		{
+			return 2 * int(dims.size());
+		}
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the change of cell taking each step has been returned to the caller. The steps forward
+		//		along each dimension in turn come first, then the steps back: for two dimensions south,
+		//		east, north and west, the order the exhaustive search tries them in
+		/*out*/const long long* GetOffsets() const	//offsets returned to the caller
+		{
+			return offset;
+		}
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the open value of every cell, 1 for open and 0 for a wall or border, has been returned
+		/*out*/const unsigned char* GetOpen() const	//open values returned to the caller
+		{
+			return open.empty() ? nullptr : &open[0];
+		}
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: true has been returned to the caller if any portal has been added, false otherwise
+		/*out*/bool HasPortals() const				//boolean value returned to the caller
+		{
+			return !firstPortal.empty();
+		}
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the number of portals has been returned to the caller. They are numbered from 0 in the
+		//		order they were added
+		/*out*/int GetNumPortals() const			//portals returned to the caller
+		{
+			return int(portalTarget.size());
+		}
+
+		/***************************************************************************************************/
+
+		//pre: HasPortals(), cell is less than GetNumCells()
+		//post: the first portal from cell has been returned to the caller, NO_PORTAL if there is none
+		/*out*/int FirstPortal(/*in*/size_t cell) const	//cell to look up
+		{
+			return firstPortal[cell];
+		}
+
+		/***************************************************************************************************/
+
+		//pre: portal is a portal of the grid
+		//post: the next portal from the same cell has been returned to the caller, NO_PORTAL if there is none
+		/*out*/int NextPortal(/*in*/int portal) const	//portal to look up
+		{
+			return nextPortal[portal];
+		}
+
+		/***************************************************************************************************/
+
+		//pre: portal is a portal of the grid
+		//post: the cell the portal leads to has been returned to the caller
+		/*out*/size_t PortalTarget(/*in*/int portal) const	//portal to look up
+		{
+			return portalTarget[portal];
+		}
+
+		/***************************************************************************************************/
+
+		//pre: move is less than GetNumSteps(), or GetNumSteps() plus a portal of the grid
+		//post: the name of the movement has been returned to the caller: the direction names along the
+		//		rows and cols, UP_STR and DOWN_STR along the levels, the dimension and a sign after them,
+		//		and PORTAL_STR and the coordinates it leads to for a portal
+		/*out*/string MoveName(/*in*/int move) const;	//movement to name
+
+		/***************************************************************************************************/
+
+	private:
+
+		//pre: dims holds from 1 to MAX_GRID_DIMS sizes, each greater than zero
+		//post: the grid has been laid out for dims, every cell open and no portals
+		void Setup();
+
+		/***************************************************************************************************/
+
+		//PDM's
+
+		vector<int> dims;				//size along each dimension, without the border
+		vector<size_t> stride;			//change of cell moving one along each dimension
+		vector<unsigned char> open;		//1 for each open cell, 0 for walls and the border
+		long long offset[2 * MAX_GRID_DIMS];	//change of cell taking each step
+		vector<int> firstPortal;		//first portal from each cell, empty while there are none
+		vector<int> nextPortal;			//next portal from the same cell as each portal
+		vector<size_t> portalTarget;	//cell each portal leads to
+};
+
+#endif
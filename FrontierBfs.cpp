@@ -0,0 +1,468 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: FrontierBfs.cpp
+Purpose: Provides the implementation of the bit-parallel breadth first search.
+*/
+
+#include "FrontierBfs.h"
+#include "Direction.h"			//Number of movements
+#include <algorithm>			//min, max
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FRONTIER_HAS_AVX2
+#define FRONTIER_AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define FRONTIER_HAS_AVX2
+#define FRONTIER_AVX2_TARGET
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+//int constants
+const int DENSE_FRONTIER_SHARE = 2;		//A layer is grown row by row once its frontier holds at least one
+										//word in this many of the rows it can reach
+
+//Grows one row of the frontier: next = (above | below | row shifted east and west) & unreached, and the
+//cells of next are taken out of unreached. Returns nonzero if any cell was added
+typedef unsigned long long (*ExpandRowFn)(const unsigned long long *above, const unsigned long long *row,
+										const unsigned long long *below, unsigned long long *unreached,
+										unsigned long long *next, int words);
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+unsigned long long ExpandRowScalar(...);
+	Grows one row of the frontier a word at a time
+
+unsigned long long ExpandRowAvx2(...);
+	Grows one row of the frontier a 256 bit block at a time
+
+int RunFrontier(const BitBoard &bb, Location source, const Location *target, vector<int> *distance,
+				FrontierKernel kernel);
+	Searches from source one layer at a time until target (if not null) is reached or the frontier is
+	empty, recording distances if distance is not null
+*/
+
+
+//pre: every pointer holds words valid words
+//post: next holds the cells added to the frontier, which have been taken out of unreached. Nonzero
+//		is returned if any cell was added
+static /*out*/unsigned long long ExpandRowScalar(	//nonzero if the row grew
+				/*in*/const unsigned long long *above,	//frontier of the row above
+				/*in*/const unsigned long long *row,	//frontier of this row
+				/*in*/const unsigned long long *below,	//frontier of the row below
+				/*inout*/unsigned long long *unreached,	//open cells of this row not yet reached
+				/*out*/unsigned long long *next,		//next frontier of this row
+				/*in*/int words)						//words in the row
+{
+	unsigned long long any = 0;			//union of every word added
+	unsigned long long carry = 0;		//top bit of the previous word, moving east
+
+	for (int w = 0; w < words; w++)
+	{
+		unsigned long long cur = row[w];
+		unsigned long long east = (cur << 1) | carry;
+		unsigned long long west = (cur >> 1) | ((w + 1 < words) ? (row[w + 1] << 63) : 0);
+		unsigned long long grown = (above[w] | below[w] | east | west) & unreached[w];
+
+		carry = cur >> 63;
+		next[w] = grown;
+		unreached[w] &= ~grown;
+		any |= grown;
+
+	}//end for
+
+	return any;
+
+}//end ExpandRowScalar
+
+
+/***************************************************************************************************/
+
+
+#ifdef FRONTIER_HAS_AVX2
+
+//pre: every pointer holds words valid words, words is a multiple of BLOCK_WORDS
+//post: next holds the cells added to the frontier, which have been taken out of unreached. Nonzero
+//		is returned if any cell was added
+FRONTIER_AVX2_TARGET
+static /*out*/unsigned long long ExpandRowAvx2(	//nonzero if the row grew
+				/*in*/const unsigned long long *above,	//frontier of the row above
+				/*in*/const unsigned long long *row,	//frontier of this row
+				/*in*/const unsigned long long *below,	//frontier of the row below
+				/*inout*/unsigned long long *unreached,	//open cells of this row not yet reached
+				/*out*/unsigned long long *next,		//next frontier of this row
+				/*in*/int words)						//words in the row
+{
+	__m256i any = _mm256_setzero_si256();		//union of every block added
+	unsigned long long prevTop = 0;				//highest word of the previous block
+
+	for (int w = 0; w < words; w += BLOCK_WORDS)
+	{
+		__m256i cur = _mm256_loadu_si256((const __m256i*)(row + w));
+		long long nextLow = (w + BLOCK_WORDS < words) ? (long long)row[w + BLOCK_WORDS] : 0;
+
+		//Word to the west of each word, [prevTop, w0, w1, w2], and to the east, [w1, w2, w3, nextLow]
+		__m256i lower = _mm256_permute4x64_epi64(cur, _MM_SHUFFLE(2, 1, 0, 3));
+		__m256i upper = _mm256_permute4x64_epi64(cur, _MM_SHUFFLE(0, 3, 2, 1));
+		lower = _mm256_blend_epi32(lower, _mm256_set1_epi64x((long long)prevTop), 0x03);
+		upper = _mm256_blend_epi32(upper, _mm256_set1_epi64x(nextLow), 0xC0);
+
+		__m256i east = _mm256_or_si256(_mm256_slli_epi64(cur, 1), _mm256_srli_epi64(lower, 63));
+		__m256i west = _mm256_or_si256(_mm256_srli_epi64(cur, 1), _mm256_slli_epi64(upper, 63));
+		__m256i vert = _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(above + w)),
+									_mm256_loadu_si256((const __m256i*)(below + w)));
+		__m256i left = _mm256_loadu_si256((const __m256i*)(unreached + w));
+		__m256i grown = _mm256_and_si256(_mm256_or_si256(vert, _mm256_or_si256(east, west)), left);
+
+		_mm256_storeu_si256((__m256i*)(next + w), grown);
+		_mm256_storeu_si256((__m256i*)(unreached + w), _mm256_andnot_si256(grown, left));
+		any = _mm256_or_si256(any, grown);
+		prevTop = row[w + BLOCK_WORDS - 1];
+
+	}//end for
+
+	return _mm256_testz_si256(any, any) ? 0 : 1;
+
+}//end ExpandRowAvx2
+
+#endif
+
+
+/***************************************************************************************************/
+
+
+//pre: distance holds a cell for every cell of a board of the given length, bits is a word of row row
+//		at word index word
+//post: every cell of bits has been given distance level
+static inline void RecordWord(	/*inout*/vector<int> &distance,	//distance to each cell
+								/*in*/int length,				//length of the board
+								/*in*/int row,					//row of the word
+								/*in*/int word,					//index of the word in its row
+								/*in*/unsigned long long bits,	//cells added
+								/*in*/int level)				//distance of the cells added
+{
+	int *cells = &distance[size_t(row) * length + size_t(word) * WORD_BITS];
+
+	for (; bits != 0; bits &= bits - 1)
+		cells[CountTrailingZeros(bits)] = level;
+
+}//end RecordWord
+
+
+/***************************************************************************************************/
+
+
+//pre: source is a valid location within the bounds of bb, kernel is supported
+//post: the board has been searched from source one layer at a time until target (if not null) was
+//		reached or the frontier emptied. If distance is not null it holds the distance to every cell.
+//		Returns the number of layers searched, or -1 if target was not reached
+static /*out*/int RunFrontier(						//number of layers
+				/*in*/const BitBoard &bb,			//board to search
+				/*in*/Location source,				//starting location
+				/*in*/const Location *target,		//location to stop at, may be null
+				/*out*/vector<int> *distance,		//distance to each cell, may be null
+				/*in*/FrontierKernel kernel)		//row expansion to use
+{
+	int height = bb.GetHeight();			//height of the board
+	int length = bb.GetLength();			//length of the board
+	int words = bb.GetRowWords();			//words in each row
+	int stride = words + 2;					//words in each row with a closed word on either side
+	int level = 0;							//distance of the current frontier
+	int first, last;						//lowest and highest word of the current frontier
+	ExpandRowFn expand = ExpandRowScalar;	//row expansion
+	size_t targetWord = 0;					//word of unreached holding target
+	unsigned long long targetBit = 0;		//bit of that word
+
+	//Every array has a closed row above and below the board and a closed word either side of each
+	//row, so the words around any word of the board can be read without checking the edges
+	size_t padded = size_t(height + 2) * stride;
+	vector<unsigned long long> unreached(padded, 0);	//open cells not yet reached
+	vector<unsigned long long> frontier(padded, 0);
+	vector<unsigned long long> next(padded, 0);
+	vector<int> current, added;				//words of the current and next frontier
+
+#ifdef FRONTIER_HAS_AVX2
+	if (kernel == KERNEL_AVX2)
+		expand = ExpandRowAvx2;
+#endif
+
+	if (distance != nullptr)
+		distance->assign(size_t(height) * length, UNREACHABLE);
+
+	//Source is the target
+	if (target != nullptr && target->row == source.row && target->col == source.col)
+		return 1;
+
+	//Source is not available
+	if (!bb.IsOpen(source))
+		return (target != nullptr) ? -1 : 0;
+
+	//A closed target is never reached
+	if (target != nullptr && !bb.IsOpen(*target))
+		return -1;
+
+	for (int r = 0; r < height; r++)
+		copy(bb.Row(r), bb.Row(r) + words, unreached.begin() + size_t(r + 1) * stride + 1);
+
+	first = last = (source.row + 1) * stride + 1 + source.col / WORD_BITS;
+	frontier[first] = 1ULL << (source.col % WORD_BITS);
+	unreached[first] &= ~frontier[first];
+	current.push_back(first);
+
+	if (distance != nullptr)
+		(*distance)[size_t(source.row) * length + source.col] = 0;
+
+	if (target != nullptr)
+	{
+		targetWord = size_t(target->row + 1) * stride + 1 + target->col / WORD_BITS;
+		targetBit = 1ULL << (target->col % WORD_BITS);
+
+	}//end if
+
+	while (!current.empty())
+	{
+		int lo = max(first / stride - 1, 1);		//first row that can grow
+		int hi = min(last / stride + 1, height);	//last row that can grow
+		level++;
+		added.clear();
+		first = int(padded);
+		last = -1;
+
+		//A frontier spread over the rows it spans is grown a whole row at a time
+		if (current.size() * DENSE_FRONTIER_SHARE >= size_t(hi - lo + 1) * words)
+		{
+			for (int r = lo; r <= hi; r++)
+			{
+				size_t base = size_t(r) * stride + 1;
+
+				if (expand(&frontier[base - stride], &frontier[base], &frontier[base + stride], &unreached[base],
+						   &next[base], words) == 0)
+					continue;
+
+				for (int w = 0; w < words; w++)
+				{
+					if (next[base + w] == 0)
+						continue;
+
+					added.push_back(int(base) + w);
+					if (distance != nullptr)
+						RecordWord(*distance, length, r - 1, w, next[base + w], level);
+				}
+
+			}//end for
+
+		}//end dense layer
+
+		//Otherwise only the words of the frontier and the words around them can grow
+		else
+		{
+			const int around[5] = {0, -1, 1, -stride, stride};	//a word and its neighbours
+
+			for (size_t i = 0; i < current.size(); i++)
+			{
+				for (int k = 0; k < 5; k++)
+				{
+					int w = current[i] + around[k];
+					unsigned long long cur = frontier[w];
+					unsigned long long cells = unreached[w];	//cells the word may still gain
+
+					//A closed word, such as the border, or one already reached is never grown. A word
+					//tried again in the same layer has nothing left to gain, so it is not added twice
+					if (cells == 0)
+						continue;
+
+					cells &= frontier[w - stride] | frontier[w + stride] | (cur << 1) | (frontier[w - 1] >> 63) |
+							 (cur >> 1) | (frontier[w + 1] << 63);
+					if (cells == 0)
+						continue;
+
+					unreached[w] &= ~cells;
+					next[w] = cells;
+					added.push_back(w);
+					if (distance != nullptr)
+						RecordWord(*distance, length, w / stride - 1, w % stride - 1, cells, level);
+
+				}//end for
+
+			}//end for
+
+		}//end sparse layer
+
+		for (size_t i = 0; i < added.size(); i++)
+		{
+			first = min(first, added[i]);
+			last = max(last, added[i]);
+		}
+
+		if (target != nullptr && (unreached[targetWord] & targetBit) == 0)
+			return level + 1;
+
+		//Clear the old frontier and make the new one current
+		for (size_t i = 0; i < current.size(); i++)
+			frontier[current[i]] = 0;
+
+		frontier.swap(next);
+		current.swap(added);
+
+	}//end while
+
+	return (target != nullptr) ? -1 : level;
+
+}//end RunFrontier
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the fastest kernel supported by the processor has been returned to the caller
+/*out*/FrontierKernel SelectFrontierKernel()			//kernel returned to the caller
+{
+	if (IsKernelSupported(KERNEL_AVX2))
+		return KERNEL_AVX2;
+
+	return KERNEL_SCALAR;
+
+}//end SelectFrontierKernel
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns true if the processor can run the given kernel, false otherwise
+/*out*/bool IsKernelSupported(							//boolean value returned to the caller
+				/*in*/FrontierKernel kernel)			//kernel to check
+{
+	if (kernel == KERNEL_SCALAR)
+		return true;
+
+#if defined(FRONTIER_HAS_AVX2) && defined(__GNUC__)
+	return __builtin_cpu_supports("avx2") != 0;
+#elif defined(FRONTIER_HAS_AVX2)
+	int info[4];
+
+	//The processor must have AVX2, and the operating system must save the 256 bit registers
+	__cpuid(info, 1);
+	if ((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 0x6) != 0x6)
+		return false;
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return false;
+#endif
+
+}//end IsKernelSupported
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: a printable name for the given kernel has been returned to the caller
+/*out*/const char* KernelName(							//name returned to the caller
+				/*in*/FrontierKernel kernel)			//kernel to name
+{
+	return (kernel == KERNEL_AVX2) ? "avx2" : "scalar";
+
+}//end KernelName
+
+
+/***************************************************************************************************/
+
+
+//pre: entry and exit are valid locations within the bounds of bb, kernel is supported
+//post: returns true if exit can be reached from entry through open cells, false otherwise
+/*out*/bool IsExitReachable(							//boolean value returned to the caller
+				/*in*/const BitBoard &bb,				//board to search
+				/*in*/Location entry,					//starting location
+				/*in*/Location exit,					//location to reach
+				/*in*/FrontierKernel kernel)			//row expansion to use
+{
+	return RunFrontier(bb, entry, &exit, nullptr, kernel) > 0;
+
+}//end IsExitReachable
+
+
+/***************************************************************************************************/
+
+
+//pre: source is a valid location within the bounds of bb, kernel is supported
+//post: distance holds, for every cell (row*length+col), the number of movements needed to reach it
+//		from source, or UNREACHABLE. The number of layers (largest distance plus one) is returned
+/*out*/int ComputeDistanceLayers(						//number of layers
+				/*in*/const BitBoard &bb,				//board to search
+				/*in*/Location source,					//starting location
+				/*out*/vector<int> &distance,			//distance to each cell
+				/*in*/FrontierKernel kernel)			//row expansion to use
+{
+	return RunFrontier(bb, source, nullptr, &distance, kernel);
+
+}//end ComputeDistanceLayers
+
+
+/***************************************************************************************************/
+
+
+//pre: source is a valid location within the bounds of gb
+//post: same as ComputeDistanceLayers, computed one cell at a time
+/*out*/int FloodFillDistances(							//number of layers
+				/*in*/Board &gb,						//board to search
+				/*in*/Location source,					//starting location
+				/*out*/vector<int> &distance)			//distance to each cell
+{
+	const int ROW_STEP[NUM_DIRECTIONS] = {1, 0, -1, 0};	//row change moving south, east, north, west
+	const int COL_STEP[NUM_DIRECTIONS] = {0, 1, 0, -1};	//col change moving south, east, north, west
+	int height = gb.GetHeight();					//height of the board
+	int length = gb.GetLength();					//length of the board
+	int layers = 0;									//largest distance plus one
+	vector<int> queue;								//cells waiting to be expanded
+	size_t head = 0;								//next cell in queue
+	Location loc, next;								//current and neighboring cell
+
+	distance.assign(size_t(height) * length, UNREACHABLE);
+
+	if (!gb.IsOpen(source))
+		return 0;
+
+	distance[size_t(source.row) * length + source.col] = 0;
+	queue.push_back(source.row * length + source.col);
+
+	while (head < queue.size())
+	{
+		int cell = queue[head++];
+		loc.row = cell / length;
+		loc.col = cell % length;
+		layers = distance[cell] + 1;
+
+		for (int d = 0; d < NUM_DIRECTIONS; d++)
+		{
+			next.row = loc.row + ROW_STEP[d];
+			next.col = loc.col + COL_STEP[d];
+
+			if (next.row < 0 || next.row >= height || next.col < 0 || next.col >= length)
+				continue;
+
+			int index = next.row * length + next.col;
+			if (distance[index] == UNREACHABLE && gb.IsOpen(next))
+			{
+				distance[index] = distance[cell] + 1;
+				queue.push_back(index);
+
+			}//end if
+
+		}//end for
+
+	}//end while
+
+	return layers;
+
+}//end FloodFillDistances
@@ -0,0 +1,102 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: FrontierBfs.h
+Purpose: Provides the specification for a bit-parallel breadth first search over a BitBoard. Instead of
+			expanding one cell at a time, the whole frontier is grown at once: north and south are the
+			rows above and below, east and west are one bit shifts of the row. A sparse frontier is grown
+			only at the words it holds and their neighbours; a dense one is grown a whole row at a time,
+			a 256 bit block at a time with AVX2 when the processor supports it, or a word at a time otherwise.
+*/
+
+#ifndef FRONTIERBFS_H
+#define FRONTIERBFS_H
+
+#include "BitBoard.h"			//Bit-packed board
+#include "Board.h"				//For use of a board
+#include "Location.h"			//Location struct
+#include <vector>				//Distance field
+
+using namespace std;
+
+//Row expansion used by the frontier search
+enum FrontierKernel {KERNEL_SCALAR, KERNEL_AVX2};
+
+//Distance of a cell that cannot be reached
+const int UNREACHABLE = -1;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+FrontierKernel SelectFrontierKernel();
+	Returns the fastest kernel supported by the processor
+
+bool IsKernelSupported(FrontierKernel kernel);
+	Returns true if the processor can run the given kernel
+
+const char* KernelName(FrontierKernel kernel);
+	Returns a printable name for the given kernel
+
+bool IsExitReachable(const BitBoard &bb, Location entry, Location exit, FrontierKernel kernel);
+	Returns true if exit can be reached from entry through open cells
+
+int ComputeDistanceLayers(const BitBoard &bb, Location source, vector<int> &distance, FrontierKernel kernel);
+	Fills distance (row*length+col) with the number of movements from source to each cell, or
+	UNREACHABLE. Returns the number of layers (largest distance plus one)
+
+int FloodFillDistances(Board &gb, Location source, vector<int> &distance);
+	Same as ComputeDistanceLayers, one cell at a time over the board. Used as a reference
+*/
+
+
+//pre: none
+//post: the fastest kernel supported by the processor has been returned to the caller
+/*out*/FrontierKernel SelectFrontierKernel();		//kernel returned to the caller
+
+/***************************************************************************************************/
+
+//pre: none
+//post: returns true if the processor can run the given kernel, false otherwise
+/*out*/bool IsKernelSupported(						//boolean value returned to the caller
+				/*in*/FrontierKernel kernel);		//kernel to check
+
+/***************************************************************************************************/
+
+//pre: none
+//post: a printable name for the given kernel has been returned to the caller
+/*out*/const char* KernelName(						//name returned to the caller
+				/*in*/FrontierKernel kernel);		//kernel to name
+
+/***************************************************************************************************/
+
+//pre: entry and exit are valid locations within the bounds of bb, kernel is supported
+//post: returns true if exit can be reached from entry through open cells, false otherwise
+/*out*/bool IsExitReachable(						//boolean value returned to the caller
+				/*in*/const BitBoard &bb,			//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*in*/FrontierKernel kernel);		//row expansion to use
+
+/***************************************************************************************************/
+
+//pre: source is a valid location within the bounds of bb, kernel is supported
+//post: distance holds, for every cell (row*length+col), the number of movements needed to reach it
+//		from source, or UNREACHABLE. The number of layers (largest distance plus one) is returned
+/*out*/int ComputeDistanceLayers(					//number of layers
+				/*in*/const BitBoard &bb,			//board to search
+				/*in*/Location source,				//starting location
+				/*out*/vector<int> &distance,		//distance to each cell
+				/*in*/FrontierKernel kernel);		//row expansion to use
+
+/***************************************************************************************************/
+
+//pre: source is a valid location within the bounds of gb
+//post: same as ComputeDistanceLayers, computed one cell at a time
+/*out*/int FloodFillDistances(						//number of layers
+				/*in*/Board &gb,					//board to search
+				/*in*/Location source,				//starting location
+				/*out*/vector<int> &distance);		//distance to each cell
+
+#endif
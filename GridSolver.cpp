@@ -0,0 +1,321 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: GridSolver.cpp
+Purpose: Provides the implementation of the solvers of a flat grid.
+*/
+
+#include "GridSolver.h"
+#include <algorithm>			//reverse
+
+using namespace std;
+
+//int constants
+const int NOT_REACHED = -1;				//Movement into a cell the search has not reached
+
+
+//pre: entry and exit are cells of grid, not of its border
+//post: if the exit can be reached from the entry, moves holds the movements of a shortest path
+//		from the entry to the exit and true is returned to the caller, otherwise false is returned
+/*out*/bool GridShortestPath(						//boolean value returned to the caller
+				/*in*/const FlatGrid &grid,			//grid to search
+				/*in*/size_t entry,					//starting cell
+				/*in*/size_t exit,					//cell to reach
+				/*out*/vector<int> &moves)			//movements of the path
+{
+	const unsigned char *open = grid.GetOpen();
+	const long long *offset = grid.GetOffsets();
+	int numSteps = grid.GetNumSteps();
+	vector<int> via(grid.GetNumCells(), NOT_REACHED);	//movement into each cell reached
+	vector<size_t> from(grid.GetNumCells());			//cell each cell was reached from
+	vector<size_t> queue;								//cells reached, in the order they were
+	size_t head = 0;
+
+	moves.clear();
+	if (open[entry] == 0 || open[exit] == 0)
+		return false;
+
+	//The entry is marked as reached, it is never walked back from
+	via[entry] = numSteps;
+	queue.push_back(entry);
+
+	while (head < queue.size() && via[exit] == NOT_REACHED)
+	{
+		size_t cell = queue[head++];
+
+		for (int step = 0; step < numSteps; step++)
+		{
+			size_t next = size_t(cell + offset[step]);
+
+			if (open[next] != 0 && via[next] == NOT_REACHED)
+			{
+				via[next] = step;
+				from[next] = cell;
+				queue.push_back(next);
+			}
+
+		}//end for
+
+		if (!grid.HasPortals())
+			continue;
+
+		for (int portal = grid.FirstPortal(cell); portal != NO_PORTAL; portal = grid.NextPortal(portal))
+		{
+			size_t next = grid.PortalTarget(portal);
+
+			if (open[next] != 0 && via[next] == NOT_REACHED)
+			{
+				via[next] = numSteps + portal;
+				from[next] = cell;
+				queue.push_back(next);
+			}
+
+		}//end for
+
+	}//end while
+
+	if (via[exit] == NOT_REACHED)
+		return false;
+
+	//Walk back from the exit to the entry, then turn the movements around
+	for (size_t cell = exit; cell != entry; cell = from[cell])
+		moves.push_back(via[cell]);
+
+	reverse(moves.begin(), moves.end());
+	return true;
+
+}//end GridShortestPath
+
+
+/***************************************************************************************************/
+
+
+//pre: entry and exit are cells of grid, not of its border
+//post: An enumerator for every path from entry to exit has been created. The grid is not
+//		modified or referenced after construction
+GridEnumerator::GridEnumerator(	/*in*/const FlatGrid &grid,	//grid to search
+								/*in*/size_t entry,			//starting cell
+								/*in*/size_t exit)			//cell to reach
+{
+	open.assign(grid.GetOpen(), grid.GetOpen() + grid.GetNumCells());
+	numSteps = grid.GetNumSteps();
+	for (int step = 0; step < 2 * MAX_GRID_DIMS; step++)
+		offset[step] = grid.GetOffsets()[step];
+
+	//Only a grid with portals pays for looking them up
+	if (grid.HasPortals())
+	{
+		firstPortal.resize(grid.GetNumCells());
+		for (size_t cell = 0; cell < firstPortal.size(); cell++)
+			firstPortal[cell] = grid.FirstPortal(cell);
+
+		for (int portal = 0; portal < grid.GetNumPortals(); portal++)
+		{
+			portalAfter.push_back(grid.NextPortal(portal));
+			portalTarget.push_back(grid.PortalTarget(portal));
+		}
+
+	}//end portals
+
+	entryCell = entry;
+	exitCell = exit;
+	depth = -1;
+	numMoves = 0;
+	nodes = 0;
+	pauseInterval = 0;
+	untilPause = 0;
+	cancelToken = nullptr;
+	started = false;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: GridEnumerator has been initialized
+//post: the search has carried on until the next solution (SEARCH_SOLUTION), until the pause
+//		interval has passed (SEARCH_PAUSED) or until every path has been found (SEARCH_DONE).
+//		The steps of a cell are tried in the grid's order, then its portals
+/*out*/SearchStatus GridEnumerator::Next()			//why the search stopped
+{
+	if (!started)
+	{
+		started = true;
+
+		//Entry point is the exit point, the only path is no movement at all
+		if (entryCell == exitCell)
+		{
+			numMoves = 0;
+			return SEARCH_SOLUTION;
+
+		}//end single cell path
+
+		//Entry point is not available
+		if (open[entryCell] == 0)
+			return SEARCH_DONE;
+
+		open[entryCell] = 0;
+		cells.assign(1, entryCell);
+		nextStep.assign(1, 0);
+		nextPortal.assign(1, firstPortal.empty() ? NO_PORTAL : firstPortal[entryCell]);
+		moves.resize(1);
+		depth = 0;
+		nodes = 1;
+
+	}//end start
+
+	while (depth >= 0)
+	{
+		int move = nextStep[depth];
+		size_t next;
+
+		//The steps come first, as offsets from the table, then the portals of the cell
+		if (move < numSteps)
+		{
+			nextStep[depth] = move + 1;
+			next = size_t(cells[depth] + offset[move]);
+		}
+		else if (nextPortal[depth] != NO_PORTAL)
+		{
+			int portal = nextPortal[depth];
+
+			nextPortal[depth] = portalAfter[portal];
+			move = numSteps + portal;
+			next = portalTarget[portal];
+		}
+
+		//No possible movements, set the space as open, backtrack
+		else
+		{
+			open[cells[depth]] = 1;
+			depth--;
+			continue;
+
+		}//end backtrack
+
+		//If we are at the exit point, we have a solution
+		if (next == exitCell)
+		{
+			moves[depth] = move;
+			numMoves = depth + 1;
+			return SEARCH_SOLUTION;
+
+		}//end solution
+
+		//If the space is available, move to it
+		if (open[next] != 0)
+		{
+			open[next] = 0;
+			moves[depth] = move;
+			depth++;
+
+			if (depth == int(cells.size()))
+			{
+				cells.push_back(next);
+				nextStep.push_back(0);
+				nextPortal.push_back(NO_PORTAL);
+				moves.push_back(0);
+			}
+			else
+			{
+				cells[depth] = next;
+				nextStep[depth] = 0;
+			}
+
+			nextPortal[depth] = firstPortal.empty() ? NO_PORTAL : firstPortal[next];
+			nodes++;
+
+			if (pauseInterval > 0 && --untilPause == 0)
+			{
+				untilPause = pauseInterval;
+				return SEARCH_PAUSED;
+
+			}//end pause
+
+			//Another thread or a signal asked the search to stop
+			if (cancelToken != nullptr && cancelToken->IsCancelled())
+				return SEARCH_PAUSED;
+
+		}//end move
+
+	}//end while
+
+	return SEARCH_DONE;
+
+}//end Next
+
+
+/***************************************************************************************************/
+
+
+//pre: nodes is not negative
+//post: Next returns SEARCH_PAUSED after every nodes expanded cells. Zero never pauses
+void GridEnumerator::SetPauseInterval(/*in*/long long inNodes)	//expanded cells between pauses
+{
+	pauseInterval = inNodes;
+	untilPause = inNodes;
+
+}//end SetPauseInterval
+
+
+/***************************************************************************************************/
+
+
+//pre: token is null or lives as long as the search
+//post: Next returns SEARCH_PAUSED after any expanded cell once token has been cancelled.
+//		Null never cancels
+void GridEnumerator::SetCancelToken(/*in*/const CancelToken *token)	//token to look at
+{
+	cancelToken = token;
+
+}//end SetCancelToken
+
+
+/***************************************************************************************************/
+
+
+//pre: Next returned SEARCH_SOLUTION
+//post: the movements of the path have been returned to the caller. They are valid until
+//		the next call to Next
+/*out*/const int* GridEnumerator::GetMoves() const	//movements from the entry cell
+{
+	return moves.empty() ? nullptr : &moves[0];
+
+}//end GetMoves
+
+
+/***************************************************************************************************/
+
+
+//pre: Next returned SEARCH_SOLUTION
+//post: the number of movements in the path has been returned to the caller
+/*out*/int GridEnumerator::GetNumMoves() const		//number of movements
+{
+	return numMoves;
+
+}//end GetNumMoves
+
+
+/***************************************************************************************************/
+
+
+//pre: GridEnumerator has been initialized
+//post: the number of cells expanded so far has been returned to the caller
+/*out*/long long GridEnumerator::GetNodes() const	//cells expanded
+{
+	return nodes;
+
+}//end GetNodes
+
+
+/***************************************************************************************************/
+
+
+//pre: GridEnumerator has been initialized
+//post: the number of cells on the current path has been returned to the caller
+/*out*/int GridEnumerator::GetDepth() const			//cells on the path
+{
+	return depth + 1;
+
+}//end GetDepth
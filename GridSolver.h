@@ -0,0 +1,152 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: GridSolver.h
+Purpose: Provides the specification for the solvers of a FlatGrid: a breadth first search for a shortest
+			path, and a GridEnumerator that finds every path as a PathEnumerator does on a board, with
+			the same calls. Both move by adding an offset from the grid's table to the current cell,
+			whatever the number of dimensions, and take a cell's portals after its steps. A movement
+			is the number of a step, or the number of steps plus the number of a portal, which the
+			grid can name.
+*/
+
+#ifndef GRIDSOLVER_H
+#define GRIDSOLVER_H
+
+#include "FlatGrid.h"			//Grids of any dimensions
+#include "PathEnumerator.h"		//SearchStatus
+#include "SearchBudget.h"		//Cancel token
+#include <vector>				//Path movements, frames
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool GridShortestPath(const FlatGrid &grid, size_t entry, size_t exit, vector<int> &moves);
+	Given: a grid and an entry and exit cell
+		-> finds the movements of a shortest path from the entry to the exit, returns false if there is none
+
+GridEnumerator(const FlatGrid &grid, size_t entry, size_t exit);
+	Creates a new GridEnumerator for every path from entry to exit on grid
+
+SearchStatus Next();
+	Carries on the search until the next solution, a pause, or the end
+
+void SetPauseInterval(long long nodes);
+	Makes Next return SEARCH_PAUSED after every nodes expanded cells. Zero never pauses
+
+void SetCancelToken(const CancelToken *token);
+	Makes Next return SEARCH_PAUSED once token has been cancelled
+
+const int* GetMoves() const;
+	Returns the movements of the current solution
+
+int GetNumMoves() const;
+	Returns the number of movements in the current solution
+
+long long GetNodes() const;
+	Returns the number of cells expanded so far
+
+int GetDepth() const;
+	Returns the number of cells on the current path
+*/
+
+
+//pre: entry and exit are cells of grid, not of its border
+//post: if the exit can be reached from the entry, moves holds the movements of a shortest path
+//		from the entry to the exit and true is returned to the caller, otherwise false is returned
+/*out*/bool GridShortestPath(						//boolean value returned to the caller
+				/*in*/const FlatGrid &grid,			//grid to search
+				/*in*/size_t entry,					//starting cell
+				/*in*/size_t exit,					//cell to reach
+				/*out*/vector<int> &moves);			//movements of the path
+
+/***************************************************************************************************/
+
+class GridEnumerator
+{
+
+	public:
+
+		//pre: entry and exit are cells of grid, not of its border
+		//post: An enumerator for every path from entry to exit has been created. The grid is not
+		//		modified or referenced after construction
+		GridEnumerator(	/*in*/const FlatGrid &grid,	//grid to search
+						/*in*/size_t entry,			//starting cell
+						/*in*/size_t exit);			//cell to reach
+
+		/***************************************************************************************************/
+
+		//pre: GridEnumerator has been initialized
+		//post: the search has carried on until the next solution (SEARCH_SOLUTION), until the pause
+		//		interval has passed (SEARCH_PAUSED) or until every path has been found (SEARCH_DONE).
+		//		The steps of a cell are tried in the grid's order, then its portals
+		/*out*/SearchStatus Next();					//why the search stopped
+
+		/***************************************************************************************************/
+
+		//pre: nodes is not negative
+		//post: Next returns SEARCH_PAUSED after every nodes expanded cells. Zero never pauses
+		void SetPauseInterval(/*in*/long long nodes);	//expanded cells between pauses
+
+		/***************************************************************************************************/
+
+		//pre: token is null or lives as long as the search
+		//post: Next returns SEARCH_PAUSED after any expanded cell once token has been cancelled.
+		//		Null never cancels
+		void SetCancelToken(/*in*/const CancelToken *token);	//token to look at
+
+		/***************************************************************************************************/
+
+		//pre: Next returned SEARCH_SOLUTION
+		//post: the movements of the path have been returned to the caller. They are valid until
+		//		the next call to Next
+		/*out*/const int* GetMoves() const;		//movements from the entry cell
+
+		/***************************************************************************************************/
+
+		//pre: Next returned SEARCH_SOLUTION
+		//post: the number of movements in the path has been returned to the caller
+		/*out*/int GetNumMoves() const;				//number of movements
+
+		/***************************************************************************************************/
+
+		//pre: GridEnumerator has been initialized
+		//post: the number of cells expanded so far has been returned to the caller
+		/*out*/long long GetNodes() const;			//cells expanded
+
+		/***************************************************************************************************/
+
+		//pre: GridEnumerator has been initialized
+		//post: the number of cells on the current path has been returned to the caller
+		/*out*/int GetDepth() const;				//cells on the path
+
+		/***************************************************************************************************/
+
+	private:
+
+		vector<unsigned char> open;		//open cells not on the current path
+		vector<size_t> cells;			//cell of each frame
+		vector<int> nextStep;			//next step to try from each frame
+		vector<int> nextPortal;			//next portal to try from each frame once its steps are done
+		vector<int> moves;				//movement out of each frame
+		vector<int> firstPortal;		//first portal from each cell, empty for a grid without portals
+		vector<int> portalAfter;		//next portal from the same cell as each portal
+		vector<size_t> portalTarget;	//cell each portal leads to
+		long long offset[2 * MAX_GRID_DIMS];	//change of cell taking each step
+		int numSteps;					//steps from a cell
+		size_t entryCell;				//cell of the entry point
+		size_t exitCell;				//cell of the exit point
+		int depth;						//index of the top frame, -1 once the search is over
+		int numMoves;					//movements in the current solution
+		long long nodes;				//cells expanded so far
+		long long pauseInterval;		//expanded cells between pauses
+		long long untilPause;			//expanded cells left before the next pause
+		const CancelToken *cancelToken;	//token that stops the search, null for none
+		bool started;					//Next has been called
+};
+
+#endif
@@ -0,0 +1,763 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: HpaGraph.cpp
+Purpose: Provides the implementation of the abstract graph of hierarchical pathfinding.
+*/
+
+#include "HpaGraph.h"
+#include <algorithm>			//find, reverse
+#include <cstdlib>				//abs
+#include <fstream>				//Graph files
+#include <functional>			//greater
+#include <queue>				//Open list
+
+using namespace std;
+
+//Movements are attempted south, east, north, west, respectively
+const Direction HPA_ORDER[NUM_DIRECTIONS] = {SOUTH, EAST, NORTH, WEST};
+const int ROW_STEP[NUM_DIRECTIONS] = {1, 0, -1, 0};			//row change of each movement
+const int COL_STEP[NUM_DIRECTIONS] = {0, 1, 0, -1};			//col change of each movement
+
+//Graph file identification
+const unsigned int HPA_MAGIC = 0x4150485A;		//"ZHPA"
+const unsigned int HPA_VERSION = 1;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void WriteValue(ostream &out, T value);
+	Writes the bytes of value to out
+
+bool ReadValue(istream &in, T &value);
+	Reads the bytes of value from in, returns false if the stream ran out
+*/
+
+
+//pre: out is a valid binary output stream
+//post: the bytes of value have been written to out
+template <class T>
+static void WriteValue(	/*inout*/ostream &out,		//stream to write to
+						/*in*/T value)				//value to write
+{
+	out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: in is a valid binary input stream
+//post: value has been read from in. Returns true if the stream held enough bytes
+template <class T>
+static /*out*/bool ReadValue(		//boolean value returned to the caller
+				/*inout*/istream &in,	//stream to read from
+				/*out*/T &value)		//value read
+{
+	in.read(reinterpret_cast<char*>(&value), sizeof(T));
+	return in.good();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: clusterSize is greater than zero
+//post: An empty graph with clusters of clusterSize x clusterSize cells has been created
+HpaGraph::HpaGraph(/*in*/int inClusterSize)		//rows and cols of cells in a cluster
+{
+	clusterSize = inClusterSize;
+	clusterRows = 0;
+	clusterCols = 0;
+	height = 0;
+	length = 0;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized
+//post: the graph holds the entrances and cluster distances of gb
+void HpaGraph::Build(/*in*/Board &gb)			//board to build the graph of
+{
+	Reset(gb);
+
+	for (int border = 0; border < int(borderNodes.size()); border++)
+		BuildBorder(gb, border);
+
+	for (int cluster = 0; cluster < int(clusterNodes.size()); cluster++)
+		BuildCluster(gb, cluster);
+
+}//end Build
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized
+//post: if fileName holds a graph saved from a board with the same walls and clusters of the
+//		same size, the graph holds it and true is returned to the caller. Otherwise false is
+//		returned and the graph is unchanged
+/*out*/bool HpaGraph::Load(							//boolean value returned to the caller
+					/*in*/const string &fileName,	//graph file
+					/*in*/Board &gb)				//board the graph must be of
+{
+	ifstream indat(fileName.c_str(), ios::in | ios::binary);
+	unsigned int magic, version;
+	unsigned long long hash;
+	int savedHeight, savedLength, savedSize, numNodes;
+
+	if (!ReadValue(indat, magic) || !ReadValue(indat, version) || !ReadValue(indat, hash) ||
+		!ReadValue(indat, savedHeight) || !ReadValue(indat, savedLength) ||
+		!ReadValue(indat, savedSize) || !ReadValue(indat, numNodes))
+		return false;
+
+	if (magic != HPA_MAGIC || version != HPA_VERSION || savedHeight != gb.GetHeight() ||
+		savedLength != gb.GetLength() || savedSize != clusterSize || numNodes < 0 || hash != gb.Hash())
+		return false;
+
+	HpaGraph loaded(clusterSize);
+	loaded.Reset(gb);
+	loaded.nodes.resize(numNodes);
+
+	for (int i = 0; i < numNodes; i++)
+	{
+		HpaNode &node = loaded.nodes[i];
+		int numEdges;
+
+		if (!ReadValue(indat, node.loc.row) || !ReadValue(indat, node.loc.col) ||
+			!ReadValue(indat, node.border) || !ReadValue(indat, numEdges) ||
+			node.loc.row < 0 || node.loc.row >= savedHeight || node.loc.col < 0 ||
+			node.loc.col >= savedLength || node.border < 0 ||
+			node.border >= int(loaded.borderNodes.size()) || numEdges < 0 || numEdges > numNodes)
+			return false;
+
+		node.cluster = loaded.ClusterOf(node.loc);
+		node.alive = true;
+		node.edges.resize(numEdges);
+
+		for (int j = 0; j < numEdges; j++)
+		{
+			if (!ReadValue(indat, node.edges[j].to) || !ReadValue(indat, node.edges[j].cost) ||
+				node.edges[j].to < 0 || node.edges[j].to >= numNodes)
+				return false;
+		}
+
+		loaded.clusterNodes[node.cluster].push_back(i);
+		loaded.borderNodes[node.border].push_back(i);
+
+	}//end for
+
+	*this = loaded;
+	return true;
+
+}//end Load
+
+
+/***************************************************************************************************/
+
+
+//pre: the graph is of gb
+//post: the graph has been written to fileName. Returns true to the caller if it could be
+//		written, false otherwise
+/*out*/bool HpaGraph::Save(							//boolean value returned to the caller
+					/*in*/const string &fileName,	//graph file
+					/*in*/Board &gb) const			//board the graph is of
+{
+	ofstream outdat(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+	vector<int> number(nodes.size(), -1);
+	int numNodes = 0;
+
+	//Free nodes are left out, so the live ones are numbered again
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		if (nodes[i].alive)
+			number[i] = numNodes++;
+	}
+
+	WriteValue(outdat, HPA_MAGIC);
+	WriteValue(outdat, HPA_VERSION);
+	WriteValue(outdat, gb.Hash());
+	WriteValue(outdat, height);
+	WriteValue(outdat, length);
+	WriteValue(outdat, clusterSize);
+	WriteValue(outdat, numNodes);
+
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		if (!nodes[i].alive)
+			continue;
+
+		WriteValue(outdat, nodes[i].loc.row);
+		WriteValue(outdat, nodes[i].loc.col);
+		WriteValue(outdat, nodes[i].border);
+		WriteValue(outdat, int(nodes[i].edges.size()));
+
+		for (size_t j = 0; j < nodes[i].edges.size(); j++)
+		{
+			WriteValue(outdat, number[nodes[i].edges[j].to]);
+			WriteValue(outdat, nodes[i].edges[j].cost);
+		}
+
+	}//end for
+
+	outdat.close();
+	return !outdat.fail();
+
+}//end Save
+
+
+/***************************************************************************************************/
+
+
+//pre: the graph is of gb, loc is within gb
+//post: the location's open value has been set and the graph rebuilt for the cluster holding
+//		it and the clusters sharing a border with it, so the graph is of gb again
+void HpaGraph::SetOpen(	/*inout*/Board &gb,			//board the graph is of
+						/*in*/Location loc,			//location to change
+						/*in*/bool open)			//desired open value
+{
+	int cluster = ClusterOf(loc);
+	int row = cluster / clusterCols;
+	int col = cluster % clusterCols;
+	vector<int> touched(1, cluster);
+
+	gb.SetOpen(loc, open);
+
+	//Borders east and south belong to this cluster, west and north to the neighbors
+	if (col + 1 < clusterCols)
+	{
+		BuildBorder(gb, 2 * cluster);
+		touched.push_back(cluster + 1);
+	}
+	if (row + 1 < clusterRows)
+	{
+		BuildBorder(gb, 2 * cluster + 1);
+		touched.push_back(cluster + clusterCols);
+	}
+	if (col > 0)
+	{
+		BuildBorder(gb, 2 * (cluster - 1));
+		touched.push_back(cluster - 1);
+	}
+	if (row > 0)
+	{
+		BuildBorder(gb, 2 * (cluster - clusterCols) + 1);
+		touched.push_back(cluster - clusterCols);
+	}
+
+	for (size_t i = 0; i < touched.size(); i++)
+		BuildCluster(gb, touched[i]);
+
+}//end SetOpen
+
+
+/***************************************************************************************************/
+
+
+//pre: the graph is of gb, start and goal are within gb
+//post: if the graph joins start to goal, moves holds the movements of a path between them and
+//		true is returned to the caller. Otherwise false is returned
+/*out*/bool HpaGraph::FindPath(						//boolean value returned to the caller
+					/*in*/Board &gb,				//board the graph is of
+					/*in*/Location start,			//starting location
+					/*in*/Location goal,			//location to reach
+					/*out*/vector<Direction> &moves)	//movements of the path
+{
+	typedef pair<long long, int> OpenEntry;				//estimated cost through a node, and the node
+	priority_queue<OpenEntry, vector<OpenEntry>, greater<OpenEntry> > openList;
+	vector<int> distance;
+	int startCluster = ClusterOf(start);
+	int goalCluster = ClusterOf(goal);
+	bool found = false;
+
+	moves.clear();
+
+	if (!gb.IsOpen(start) || !gb.IsOpen(goal))
+		return false;
+
+	if (start.row == goal.row && start.col == goal.col)
+		return true;
+
+	//Join the start and goal to the entrances of their clusters for the length of the query
+	int source = AddNode(start, startCluster, -1);
+	int target = AddNode(goal, goalCluster, -1);
+
+	ClusterDistances(gb, startCluster, start, distance);
+	for (size_t i = 0; i < clusterNodes[startCluster].size(); i++)
+	{
+		int node = clusterNodes[startCluster][i];
+		int d = distance[(nodes[node].loc.row - (startCluster / clusterCols) * clusterSize) * clusterSize +
+						 nodes[node].loc.col - (startCluster % clusterCols) * clusterSize];
+		if (d >= 0)
+			nodes[source].edges.push_back(HpaEdge{node, d});
+	}
+
+	if (startCluster == goalCluster)
+	{
+		int d = distance[(goal.row - (goalCluster / clusterCols) * clusterSize) * clusterSize +
+						 goal.col - (goalCluster % clusterCols) * clusterSize];
+		if (d >= 0)
+			nodes[source].edges.push_back(HpaEdge{target, d});
+	}
+
+	ClusterDistances(gb, goalCluster, goal, distance);
+	for (size_t i = 0; i < clusterNodes[goalCluster].size(); i++)
+	{
+		int node = clusterNodes[goalCluster][i];
+		int d = distance[(nodes[node].loc.row - (goalCluster / clusterCols) * clusterSize) * clusterSize +
+						 nodes[node].loc.col - (goalCluster % clusterCols) * clusterSize];
+		if (d >= 0)
+			nodes[node].edges.push_back(HpaEdge{target, d});
+	}
+
+	//A* over the abstract graph, estimating by the grid distance to the goal
+	vector<long long> cost(nodes.size(), -1);
+	vector<int> parent(nodes.size(), -1);
+	vector<char> closed(nodes.size(), 0);
+
+	cost[source] = 0;
+	openList.push(OpenEntry(abs(start.row - goal.row) + abs(start.col - goal.col), source));
+
+	while (!openList.empty())
+	{
+		int node = openList.top().second;
+		openList.pop();
+
+		if (closed[node])
+			continue;
+		closed[node] = 1;
+
+		if (node == target)
+		{
+			found = true;
+			break;
+		}
+
+		for (size_t i = 0; i < nodes[node].edges.size(); i++)
+		{
+			const HpaEdge &edge = nodes[node].edges[i];
+			long long next = cost[node] + edge.cost;
+
+			if (cost[edge.to] < 0 || next < cost[edge.to])
+			{
+				cost[edge.to] = next;
+				parent[edge.to] = node;
+				openList.push(OpenEntry(next + abs(nodes[edge.to].loc.row - goal.row) +
+											abs(nodes[edge.to].loc.col - goal.col), edge.to));
+			}
+
+		}//end for
+
+	}//end while
+
+	//Fill in only the steps of the path found, a cluster crossing at a time
+	if (found)
+	{
+		vector<int> path;
+
+		for (int node = target; node != -1; node = parent[node])
+			path.push_back(node);
+		reverse(path.begin(), path.end());
+
+		for (size_t i = 0; i + 1 < path.size(); i++)
+		{
+			const HpaNode &from = nodes[path[i]];
+			const HpaNode &to = nodes[path[i + 1]];
+
+			if (from.cluster == to.cluster)
+				ClusterPath(gb, from.cluster, from.loc, to.loc, moves);
+			else
+			{
+				for (int d = 0; d < NUM_DIRECTIONS; d++)
+				{
+					if (from.loc.row + ROW_STEP[d] == to.loc.row && from.loc.col + COL_STEP[d] == to.loc.col)
+						moves.push_back(HPA_ORDER[d]);
+				}
+
+			}//end entrance step
+
+		}//end for
+
+	}//end path
+
+	//Take the start and goal back out
+	for (size_t i = 0; i < clusterNodes[goalCluster].size(); i++)
+	{
+		vector<HpaEdge> &edges = nodes[clusterNodes[goalCluster][i]].edges;
+
+		if (!edges.empty() && edges.back().to == target)
+			edges.pop_back();
+	}
+
+	RemoveNode(target);
+	RemoveNode(source);
+	return found;
+
+}//end FindPath
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of nodes in the graph
+/*out*/int HpaGraph::GetNumNodes() const			//number of nodes
+{
+	return int(nodes.size() - freeNodes.size());
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of edges in the graph, counting each direction
+/*out*/long long HpaGraph::GetNumEdges() const		//number of edges
+{
+	long long count = 0;
+
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		if (nodes[i].alive)
+			count += (long long)nodes[i].edges.size();
+	}
+
+	return count;
+
+}//end GetNumEdges
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized
+//post: the graph is empty and sized for gb
+void HpaGraph::Reset(/*in*/Board &gb)			//board to size the graph for
+{
+	height = gb.GetHeight();
+	length = gb.GetLength();
+	clusterRows = (height + clusterSize - 1) / clusterSize;
+	clusterCols = (length + clusterSize - 1) / clusterSize;
+
+	nodes.clear();
+	freeNodes.clear();
+	clusterNodes.assign(size_t(clusterRows) * clusterCols, vector<int>());
+	borderNodes.assign(2 * size_t(clusterRows) * clusterCols, vector<int>());
+
+}//end Reset
+
+
+/***************************************************************************************************/
+
+
+//pre: the graph is sized for gb
+//post: the nodes of the border have been replaced by those of its current entrances. Border
+//		2k is between cluster k and the cluster east of it, border 2k + 1 the cluster south
+void HpaGraph::BuildBorder(	/*in*/Board &gb,		//board the graph is of
+							/*in*/int border)		//border to build
+{
+	int cluster = border / 2;
+	bool east = (border % 2 == 0);
+	int row = cluster / clusterCols;
+	int col = cluster % clusterCols;
+	int neighbor = east ? cluster + 1 : cluster + clusterCols;
+	int first, last;				//cells along the border
+	int runStart = -1;
+
+	//Drop the entrances the border had
+	for (size_t i = 0; i < borderNodes[border].size(); i++)
+		RemoveNode(borderNodes[border][i]);
+	borderNodes[border].clear();
+
+	if ((east && col + 1 >= clusterCols) || (!east && row + 1 >= clusterRows))
+		return;
+
+	if (east)
+	{
+		first = row * clusterSize;
+		last = min(height, (row + 1) * clusterSize) - 1;
+	}
+	else
+	{
+		first = col * clusterSize;
+		last = min(length, (col + 1) * clusterSize) - 1;
+	}
+
+	//Each run of cells open on both sides is an entrance
+	for (int i = first; i <= last + 1; i++)
+	{
+		Location inside, outside;
+		bool open = false;
+
+		if (i <= last)
+		{
+			inside.row = east ? i : (row + 1) * clusterSize - 1;
+			inside.col = east ? (col + 1) * clusterSize - 1 : i;
+			outside.row = inside.row + (east ? 0 : 1);
+			outside.col = inside.col + (east ? 1 : 0);
+			open = gb.IsOpen(inside) && gb.IsOpen(outside);
+		}
+
+		if (open && runStart < 0)
+			runStart = i;
+
+		if (!open && runStart >= 0)
+		{
+			int runEnd = i - 1;
+			vector<int> crossings;
+
+			//A wide entrance is crossed at either end, a narrow one in its middle
+			if (runEnd - runStart + 1 >= WIDE_ENTRANCE)
+			{
+				crossings.push_back(runStart);
+				crossings.push_back(runEnd);
+			}
+			else
+				crossings.push_back((runStart + runEnd) / 2);
+
+			for (size_t j = 0; j < crossings.size(); j++)
+			{
+				Location a, b;
+
+				a.row = east ? crossings[j] : (row + 1) * clusterSize - 1;
+				a.col = east ? (col + 1) * clusterSize - 1 : crossings[j];
+				b.row = a.row + (east ? 0 : 1);
+				b.col = a.col + (east ? 1 : 0);
+
+				int u = AddNode(a, cluster, border);
+				int v = AddNode(b, neighbor, border);
+
+				nodes[u].edges.push_back(HpaEdge{v, 1});
+				nodes[v].edges.push_back(HpaEdge{u, 1});
+				clusterNodes[cluster].push_back(u);
+				clusterNodes[neighbor].push_back(v);
+				borderNodes[border].push_back(u);
+				borderNodes[border].push_back(v);
+
+			}//end for
+
+			runStart = -1;
+
+		}//end entrance
+
+	}//end for
+
+}//end BuildBorder
+
+
+/***************************************************************************************************/
+
+
+//pre: the graph is sized for gb, the cluster's nodes are current
+//post: the edges between the cluster's nodes have been replaced by their current distances
+void HpaGraph::BuildCluster(	/*in*/Board &gb,		//board the graph is of
+								/*in*/int cluster)		//cluster to build
+{
+	const vector<int> &members = clusterNodes[cluster];
+	int top = (cluster / clusterCols) * clusterSize;
+	int left = (cluster % clusterCols) * clusterSize;
+	vector<int> distance;
+
+	for (size_t i = 0; i < members.size(); i++)
+	{
+		vector<HpaEdge> &edges = nodes[members[i]].edges;
+		size_t kept = 0;
+
+		//Keep only the step across the border, the rest are rebuilt. A border rebuilt since
+		//removed both of its ends, so a partner on the same border is still current
+		for (size_t j = 0; j < edges.size(); j++)
+		{
+			const HpaNode &to = nodes[edges[j].to];
+
+			if (to.alive && to.cluster != cluster && to.border == nodes[members[i]].border)
+				edges[kept++] = edges[j];
+		}
+		edges.resize(kept);
+
+	}//end for
+
+	for (size_t i = 0; i < members.size(); i++)
+	{
+		ClusterDistances(gb, cluster, nodes[members[i]].loc, distance);
+
+		for (size_t j = 0; j < members.size(); j++)
+		{
+			const Location &loc = nodes[members[j]].loc;
+			int d = distance[(loc.row - top) * clusterSize + loc.col - left];
+
+			if (j != i && d >= 0)
+				nodes[members[i]].edges.push_back(HpaEdge{members[j], d});
+		}
+
+	}//end for
+
+}//end BuildCluster
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: a node at loc has been added to the graph and its index returned to the caller
+/*out*/int HpaGraph::AddNode(	/*in*/Location loc,		//cell of the node
+								/*in*/int cluster,		//cluster the cell is in
+								/*in*/int border)		//border of the entrance, -1 for none
+{
+	int node;
+
+	if (!freeNodes.empty())
+	{
+		node = freeNodes.back();
+		freeNodes.pop_back();
+	}
+	else
+	{
+		node = int(nodes.size());
+		nodes.push_back(HpaNode());
+	}
+
+	nodes[node].loc = loc;
+	nodes[node].cluster = cluster;
+	nodes[node].border = border;
+	nodes[node].alive = true;
+	nodes[node].edges.clear();
+	return node;
+
+}//end AddNode
+
+
+/***************************************************************************************************/
+
+
+//pre: node is alive
+//post: the node is no longer in the graph. Edges leading to it are not removed
+void HpaGraph::RemoveNode(/*in*/int node)		//node to remove
+{
+	if (nodes[node].border >= 0)
+	{
+		vector<int> &members = clusterNodes[nodes[node].cluster];
+		members.erase(find(members.begin(), members.end(), node));
+	}
+
+	nodes[node].alive = false;
+	nodes[node].edges.clear();
+	freeNodes.push_back(node);
+
+}//end RemoveNode
+
+
+/***************************************************************************************************/
+
+
+//pre: loc is within the board the graph is sized for
+//post: returns the cluster holding loc
+/*out*/int HpaGraph::ClusterOf(/*in*/Location loc) const	//cluster of the location
+{
+	return (loc.row / clusterSize) * clusterCols + loc.col / clusterSize;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: the graph is sized for gb, source is within the cluster
+//post: distance holds the movements from source to each cell of the cluster without leaving
+//		it, or -1, indexed by (row - top) * clusterSize + (col - left)
+void HpaGraph::ClusterDistances(	/*in*/Board &gb,				//board the graph is of
+									/*in*/int cluster,				//cluster to search
+									/*in*/Location source,			//starting location
+									/*out*/vector<int> &distance) const	//distance to each cell
+{
+	int top = (cluster / clusterCols) * clusterSize;
+	int left = (cluster % clusterCols) * clusterSize;
+	int bottom = min(height, top + clusterSize);
+	int right = min(length, left + clusterSize);
+	vector<Location> queue;
+	size_t head = 0;
+
+	distance.assign(size_t(clusterSize) * clusterSize, -1);
+
+	if (!gb.IsOpen(source))
+		return;
+
+	distance[(source.row - top) * clusterSize + source.col - left] = 0;
+	queue.push_back(source);
+
+	while (head < queue.size())
+	{
+		Location loc = queue[head++];
+		int d = distance[(loc.row - top) * clusterSize + loc.col - left];
+
+		for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+		{
+			Location next;
+			next.row = loc.row + ROW_STEP[dir];
+			next.col = loc.col + COL_STEP[dir];
+
+			if (next.row < top || next.row >= bottom || next.col < left || next.col >= right)
+				continue;
+
+			int index = (next.row - top) * clusterSize + next.col - left;
+			if (distance[index] < 0 && gb.IsOpen(next))
+			{
+				distance[index] = d + 1;
+				queue.push_back(next);
+			}
+
+		}//end for
+
+	}//end while
+
+}//end ClusterDistances
+
+
+/***************************************************************************************************/
+
+
+//pre: the graph is sized for gb, from and to are cells of the cluster that reach each other
+//		without leaving it
+//post: the movements of a shortest path from from to to within the cluster have been
+//		added to moves
+void HpaGraph::ClusterPath(	/*in*/Board &gb,				//board the graph is of
+							/*in*/int cluster,				//cluster to search
+							/*in*/Location from,			//starting location
+							/*in*/Location to,				//location to reach
+							/*inout*/vector<Direction> &moves) const	//movements of the path
+{
+	int top = (cluster / clusterCols) * clusterSize;
+	int left = (cluster % clusterCols) * clusterSize;
+	int bottom = min(height, top + clusterSize);
+	int right = min(length, left + clusterSize);
+	vector<int> distance;
+	Location loc = from;
+
+	//Distances from the far end, so each step can go one closer
+	ClusterDistances(gb, cluster, to, distance);
+
+	while (loc.row != to.row || loc.col != to.col)
+	{
+		int d = distance[(loc.row - top) * clusterSize + loc.col - left];
+
+		for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+		{
+			Location next;
+			next.row = loc.row + ROW_STEP[dir];
+			next.col = loc.col + COL_STEP[dir];
+
+			if (next.row >= top && next.row < bottom && next.col >= left && next.col < right &&
+				distance[(next.row - top) * clusterSize + next.col - left] == d - 1)
+			{
+				moves.push_back(HPA_ORDER[dir]);
+				loc = next;
+				break;
+			}
+
+		}//end for
+
+	}//end while
+
+}//end ClusterPath
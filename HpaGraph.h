@@ -0,0 +1,210 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: HpaGraph.h
+Purpose: Provides the specification for an HpaGraph, the abstract graph of hierarchical pathfinding.
+			The board is cut into square clusters. Wherever two neighboring clusters have open cells
+			side by side across their border there is an entrance, a pair of nodes one on each side,
+			joined by a single step. Within a cluster every pair of nodes that can reach each other
+			without leaving it is joined by an edge costing their distance. A query searches this
+			much smaller graph and then fills in only the cluster crossings of the path it found, so
+			its paths are close to, but not always, the shortest. The graph can be saved beside the
+			maze and loaded again as long as the board has not changed, and a wall set through the
+			graph rebuilds only the clusters around it.
+*/
+
+#ifndef HPAGRAPH_H
+#define HPAGRAPH_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include <string>				//File names
+#include <vector>				//Nodes and edges
+
+using namespace std;
+
+//int constants
+const int DEFAULT_CLUSTER_SIZE = 16;		//Default rows and cols of cells in a cluster
+const int WIDE_ENTRANCE = 6;				//Entrances at least this wide get a node pair at each end
+
+//String constants
+const string HPA_CACHE_SUFFIX = ".hpa";		//Suffix of the graph file saved beside a maze
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+HpaGraph(int clusterSize);
+	Creates a new, empty HpaGraph with clusters of clusterSize x clusterSize cells
+
+void Build(Board &gb);
+	Builds the graph of gb
+
+bool Load(const string &fileName, Board &gb);
+	Loads a graph of gb saved by Save, returns false if there is none or the board has changed
+
+bool Save(const string &fileName, Board &gb) const;
+	Saves the graph, returns false if it could not be written
+
+void SetOpen(Board &gb, Location loc, bool open);
+	Sets the given location's open value and rebuilds the clusters around it
+
+bool FindPath(Board &gb, Location start, Location goal, vector<Direction> &moves);
+	Finds the movements of a path from start to goal, returns false if there is none
+
+int GetNumNodes() const;
+	Returns the number of nodes in the graph
+
+long long GetNumEdges() const;
+	Returns the number of edges in the graph
+*/
+
+class HpaGraph
+{
+
+	public:
+
+		//pre: clusterSize is greater than zero
+		//post: An empty graph with clusters of clusterSize x clusterSize cells has been created
+		HpaGraph(/*in*/int clusterSize);			//rows and cols of cells in a cluster
+
+		/***************************************************************************************************/
+
+		//pre: gb has been initialized
+		//post: the graph holds the entrances and cluster distances of gb
+		void Build(/*in*/Board &gb);				//board to build the graph of
+
+		/***************************************************************************************************/
+
+		//pre: gb has been initialized
+		//post: if fileName holds a graph saved from a board with the same walls and clusters of the
+		//		same size, the graph holds it and true is returned to the caller. Otherwise false is
+		//		returned and the graph is unchanged
+		/*out*/bool Load(							//boolean value returned to the caller
+					/*in*/const string &fileName,	//graph file
+					/*in*/Board &gb);				//board the graph must be of
+
+		/***************************************************************************************************/
+
+		//pre: the graph is of gb
+		//post: the graph has been written to fileName. Returns true to the caller if it could be
+		//		written, false otherwise
+		/*out*/bool Save(							//boolean value returned to the caller
+					/*in*/const string &fileName,	//graph file
+					/*in*/Board &gb) const;			//board the graph is of
+
+		/***************************************************************************************************/
+
+		//pre: the graph is of gb, loc is within gb
+		//post: the location's open value has been set and the graph rebuilt for the cluster holding
+		//		it and the clusters sharing a border with it, so the graph is of gb again
+		void SetOpen(	/*inout*/Board &gb,			//board the graph is of
+						/*in*/Location loc,			//location to change
+						/*in*/bool open);			//desired open value
+
+		/***************************************************************************************************/
+
+		//pre: the graph is of gb, start and goal are within gb
+		//post: if the graph joins start to goal, moves holds the movements of a path between them and
+		//		true is returned to the caller. Otherwise false is returned
+		/*out*/bool FindPath(						//boolean value returned to the caller
+					/*in*/Board &gb,				//board the graph is of
+					/*in*/Location start,			//starting location
+					/*in*/Location goal,			//location to reach
+					/*out*/vector<Direction> &moves);	//movements of the path
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of nodes in the graph
+		/*out*/int GetNumNodes() const;				//number of nodes
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of edges in the graph, counting each direction
+		/*out*/long long GetNumEdges() const;		//number of edges
+
+		/***************************************************************************************************/
+
+	private:
+
+		//A step from one node to another
+		struct HpaEdge
+		{
+			int to;						//node the edge leads to
+			int cost;					//movements along the edge
+		};
+
+		//An entrance cell, or a start or goal while a query runs
+		struct HpaNode
+		{
+			Location loc;				//cell of the node
+			int cluster;				//cluster the cell is in
+			int border;					//border the entrance is on, -1 for a start or goal
+			bool alive;					//the node is in use
+			vector<HpaEdge> edges;		//edges leaving the node
+		};
+
+		//pre: gb has been initialized
+		//post: the graph is empty and sized for gb
+		void Reset(/*in*/Board &gb);				//board to size the graph for
+
+		//pre: the graph is sized for gb
+		//post: the nodes of the border have been replaced by those of its current entrances. Border
+		//		2k is between cluster k and the cluster east of it, border 2k + 1 the cluster south
+		void BuildBorder(	/*in*/Board &gb,		//board the graph is of
+							/*in*/int border);		//border to build
+
+		//pre: the graph is sized for gb, the cluster's nodes are current
+		//post: the edges between the cluster's nodes have been replaced by their current distances
+		void BuildCluster(	/*in*/Board &gb,		//board the graph is of
+							/*in*/int cluster);		//cluster to build
+
+		//pre: none
+		//post: a node at loc has been added to the graph and its index returned to the caller
+		/*out*/int AddNode(	/*in*/Location loc,		//cell of the node
+							/*in*/int cluster,		//cluster the cell is in
+							/*in*/int border);		//border of the entrance, -1 for none
+
+		//pre: node is alive
+		//post: the node is no longer in the graph. Edges leading to it are not removed
+		void RemoveNode(/*in*/int node);			//node to remove
+
+		//pre: loc is within the board the graph is sized for
+		//post: returns the cluster holding loc
+		/*out*/int ClusterOf(/*in*/Location loc) const;	//cluster of the location
+
+		//pre: the graph is sized for gb, source is within the cluster
+		//post: distance holds the movements from source to each cell of the cluster without leaving
+		//		it, or -1, indexed by (row - top) * clusterSize + (col - left)
+		void ClusterDistances(	/*in*/Board &gb,				//board the graph is of
+								/*in*/int cluster,				//cluster to search
+								/*in*/Location source,			//starting location
+								/*out*/vector<int> &distance) const;	//distance to each cell
+
+		//pre: the graph is sized for gb, from and to are cells of the cluster that reach each other
+		//		without leaving it
+		//post: the movements of a shortest path from from to to within the cluster have been
+		//		added to moves
+		void ClusterPath(	/*in*/Board &gb,				//board the graph is of
+							/*in*/int cluster,				//cluster to search
+							/*in*/Location from,			//starting location
+							/*in*/Location to,				//location to reach
+							/*inout*/vector<Direction> &moves) const;	//movements of the path
+
+		//PDM's
+		vector<HpaNode> nodes;					//nodes, alive or free
+		vector<int> freeNodes;					//indexes of free nodes
+		vector<vector<int> > clusterNodes;		//entrance nodes of each cluster
+		vector<vector<int> > borderNodes;		//nodes of each border
+		int clusterSize;						//rows and cols of cells in a cluster
+		int clusterRows;						//clusters down the board
+		int clusterCols;						//clusters across the board
+		int height;								//height of the board
+		int length;								//length of the board
+};
+
+#endif
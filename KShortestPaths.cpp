@@ -0,0 +1,705 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: KShortestPaths.cpp
+Purpose: Provides the implementation of the k shortest paths solver.
+*/
+
+#include "KShortestPaths.h"
+#include <algorithm>			//min, reverse
+#include <atomic>				//Spurs shared by the threads
+#include <chrono>				//Time budget
+#include <climits>				//LLONG_MAX, UINT_MAX
+#include <mutex>				//Candidates shared by the threads
+#include <queue>				//Open lists
+#include <set>					//Candidate paths
+#include <string>				//Path movements
+#include <thread>				//Spur threads
+#include <vector>				//Grid
+
+using namespace std;
+
+//long long constants
+const long long NO_WAY = LLONG_MAX;			//Cost to the exit of a cell it cannot be reached from
+
+//The board laid out for the search, as for the path estimator. Cells are numbered over the board
+//with a border of closed cells, (row+1)*width+(col+1), so a neighbor is always a fixed offset away
+struct KGrid
+{
+	vector<char> open;					//open cells
+	vector<int> cost;					//cost of moving into each cell
+	vector<long long> toExit;			//cost of the cheapest way from each cell to the exit
+	vector<char> towardExit;			//Direction of the next cell of that way, NUM_DIRECTIONS at the exit
+	long long offset[NUM_DIRECTIONS];	//index change moving in each Direction
+	size_t width;						//cols of the grid, with its border
+	size_t entryCell;					//cell of the entry point
+	size_t exitCell;					//cell of the exit point
+};
+
+//A path from the entry to the exit
+struct KPath
+{
+	long long cost;						//cost of its cells, not counting the entry
+	string moves;						//its movements, a Direction in each char
+	int parent;							//number of the path it was a spur of, from one, zero for the first
+	int deviation;						//move it left that path at
+};
+
+//Orders paths by cost, then by the path and spur they came from. No two paths come from the same
+//spur of the same path, so the order is the same however many threads found them, and whether a
+//path is wanted is known before its movements are put together
+struct CheaperPath
+{
+	//pre: none
+	//post: true has been returned to the caller if a comes before b
+	bool operator()(const KPath &a, const KPath &b) const
+	{
+		if (a.cost != b.cost)
+			return a.cost < b.cost;
+		if (a.parent != b.parent)
+			return a.parent < b.parent;
+		return a.deviation < b.deviation;
+	}
+};
+
+//A cell waiting in a spur's open list
+struct SpurEntry
+{
+	long long estimate;					//cost so far plus the cost to the exit of the open board
+	long long cost;						//cost so far
+	size_t cell;						//cell waiting
+
+	//pre: none
+	//post: true has been returned to the caller if this comes out of the open list after other. The
+	//		lowest estimate first, then the furthest along, so ties head straight for the exit
+	bool operator<(const SpurEntry &other) const
+	{
+		if (estimate != other.estimate)
+			return estimate > other.estimate;
+		if (cost != other.cost)
+			return cost < other.cost;
+		return cell > other.cell;
+	}
+};
+
+//A single thread's spur searches. Cells are marked with stamps rather than cleared between spurs
+struct SpurSearcher
+{
+	const KGrid *grid;					//board laid out for the search
+	vector<unsigned int> seen;			//spur each cell was last reached by
+	vector<long long> costTo;			//cost of the cheapest way found to each cell from the spur
+	vector<char> cameBy;				//Direction moved in to reach each cell by that way
+	priority_queue<SpurEntry> open;		//cells waiting to be expanded
+	unsigned int stamp;					//stamp of the current spur
+	KPath result;						//cheapest path leaving at the current spur, its movements from the spur to join
+	size_t join;						//cell the rest of that path follows the tree from
+	long long nodes;					//cells expanded
+	long long treeSpurs;				//spurs answered by following the tree
+	vector<int> meets;					//first cell of the path the way down the tree from each cell meets
+	vector<int> meetsRound;				//path each cell's meets was worked out for
+	vector<size_t> walk;				//cells whose meets is being worked out
+};
+
+//The spurs of a path, shared by every thread searching them
+struct SpurWork
+{
+	const KPath *path;					//path whose cells are the spurs
+	const vector<size_t> *cells;		//cells of the path, the entry first
+	const vector<int> *position;		//one more than the move each cell of the path is reached by, else zero
+	const vector<long long> *rootCost;	//cost of the path up to each of its cells
+	const vector<int> *blocked;			//moves from each spur taken by paths found so far, a bit each
+	int round;							//number of the path, from one
+	atomic<int> next;					//next spur to search
+	int last;							//one past the last spur
+	mutex lock;							//guards the candidates
+	set<KPath, CheaperPath> *candidates;	//paths not yet handed back, cheapest first
+	size_t wanted;						//paths still wanted, candidates past these are dropped
+	const SearchBudget *budget;			//limits of the search
+	const CancelToken *token;			//stops the search when cancelled
+	chrono::steady_clock::time_point start;		//when the search began
+	atomic<int> reason;					//StopReason of a spur search that stopped early
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void CostsToExit(KGrid &grid);
+	Finds the cheapest way to the exit from every cell, searched backwards from the exit
+
+bool IsRootCell(const SpurWork &work, size_t cell, int spur);
+	Returns true if a cell is on the path up to and including a spur
+
+int FirstMet(SpurSearcher &searcher, const SpurWork &work, size_t from);
+	Returns the first cell of the path the way down the tree from a cell meets
+
+void FollowTree(const KGrid &grid, size_t from, string &moves);
+	Follows the tree of cheapest ways from a cell to the exit
+
+bool SearchSpur(SpurSearcher &searcher, SpurWork &work, int spur);
+	Finds the cheapest way to the exit that leaves the path at a spur, if it is wanted
+
+void OfferCandidate(SpurWork &work, const SpurSearcher &searcher, int spur);
+	Keeps the path that leaves at a spur if it is among the cheapest still wanted
+
+void SpurWorker(SpurSearcher *searcher, SpurWork *work);
+	Searches spurs until there are none left
+*/
+
+
+//pre: grid has been laid out, apart from toExit and towardExit
+//post: toExit holds the cost of the cheapest way from each cell to the exit, and towardExit the
+//		direction of the first move of it. Cells the exit cannot be reached from cost NO_WAY
+static void CostsToExit(/*inout*/KGrid &grid)	//board laid out for the search
+{
+	priority_queue<pair<long long, size_t>, vector<pair<long long, size_t> >, greater<pair<long long, size_t> > > open;
+
+	grid.toExit.assign(grid.open.size(), NO_WAY);
+	grid.towardExit.assign(grid.open.size(), char(NUM_DIRECTIONS));
+	grid.toExit[grid.exitCell] = 0;
+	open.push(make_pair(0LL, grid.exitCell));
+
+	while (!open.empty())
+	{
+		long long cost = open.top().first;
+		size_t cell = open.top().second;
+
+		open.pop();
+		if (cost != grid.toExit[cell])
+			continue;
+
+		//A neighbor moves into this cell, so pays for it. Opposite directions differ only in their lowest bit
+		for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+		{
+			size_t next = size_t(cell + grid.offset[dir]);
+			long long through = cost + grid.cost[cell];
+
+			if (!grid.open[next] || through >= grid.toExit[next])
+				continue;
+
+			grid.toExit[next] = through;
+			grid.towardExit[next] = char(dir ^ 1);
+			open.push(make_pair(through, next));
+
+		}//end for
+
+	}//end while
+
+}//end CostsToExit
+
+
+/***************************************************************************************************/
+
+
+//pre: work holds the path whose spurs are searched
+//post: true has been returned to the caller if cell is one of the first spur + 1 cells of the path
+static inline /*out*/bool IsRootCell(				//boolean value returned to the caller
+				/*in*/const SpurWork &work,			//spurs of the path
+				/*in*/size_t cell,					//cell to look at
+				/*in*/int spur)						//move the path is left at
+{
+	int position = (*work.position)[cell];
+
+	return position != 0 && position <= spur + 1;
+
+}//end IsRootCell
+
+
+/***************************************************************************************************/
+
+
+//pre: the exit can be reached from from
+//post: the position on work's path, as in work.position, of the first of its cells the way down the
+//		tree from from to the exit meets, from itself on, has been returned to the caller, INT_MAX if
+//		it meets none. The answer for every cell on the way is kept for the rest of the path's spurs,
+//		so each way is walked once per path rather than once per spur
+static /*out*/int FirstMet(							//position returned to the caller
+				/*inout*/SpurSearcher &searcher,	//spur search of this thread
+				/*in*/const SpurWork &work,			//spurs of the path
+				/*in*/size_t from)					//cell to follow the tree from
+{
+	const KGrid &grid = *searcher.grid;
+	size_t cell = from;
+	int met = INT_MAX;
+
+	while (searcher.meetsRound[cell] != work.round)
+	{
+		searcher.walk.push_back(cell);
+		if (cell == grid.exitCell)
+			break;
+
+		cell = size_t(cell + grid.offset[int(grid.towardExit[cell])]);
+
+	}//end while
+
+	if (searcher.meetsRound[cell] == work.round)
+		met = searcher.meets[cell];
+
+	//Back up the way, each cell meeting the path where the next does unless it is on the path itself
+	while (!searcher.walk.empty())
+	{
+		cell = searcher.walk.back();
+		searcher.walk.pop_back();
+
+		if ((*work.position)[cell] != 0)
+			met = min(met, (*work.position)[cell]);
+
+		searcher.meets[cell] = met;
+		searcher.meetsRound[cell] = work.round;
+		searcher.nodes++;
+
+	}//end while
+
+	return met;
+
+}//end FirstMet
+
+
+/***************************************************************************************************/
+
+
+//pre: the exit can be reached from from
+//post: the movements of the way down the tree from from to the exit have been added to moves
+static void FollowTree(	/*in*/const KGrid &grid,			//board laid out for the search
+						/*in*/size_t from,					//cell to follow the tree from
+						/*inout*/string &moves)				//movements of the path
+{
+	for (size_t cell = from; cell != grid.exitCell; cell = size_t(cell + grid.offset[int(grid.towardExit[cell])]))
+		moves.push_back(grid.towardExit[cell]);
+
+}//end FollowTree
+
+
+/***************************************************************************************************/
+
+
+//pre: spur is one of the moves of work's path
+//post: if there is a way from the spur's cell to the exit that crosses no cell of the path before
+//		it and does not start with a blocked move, and the path leaving by the cheapest is among the
+//		work.wanted cheapest so far, searcher.result holds the cost of that path and the movements
+//		from the spur to searcher.join, whose way down the tree is the rest of it, and true has been
+//		returned to the caller. Otherwise false is returned
+static /*out*/bool SearchSpur(						//boolean value returned to the caller
+				/*inout*/SpurSearcher &searcher,	//spur search of this thread
+				/*inout*/SpurWork &work,			//spurs of the path
+				/*in*/int spur)						//move to leave the path at
+{
+	const KGrid &grid = *searcher.grid;
+	size_t spurCell = (*work.cells)[spur];
+	long long rootCost = (*work.rootCost)[spur];
+	int blocked = (*work.blocked)[spur];
+	long long limit = NO_WAY;
+	bool tieWanted = true;
+	int best = NUM_DIRECTIONS;
+
+	searcher.result.moves.clear();
+	searcher.result.parent = work.round;
+	searcher.result.deviation = spur;
+
+	//Paths costing more than the worst candidate, once there are enough, are not wanted. It only gets
+	//cheaper while the spur is searched, so a look at the start is enough
+	{
+		lock_guard<mutex> guard(work.lock);
+
+		if (work.candidates->size() >= work.wanted)
+		{
+			const KPath &worst = *work.candidates->rbegin();
+
+			limit = worst.cost;
+			tieWanted = work.round < worst.parent || (work.round == worst.parent && spur < worst.deviation);
+		}
+	}
+
+	//The neighbor with the cheapest way to the exit on the open board, if its way is clear, is the
+	//cheapest way from the spur
+	for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+	{
+		size_t next = size_t(spurCell + grid.offset[dir]);
+
+		if ((blocked & (1 << dir)) || !grid.open[next] || IsRootCell(work, next, spur) || grid.toExit[next] == NO_WAY)
+			continue;
+
+		if (best == NUM_DIRECTIONS ||
+			grid.cost[next] + grid.toExit[next] < grid.cost[spurCell + grid.offset[best]] + grid.toExit[spurCell + grid.offset[best]])
+			best = dir;
+	}
+
+	if (best == NUM_DIRECTIONS)
+		return false;
+
+	size_t first = size_t(spurCell + grid.offset[best]);
+	long long bound = rootCost + grid.cost[first] + grid.toExit[first];
+
+	if (bound > limit || (bound == limit && !tieWanted))
+		return false;
+
+	if (FirstMet(searcher, work, first) > spur + 1)
+	{
+		searcher.result.moves.push_back(char(best));
+		searcher.result.cost = bound;
+		searcher.join = first;
+		searcher.treeSpurs++;
+		return true;
+	}
+
+	//Stamps are about to wrap around, start the marks over
+	if (searcher.stamp == UINT_MAX)
+	{
+		searcher.seen.assign(searcher.seen.size(), 0);
+		searcher.stamp = 0;
+	}
+
+	searcher.stamp++;
+	while (!searcher.open.empty())
+		searcher.open.pop();
+
+	//A* from the spur, the open board's cost to the exit never more than the cost with the root closed
+	searcher.seen[spurCell] = searcher.stamp;
+	searcher.costTo[spurCell] = 0;
+	searcher.open.push(SpurEntry{grid.toExit[spurCell], 0, spurCell});
+
+	while (!searcher.open.empty())
+	{
+		SpurEntry top = searcher.open.top();
+
+		searcher.open.pop();
+		if (top.cost != searcher.costTo[top.cell])
+			continue;
+
+		//Every way left costs at least as much as this one
+		if (rootCost + top.estimate > limit || (rootCost + top.estimate == limit && !tieWanted))
+			return false;
+
+		searcher.nodes++;
+
+		//No way is cheaper than the cost so far plus the open board's cost to the exit, so once the tree
+		//from here is clear of the path it is the cheapest way. Back to the spur, last move first
+		if (top.cell != spurCell && FirstMet(searcher, work, top.cell) > spur + 1)
+		{
+			for (size_t cell = top.cell; cell != spurCell; cell = size_t(cell - grid.offset[int(searcher.cameBy[cell])]))
+				searcher.result.moves.push_back(searcher.cameBy[cell]);
+
+			reverse(searcher.result.moves.begin(), searcher.result.moves.end());
+			searcher.result.cost = rootCost + top.estimate;
+			searcher.join = top.cell;
+			return true;
+		}
+
+		for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+		{
+			size_t next = size_t(top.cell + grid.offset[dir]);
+			long long cost = top.cost + grid.cost[next];
+
+			if (!grid.open[next] || IsRootCell(work, next, spur) || grid.toExit[next] == NO_WAY ||
+				(top.cell == spurCell && (blocked & (1 << dir))))
+				continue;
+
+			if (searcher.seen[next] == searcher.stamp && cost >= searcher.costTo[next])
+				continue;
+
+			searcher.seen[next] = searcher.stamp;
+			searcher.costTo[next] = cost;
+			searcher.cameBy[next] = char(dir);
+			searcher.open.push(SpurEntry{cost + grid.toExit[next], cost, next});
+
+		}//end for
+
+	}//end while
+
+	return false;
+
+}//end SearchSpur
+
+
+/***************************************************************************************************/
+
+
+//pre: SearchSpur returned true for spur with searcher
+//post: the whole path has been added to the candidates if it is among the work.wanted cheapest, and
+//		the most expensive dropped if there are more than that. The cheapest are the same whatever
+//		order the spurs are offered in
+static void OfferCandidate(	/*inout*/SpurWork &work,				//spurs of the path
+							/*in*/const SpurSearcher &searcher,		//spur search that found the path
+							/*in*/int spur)							//move the path is left at
+{
+	KPath path;
+
+	path.cost = searcher.result.cost;
+	path.parent = searcher.result.parent;
+	path.deviation = spur;
+
+	//Another thread may have filled the candidates with cheaper paths since the spur was searched
+	{
+		lock_guard<mutex> guard(work.lock);
+
+		if (work.candidates->size() >= work.wanted && !CheaperPath()(path, *work.candidates->rbegin()))
+			return;
+	}
+
+	path.moves.assign(work.path->moves, 0, spur);
+	path.moves += searcher.result.moves;
+	FollowTree(*searcher.grid, searcher.join, path.moves);
+
+	lock_guard<mutex> guard(work.lock);
+
+	work.candidates->insert(path);
+	if (work.candidates->size() > work.wanted)
+		work.candidates->erase(--work.candidates->end());
+
+}//end OfferCandidate
+
+
+/***************************************************************************************************/
+
+
+//pre: work has been initialized
+//post: spurs have been taken from work and searched until there were none left, or the budget ran
+//		out or the token was cancelled, which work.reason then says
+static void SpurWorker(	/*inout*/SpurSearcher *searcher,	//spur search of this thread
+						/*inout*/SpurWork *work)			//spurs shared by every thread
+{
+	int spur;
+
+	while (work->reason.load(memory_order_relaxed) == STOP_NONE && (spur = work->next++) < work->last)
+	{
+		int expected = STOP_NONE;
+		StopReason reason = CheckBudget(*work->budget,
+										chrono::duration<double>(chrono::steady_clock::now() - work->start).count(),
+										0, 0, 0);
+
+		if (work->token != nullptr && work->token->IsCancelled())
+			reason = STOP_CANCELLED;
+
+		if (reason != STOP_NONE)
+		{
+			work->reason.compare_exchange_strong(expected, int(reason));
+			break;
+		}
+
+		if (SearchSpur(*searcher, *work, spur))
+			OfferCandidate(*work, *searcher, spur);
+
+	}//end while
+
+}//end SpurWorker
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, entry and exit are open cells within its bounds, k and threads are
+//		greater than zero, token is null or lives as long as the search
+//post: callback has been called with the movements of the k paths from entry to exit that visit no
+//		cell twice and whose cells, not counting the entry, cost the least, cheapest first, or every
+//		path if there are fewer. The number of paths has been returned to the caller. If the seconds
+//		or nodes of budget ran out or token was cancelled first, reason says which and the paths
+//		found by then were handed to callback. The spurs of each path were searched on threads
+//		threads. stats describes the search
+/*out*/long long KShortestPaths(						//number of paths
+				/*in*/Board &gb,						//board to search
+				/*in*/Location entry,					//starting location
+				/*in*/Location exit,					//location to reach
+				/*in*/int k,							//number of paths to find
+				/*in*/int threads,						//number of threads
+				/*in*/const SearchBudget &budget,		//limits of the search
+				/*in*/const CancelToken *token,			//stops the search when cancelled
+				/*in*/PathCallback callback,			//called with each path
+				/*in*/void *context,					//handed to callback
+				/*out*/KShortestStats &stats,			//description of the search
+				/*out*/StopReason &reason)				//why the search stopped early, if it did
+{
+	KGrid grid;
+	vector<SpurSearcher> searchers(threads);
+	vector<KPath> found;						//paths handed to callback, in order
+	set<KPath, CheaperPath> candidates;			//paths not yet handed to callback, cheapest first
+	vector<size_t> cells;						//cells of the last path found
+	vector<int> position;						//where each cell is on the last path found
+	vector<long long> rootCost;					//cost of the last path found up to each cell
+	vector<int> blocked;						//moves taken from each cell of it by the paths found
+	vector<Direction> moves;
+	SpurWork work;
+	Location loc;
+
+	work.start = chrono::steady_clock::now();
+
+	grid.width = size_t(gb.GetLength()) + 2;
+	grid.open.assign((size_t(gb.GetHeight()) + 2) * grid.width, 0);
+	grid.cost.assign(grid.open.size(), 0);
+	for (loc.row = 0; loc.row < gb.GetHeight(); loc.row++)
+	{
+		for (loc.col = 0; loc.col < gb.GetLength(); loc.col++)
+		{
+			size_t cell = (size_t(loc.row) + 1) * grid.width + loc.col + 1;
+
+			grid.open[cell] = gb.IsOpen(loc);
+			grid.cost[cell] = gb.GetCost(loc);
+		}
+	}
+
+	grid.offset[NORTH] = -(long long)grid.width;
+	grid.offset[SOUTH] = (long long)grid.width;
+	grid.offset[EAST] = 1;
+	grid.offset[WEST] = -1;
+	grid.entryCell = (size_t(entry.row) + 1) * grid.width + entry.col + 1;
+	grid.exitCell = (size_t(exit.row) + 1) * grid.width + exit.col + 1;
+
+	stats.paths = 0;
+	stats.firstCost = 0;
+	stats.lastCost = 0;
+	stats.spurs = 0;
+	stats.treeSpurs = 0;
+	stats.nodes = 0;
+	reason = STOP_NONE;
+
+	CostsToExit(grid);
+
+	for (int t = 0; t < threads; t++)
+	{
+		searchers[t].grid = &grid;
+		searchers[t].seen.assign(grid.open.size(), 0);
+		searchers[t].costTo.assign(grid.open.size(), 0);
+		searchers[t].cameBy.assign(grid.open.size(), 0);
+		searchers[t].stamp = 0;
+		searchers[t].nodes = 0;
+		searchers[t].treeSpurs = 0;
+		searchers[t].meets.assign(grid.open.size(), 0);
+		searchers[t].meetsRound.assign(grid.open.size(), 0);
+	}
+
+	position.assign(grid.open.size(), 0);
+	work.position = &position;
+	work.cells = &cells;
+	work.rootCost = &rootCost;
+	work.blocked = &blocked;
+	work.candidates = &candidates;
+	work.budget = &budget;
+	work.token = token;
+	work.reason = STOP_NONE;
+
+	//The first path follows the tree from the entry
+	if (grid.toExit[grid.entryCell] != NO_WAY)
+	{
+		KPath path;
+
+		path.cost = grid.toExit[grid.entryCell];
+		path.parent = 0;
+		path.deviation = 0;
+		FollowTree(grid, grid.entryCell, path.moves);
+
+		candidates.insert(path);
+	}
+
+	while (!candidates.empty() && reason == STOP_NONE)
+	{
+		vector<thread> workers;
+		long long nodes = 0;
+
+		found.push_back(*candidates.begin());
+		candidates.erase(candidates.begin());
+
+		const KPath &last = found.back();
+		int length = int(last.moves.size());
+
+		moves.resize(length);
+		for (int i = 0; i < length; i++)
+			moves[i] = Direction(last.moves[i]);
+		callback(moves.empty() ? nullptr : &moves[0], length, context);
+
+		if (int(found.size()) == k)
+			break;
+
+		//The cells of the path, where each is on it, and what it costs to get there
+		for (size_t i = 0; i < cells.size(); i++)
+			position[cells[i]] = 0;
+
+		cells.resize(length + 1);
+		rootCost.resize(length + 1);
+		cells[0] = grid.entryCell;
+		rootCost[0] = 0;
+		position[cells[0]] = 1;
+		for (int i = 0; i < length; i++)
+		{
+			cells[i + 1] = size_t(cells[i] + grid.offset[int(last.moves[i])]);
+			rootCost[i + 1] = rootCost[i] + grid.cost[cells[i + 1]];
+			position[cells[i + 1]] = i + 2;
+		}
+
+		//Each path found so far that follows this one up to a spur blocks the move it took from there
+		blocked.assign(length, 0);
+		for (size_t p = 0; p < found.size(); p++)
+		{
+			const string &other = found[p].moves;
+			int shared = 0;
+
+			while (shared < int(other.size()) && shared < length && other[shared] == last.moves[shared])
+				shared++;
+
+			for (int i = last.deviation; i <= shared && i < int(other.size()) && i < length; i++)
+				blocked[i] |= 1 << int(other[i]);
+		}
+
+		//Spurs from where this path left its parent on, the earlier ones were its parent's spurs
+		work.path = &last;
+		work.round = int(found.size());
+		work.next = last.deviation;
+		work.last = length;
+		work.wanted = size_t(k) - found.size();
+
+		int spurs = work.last - last.deviation;
+
+		if (spurs > 1 && threads > 1)
+		{
+			for (int t = 0; t < min(threads, spurs); t++)
+				workers.push_back(thread(SpurWorker, &searchers[t], &work));
+			for (size_t t = 0; t < workers.size(); t++)
+				workers[t].join();
+		}
+		else
+			SpurWorker(&searchers[0], &work);
+
+		stats.spurs += spurs;
+
+		for (int t = 0; t < threads; t++)
+			nodes += searchers[t].nodes;
+
+		//A spur search that stopped early leaves candidates missing, so nothing more can be handed back
+		reason = StopReason(work.reason.load());
+		if (reason == STOP_NONE)
+			reason = CheckBudget(budget, chrono::duration<double>(chrono::steady_clock::now() - work.start).count(),
+								 nodes, 0, 0);
+
+	}//end while
+
+	for (int t = 0; t < threads; t++)
+	{
+		stats.nodes += searchers[t].nodes;
+		stats.treeSpurs += searchers[t].treeSpurs;
+	}
+
+	stats.paths = (long long)found.size();
+	if (!found.empty())
+	{
+		stats.firstCost = found.front().cost;
+		stats.lastCost = found.back().cost;
+	}
+	stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - work.start).count();
+
+	return stats.paths;
+
+}//end KShortestPaths
+
+
+/***************************************************************************************************/
+
+
+//pre: stats was filled in by KShortestPaths
+//post: the statistics of the search have been written to out
+void WriteKShortestStats(	/*in*/const KShortestStats &stats,	//description of the search
+							/*inout*/ostream &out)				//stream to write to
+{
+	out << "Path costs: " << stats.firstCost << " to " << stats.lastCost << endl;
+	out << "Spurs looked at: " << stats.spurs << ", " << stats.treeSpurs << " answered from the tree" << endl;
+	out << "Cells expanded: " << stats.nodes << " in " << stats.seconds << " seconds" << endl;
+
+}//end WriteKShortestStats
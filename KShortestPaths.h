@@ -0,0 +1,83 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: KShortestPaths.h
+Purpose: Provides the specification for the k shortest paths solver, which finds the k paths from the
+			entry to the exit that cost the least, shortest first, without finding every path (Yen's
+			algorithm). Each path after the first leaves one found before it at some cell, the spur,
+			and takes the cheapest way from there that avoids the cells before the spur and the moves
+			the paths found so far took from it. Only the cells from where a path left its parent on
+			are spurs, those before it were spurs of the parent already (Lawler). The cheapest way to
+			the exit from every cell is worked out once, backwards from the exit, and kept as a tree:
+			a spur whose best neighbor's way down the tree avoids the root path is answered by just
+			following it, and the rest are searched with A* guided by those costs, which with the
+			exact cost of the open board as its guess heads almost straight for the exit. The spurs
+			of each path are searched on many threads at once.
+*/
+
+#ifndef KSHORTESTPATHS_H
+#define KSHORTESTPATHS_H
+
+#include "Board.h"				//For use of a board
+#include "Location.h"			//Location struct
+#include "SearchBudget.h"		//Run limits and cancellation
+#include "SmallMazeSolver.h"	//PathCallback
+#include <ostream>				//Writing the statistics
+
+using namespace std;
+
+//How the k shortest paths search went
+struct KShortestStats
+{
+	long long paths;			//paths found
+	long long firstCost;		//cost of the first path
+	long long lastCost;			//cost of the last path
+	long long spurs;			//spurs looked at
+	long long treeSpurs;		//spurs answered by following the tree of cheapest ways to the exit
+	long long nodes;			//cells expanded by every search
+	double seconds;				//time taken
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+long long KShortestPaths(Board &gb, Location entry, Location exit, int k, int threads, const SearchBudget &budget,
+						 const CancelToken *token, PathCallback callback, void *context, KShortestStats &stats,
+						 StopReason &reason);
+	Given: a board, an entry and exit point, a number of paths, a number of threads, a budget and a cancel token
+		-> calls callback with the k cheapest paths from the entry to the exit, cheapest first, returns the number of them
+
+void WriteKShortestStats(const KShortestStats &stats, ostream &out);
+	Writes how the k shortest paths search went
+*/
+
+
+//pre: gb is a valid gameboard, entry and exit are open cells within its bounds, k and threads are
+//		greater than zero, token is null or lives as long as the search
+//post: callback has been called with the movements of the k paths from entry to exit that visit no
+//		cell twice and whose cells, not counting the entry, cost the least, cheapest first, or every
+//		path if there are fewer. The number of paths has been returned to the caller. If the seconds
+//		or nodes of budget ran out or token was cancelled first, reason says which and the paths
+//		found by then were handed to callback. The spurs of each path were searched on threads
+//		threads. stats describes the search
+/*out*/long long KShortestPaths(						//number of paths
+				/*in*/Board &gb,						//board to search
+				/*in*/Location entry,					//starting location
+				/*in*/Location exit,					//location to reach
+				/*in*/int k,							//number of paths to find
+				/*in*/int threads,						//number of threads
+				/*in*/const SearchBudget &budget,		//limits of the search
+				/*in*/const CancelToken *token,			//stops the search when cancelled
+				/*in*/PathCallback callback,			//called with each path
+				/*in*/void *context,					//handed to callback
+				/*out*/KShortestStats &stats,			//description of the search
+				/*out*/StopReason &reason);				//why the search stopped early, if it did
+
+//pre: stats was filled in by KShortestPaths
+//post: the statistics of the search have been written to out
+void WriteKShortestStats(	/*in*/const KShortestStats &stats,	//description of the search
+							/*inout*/ostream &out);				//stream to write to
+
+#endif
@@ -0,0 +1,698 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: LongestPath.cpp
+Purpose: Provides the implementation of the longest path solver.
+*/
+
+#include "LongestPath.h"
+#include <algorithm>			//min, swap
+#include <atomic>				//Longest path shared by the threads
+#include <chrono>				//Time budget
+#include <climits>				//UINT_MAX
+#include <cstdlib>				//llabs
+#include <mutex>				//Path shared by the threads
+#include <random>				//Move orders of the other threads
+#include <thread>				//Search threads
+
+using namespace std;
+
+//int constants
+const int NO_PATH = -1;						//Moves of the longest path before one is found
+const int NUM_ORDERS = 3;					//Move orders threads take turns at
+
+//How a thread orders the moves from a cell
+enum MoveOrder
+{
+	ORDER_TIGHT,			//cells with the fewest moves onward first, so the path hugs walls and fills corners
+	ORDER_FAR,				//cells furthest from the exit first, so the path goes the long way round
+	ORDER_RANDOM			//any order
+};
+
+//The board laid out for the search, as for the path estimator. Cells are numbered over the board
+//with a border of closed cells, (row+1)*width+(col+1), so a neighbor is always a fixed offset away
+struct LongestGrid
+{
+	vector<char> open;					//open cells
+	vector<char> colour;				//checkerboard colour of each cell, (row+col) mod 2
+	long long offset[NUM_DIRECTIONS];	//index change moving in each Direction
+	size_t width;						//cols of the grid, with its border
+	size_t entryCell;					//cell of the entry point
+	size_t exitCell;					//cell of the exit point
+};
+
+//A cell of the partial path and the moves from it still to be tried
+struct LongestFrame
+{
+	size_t cell;						//cell of the path
+	size_t moves[NUM_DIRECTIONS];		//cells to move to, in the order they are tried
+	int numMoves;						//number of moves
+	int next;							//next move to try
+};
+
+//A cell of the search for reachable cells and the next direction to look in from it
+struct ReachFrame
+{
+	size_t cell;						//cell reached
+	int next;							//next Direction to look in
+};
+
+//The open cells a partial path could still use, from the last cell of the path
+struct ReachableCells
+{
+	long long all[2];					//cells reachable of each colour, not counting the last cell
+	long long kept[2];					//cells of each colour left once pockets off the way are left out
+	long long blockMoves;				//most moves through the blocks on the way, NO_PATH if there are none
+	unsigned int firstUseful;			//cells found from firstUseful up to lastUseful are on the way
+	unsigned int lastUseful;			//to the exit
+};
+
+//A single thread's search. Cells reachable from the path are marked with stamps rather than
+//cleared between bounds
+struct LongestSearcher
+{
+	const LongestGrid *grid;			//board laid out for the search
+	MoveOrder order;					//how this thread orders its moves
+	bool shuffle;						//moves of equal rank are tried in a random order
+	mt19937 random;						//this thread's random numbers
+	vector<char> onPath;				//cells of the partial path
+	vector<unsigned int> found;			//when each cell was found by the search for reachable cells
+	vector<unsigned int> low;			//earliest cell found that each cell's subtree has an edge to
+	vector<int> pending[2];				//cells of each colour in each cell's subtree not yet closed off
+	vector<char> hasExit;				//the exit is in each cell's subtree
+	vector<ReachFrame> stack;			//cells of the search for reachable cells
+	unsigned int stamp;					//first stamp of the next search for reachable cells
+	LongestStats counts;				//this thread's nodes and cuts
+};
+
+//State shared by every thread of the search
+struct LongestWork
+{
+	atomic<int> best;					//moves of the longest path found, read without the lock
+	atomic<bool> stop;					//the search is done, read without the lock
+	mutex lock;							//guards what follows
+	vector<size_t> cells;				//cells of the longest path found
+	LongestStats totals;				//nodes and cuts of every thread
+	StopReason reason;					//why the search stopped early, if it did
+	const SearchBudget *budget;			//limits of the search
+	const CancelToken *token;			//stops the search when cancelled
+	atomic<long long> nodes;			//cells expanded by every thread, counted every so often
+	chrono::steady_clock::time_point start;		//when the search began
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int ParityBound(long long same, long long other, bool oddMoves);
+	Returns the most moves a path can make over cells of the two colours
+
+bool FindReachable(LongestSearcher &searcher, size_t from, ReachableCells &cells);
+	Counts the cells a path from a cell could still use, returns false if the exit cannot be reached
+
+bool ExpandCell(LongestSearcher &searcher, LongestWork &work, LongestFrame &frame, int depth);
+	Bounds the path at a cell and orders the moves from it, returns false if it cannot beat the longest
+
+void StopSearch(LongestWork &work, StopReason reason, bool proven, int id);
+	Stops every thread, the first to call it says why
+
+void RecordPath(LongestWork &work, const vector<LongestFrame> &path, size_t exitCell, int upperBound, int id);
+	Keeps the path to the exit if it is the longest found
+
+void LongestWorker(const LongestGrid *grid, LongestWork *work, int upperBound, int id, unsigned int seed);
+	Searches every path in this thread's order, cutting with the longest found by any thread
+*/
+
+
+//pre: same and other are at least zero
+//post: the most moves a path can make from a cell of one colour, over same more cells of that colour
+//		and other cells of the other colour, with an odd number of moves if oddMoves, has been returned
+//		to the caller. A path alternates colours starting with the other, so it makes at most one more
+//		move onto the other colour than onto its own. NO_PATH is returned if it can make none
+static /*out*/int ParityBound(						//moves returned to the caller
+				/*in*/long long same,				//cells of the colour of the path's last cell
+				/*in*/long long other,				//cells of the other colour
+				/*in*/bool oddMoves)				//moves to the exit are odd
+{
+	long long moves = other > same ? 2 * same + 1 : 2 * other;
+
+	if ((moves % 2 == 1) != oddMoves)
+		moves--;
+
+	return int(min(moves, (long long)INT_MAX));
+
+}//end ParityBound
+
+
+/***************************************************************************************************/
+
+
+//pre: from is the last cell of the partial path
+//post: cells holds the open cells off the path reachable from from, and true has been returned to the
+//		caller if the exit is one of them. Cells in a pocket joined to the rest through a single cell,
+//		without the exit in it, are not kept, as a path that goes in cannot come out. What is left is a
+//		chain of blocks, each joined to the next through a single cell, and the path crosses each
+//		from the cell it enters by to the cell it leaves by, so the colours bound each block on its
+//		own. Found as the articulation points of a depth first search: a cell is the only way into
+//		the subtree of a child when nothing in that subtree has an edge to a cell found before it
+static /*out*/bool FindReachable(						//boolean value returned to the caller
+				/*inout*/LongestSearcher &searcher,		//search of this thread
+				/*in*/size_t from,						//last cell of the path
+				/*out*/ReachableCells &cells)			//cells the path could use
+{
+	const LongestGrid &grid = *searcher.grid;
+	unsigned int base;
+	unsigned int time;
+
+	//Stamps are about to wrap around, start the marks over
+	if (searcher.stamp > UINT_MAX - grid.open.size() - 1)
+	{
+		searcher.found.assign(searcher.found.size(), 0);
+		searcher.stamp = 1;
+	}
+
+	base = searcher.stamp;
+	time = base;
+
+	cells.all[0] = cells.all[1] = 0;
+	cells.kept[0] = cells.kept[1] = 0;
+	cells.blockMoves = 0;
+	cells.firstUseful = cells.lastUseful = 0;
+
+	//Blocks on the way close from the exit back, each ending at the cell the one after it starts at
+	size_t leaveBy = grid.exitCell;
+
+	searcher.found[from] = searcher.low[from] = time++;
+	searcher.pending[0][from] = searcher.pending[1][from] = 0;
+	searcher.hasExit[from] = 0;
+	searcher.stack.clear();
+	searcher.stack.push_back(ReachFrame{from, 0});
+
+	while (!searcher.stack.empty())
+	{
+		ReachFrame &top = searcher.stack.back();
+
+		if (top.next < NUM_DIRECTIONS)
+		{
+			size_t cell = top.cell;
+			size_t next = size_t(cell + grid.offset[top.next++]);
+
+			if (!grid.open[next] || (searcher.onPath[next] && next != from))
+				continue;
+
+			//Found before, an edge back up the tree
+			if (searcher.found[next] >= base)
+			{
+				searcher.low[cell] = min(searcher.low[cell], searcher.found[next]);
+				continue;
+			}
+
+			searcher.found[next] = searcher.low[next] = time++;
+			searcher.pending[0][next] = searcher.pending[1][next] = 0;
+			searcher.pending[int(grid.colour[next])][next] = 1;
+			searcher.hasExit[next] = next == grid.exitCell;
+			cells.all[int(grid.colour[next])]++;
+			searcher.stack.push_back(ReachFrame{next, 0});
+			continue;
+
+		}//end look at the next direction
+
+		size_t cell = top.cell;
+
+		searcher.stack.pop_back();
+		if (searcher.stack.empty())
+			break;
+
+		size_t parent = searcher.stack.back().cell;
+
+		searcher.low[parent] = min(searcher.low[parent], searcher.low[cell]);
+
+		//Still in the same block as its parent
+		if (searcher.low[cell] < searcher.found[parent])
+		{
+			searcher.pending[0][parent] += searcher.pending[0][cell];
+			searcher.pending[1][parent] += searcher.pending[1][cell];
+			searcher.hasExit[parent] |= searcher.hasExit[cell];
+			continue;
+		}
+
+		//The subtree can only be reached through its parent, and the exit is not in it
+		if (!searcher.hasExit[cell])
+			continue;
+
+		//A block on the way, entered by its parent
+		int colour = grid.colour[parent];
+		int moves = ParityBound(searcher.pending[colour][cell], searcher.pending[1 - colour][cell],
+								grid.colour[parent] != grid.colour[leaveBy]);
+
+		cells.blockMoves = moves == NO_PATH || cells.blockMoves == NO_PATH ? NO_PATH : cells.blockMoves + moves;
+		cells.kept[0] += searcher.pending[0][cell];
+		cells.kept[1] += searcher.pending[1][cell];
+		searcher.hasExit[parent] = 1;
+		leaveBy = parent;
+
+		//The subtrees of the first cell only meet through it, the path goes on into the one with the exit
+		if (parent == from)
+		{
+			cells.firstUseful = searcher.found[cell];
+			cells.lastUseful = time;
+		}
+
+	}//end while
+
+	searcher.stamp = time;
+
+	return searcher.hasExit[from] != 0;
+
+}//end FindReachable
+
+
+/***************************************************************************************************/
+
+
+//pre: frame.cell is the last cell of a partial path of depth moves, and is not the exit
+//post: if the bound on the moves the path has left could beat the longest path found, frame holds the
+//		moves from the cell toward the exit in this thread's order and true has been returned to the
+//		caller. Otherwise the cut has been counted and false is returned
+static /*out*/bool ExpandCell(							//boolean value returned to the caller
+				/*inout*/LongestSearcher &searcher,		//search of this thread
+				/*in*/LongestWork &work,				//state shared by every thread
+				/*out*/LongestFrame &frame,				//cell to expand
+				/*in*/int depth)						//moves of the partial path
+{
+	const LongestGrid &grid = *searcher.grid;
+	ReachableCells cells;
+	int colour = grid.colour[frame.cell];
+	bool oddMoves = grid.colour[frame.cell] != grid.colour[grid.exitCell];
+	long long exitRow = (long long)(grid.exitCell / grid.width);
+	long long exitCol = (long long)(grid.exitCell % grid.width);
+	long long rank[NUM_DIRECTIONS];
+
+	frame.numMoves = 0;
+	frame.next = 0;
+
+	if (!FindReachable(searcher, frame.cell, cells))
+	{
+		searcher.counts.reachCuts++;
+		return false;
+	}
+
+	//Each bound is tighter than the one before, the cut is counted against the first that makes it
+	int best = work.best.load(memory_order_relaxed);
+
+	if (depth + cells.all[0] + cells.all[1] <= best)
+	{
+		searcher.counts.sizeCuts++;
+		return false;
+	}
+
+	int bound = ParityBound(cells.all[colour], cells.all[1 - colour], oddMoves);
+
+	if (bound == NO_PATH || depth + (long long)bound <= best)
+	{
+		searcher.counts.parityCuts++;
+		return false;
+	}
+
+	bound = ParityBound(cells.kept[colour], cells.kept[1 - colour], oddMoves);
+
+	if (bound == NO_PATH || depth + (long long)bound <= best)
+	{
+		searcher.counts.pocketCuts++;
+		return false;
+	}
+
+	if (cells.blockMoves == NO_PATH || depth + cells.blockMoves <= best)
+	{
+		searcher.counts.blockCuts++;
+		return false;
+	}
+
+	//Only moves into the part of the board with the exit can lead anywhere
+	for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+	{
+		size_t next = size_t(frame.cell + grid.offset[dir]);
+		unsigned int mark = searcher.found[next];
+
+		if (!grid.open[next] || searcher.onPath[next] || mark < cells.firstUseful || mark >= cells.lastUseful)
+			continue;
+
+		long long distance = llabs((long long)(next / grid.width) - exitRow) + llabs((long long)(next % grid.width) - exitCol);
+
+		if (searcher.order == ORDER_TIGHT)
+		{
+			int onward = 0;
+
+			for (int i = 0; i < NUM_DIRECTIONS; i++)
+			{
+				size_t after = size_t(next + grid.offset[i]);
+
+				if (grid.open[after] && !searcher.onPath[after] && after != frame.cell)
+					onward++;
+			}
+
+			rank[frame.numMoves] = onward * (long long)grid.open.size() - distance;
+		}
+		else if (searcher.order == ORDER_FAR)
+			rank[frame.numMoves] = -distance;
+		else
+			rank[frame.numMoves] = 0;
+
+		frame.moves[frame.numMoves++] = next;
+
+	}//end for
+
+	if (searcher.shuffle || searcher.order == ORDER_RANDOM)
+	{
+		for (int i = frame.numMoves - 1; i > 0; i--)
+		{
+			int j = int(searcher.random() % unsigned(i + 1));
+
+			swap(frame.moves[i], frame.moves[j]);
+			swap(rank[i], rank[j]);
+		}
+	}
+
+	//At most four moves, sorted by rank keeping the order of equal ones
+	for (int i = 1; i < frame.numMoves; i++)
+	{
+		for (int j = i; j > 0 && rank[j] < rank[j - 1]; j--)
+		{
+			swap(frame.moves[j], frame.moves[j - 1]);
+			swap(rank[j], rank[j - 1]);
+		}
+	}
+
+	return frame.numMoves > 0;
+
+}//end ExpandCell
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: every thread has been told to stop. The first call says why, and if proven, that thread id
+//		proved the longest path found is the longest
+static void StopSearch(	/*inout*/LongestWork &work,		//state shared by every thread
+						/*in*/StopReason reason,		//why the search stopped early, STOP_NONE if it did not
+						/*in*/bool proven,				//no path is longer than the longest found
+						/*in*/int id)					//thread stopping the search
+{
+	lock_guard<mutex> guard(work.lock);
+
+	if (work.stop)
+		return;
+
+	work.reason = reason;
+	work.totals.proven = proven;
+	work.totals.provingThread = proven ? id : -1;
+	work.stop = true;
+
+}//end StopSearch
+
+
+/***************************************************************************************************/
+
+
+//pre: path is a partial path next to exitCell
+//post: if no path as long has been found, the path and the exit have been kept as the longest.
+//		A path as long as upperBound cannot be beaten, and stops the search
+static void RecordPath(	/*inout*/LongestWork &work,				//state shared by every thread
+						/*in*/const vector<LongestFrame> &path,	//partial path
+						/*in*/size_t exitCell,					//cell of the exit point
+						/*in*/int upperBound,					//most moves any path could have
+						/*in*/int id)							//thread that found the path
+{
+	int moves = int(path.size());
+
+	{
+		lock_guard<mutex> guard(work.lock);
+
+		if (moves <= work.best)
+			return;
+
+		work.cells.clear();
+		for (size_t i = 0; i < path.size(); i++)
+			work.cells.push_back(path[i].cell);
+		work.cells.push_back(exitCell);
+		work.best = moves;
+		work.totals.improvements++;
+	}
+
+	if (moves >= upperBound)
+		StopSearch(work, STOP_NONE, true, id);
+
+}//end RecordPath
+
+
+/***************************************************************************************************/
+
+
+//pre: grid has been laid out, work has been initialized, the exit can be reached from the entry
+//		and upperBound is the bound at the entry
+//post: every path from the entry has been searched in this thread's order, or cut, or the search
+//		was stopped. The nodes and cuts of the thread have been added to work's totals
+static void LongestWorker(	/*in*/const LongestGrid *grid,		//board laid out for the search
+							/*inout*/LongestWork *work,			//state shared by every thread
+							/*in*/int upperBound,				//most moves any path could have
+							/*in*/int id,						//number of this thread
+							/*in*/unsigned int seed)			//this thread's random seed
+{
+	LongestSearcher searcher;
+	vector<LongestFrame> path;
+	long long unchecked = 0;
+
+	//The first threads each take one of the orders, the rest take them again with ties broken at random
+	searcher.grid = grid;
+	searcher.order = MoveOrder(id % NUM_ORDERS);
+	searcher.shuffle = id >= NUM_ORDERS;
+	searcher.random.seed(seed);
+	searcher.onPath.assign(grid->open.size(), 0);
+	searcher.found.assign(grid->open.size(), 0);
+	searcher.low.assign(grid->open.size(), 0);
+	searcher.pending[0].assign(grid->open.size(), 0);
+	searcher.pending[1].assign(grid->open.size(), 0);
+	searcher.hasExit.assign(grid->open.size(), 0);
+	searcher.stamp = 1;
+	searcher.counts.nodes = 0;
+	searcher.counts.reachCuts = 0;
+	searcher.counts.sizeCuts = 0;
+	searcher.counts.parityCuts = 0;
+	searcher.counts.pocketCuts = 0;
+	searcher.counts.blockCuts = 0;
+
+	path.resize(1);
+	path[0].cell = grid->entryCell;
+	searcher.onPath[grid->entryCell] = 1;
+	if (!ExpandCell(searcher, *work, path[0], 0))
+		path.clear();
+
+	while (!path.empty() && !work->stop.load(memory_order_relaxed))
+	{
+		LongestFrame &frame = path.back();
+
+		//Every move from the cell has been tried, back up a cell
+		if (frame.next == frame.numMoves)
+		{
+			searcher.onPath[frame.cell] = 0;
+			path.pop_back();
+			continue;
+		}
+
+		size_t next = frame.moves[frame.next++];
+
+		searcher.counts.nodes++;
+
+		//Every so often the nodes are added to the total and the budget looked at
+		if (++unchecked == LONGEST_CHECK_NODES)
+		{
+			double seconds = chrono::duration<double>(chrono::steady_clock::now() - work->start).count();
+			StopReason reason = CheckBudget(*work->budget, seconds, work->nodes += unchecked, 0, 0);
+
+			unchecked = 0;
+			if (work->token != nullptr && work->token->IsCancelled())
+				reason = STOP_CANCELLED;
+
+			if (reason != STOP_NONE)
+			{
+				StopSearch(*work, reason, false, id);
+				break;
+			}
+
+		}//end check budget
+
+		//A path ends at the exit, it is not gone through
+		if (next == grid->exitCell)
+		{
+			if (int(path.size()) > work->best.load(memory_order_relaxed))
+				RecordPath(*work, path, grid->exitCell, upperBound, id);
+			continue;
+		}
+
+		path.push_back(LongestFrame());
+		path.back().cell = next;
+		searcher.onPath[next] = 1;
+
+		if (!ExpandCell(searcher, *work, path.back(), int(path.size()) - 1))
+		{
+			searcher.onPath[next] = 0;
+			path.pop_back();
+		}
+
+	}//end while
+
+	//Searched to the end, the longest path found by any thread is the longest there is
+	if (path.empty())
+		StopSearch(*work, STOP_NONE, true, id);
+
+	lock_guard<mutex> guard(work->lock);
+	work->totals.nodes += searcher.counts.nodes;
+	work->totals.reachCuts += searcher.counts.reachCuts;
+	work->totals.sizeCuts += searcher.counts.sizeCuts;
+	work->totals.parityCuts += searcher.counts.parityCuts;
+	work->totals.pocketCuts += searcher.counts.pocketCuts;
+	work->totals.blockCuts += searcher.counts.blockCuts;
+
+}//end LongestWorker
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, entry and exit are open cells within its bounds, threads is greater
+//		than zero, token is null or lives as long as the search
+//post: returns true to the caller if exit can be reached from entry, with moves holding the most
+//		moves of any path found from entry to exit. If the search ran to the end, stats.proven is
+//		true and no path is longer. If the seconds or nodes of budget ran out or token was cancelled
+//		first, reason says which and moves holds the longest path found by then. stats describes
+//		the search
+/*out*/bool LongestPath(								//boolean value returned to the caller
+				/*in*/Board &gb,						//board to search
+				/*in*/Location entry,					//starting location
+				/*in*/Location exit,					//location to reach
+				/*in*/int threads,						//number of threads
+				/*in*/const SearchBudget &budget,		//limits of the search
+				/*in*/const CancelToken *token,			//stops the search when cancelled
+				/*out*/vector<Direction> &moves,		//movements of the longest path found
+				/*out*/LongestStats &stats,				//description of the search
+				/*out*/StopReason &reason)				//why the search stopped early, if it did
+{
+	LongestGrid grid;
+	LongestWork work;
+	LongestSearcher root;
+	ReachableCells cells;
+	vector<thread> workers;
+	random_device device;
+	Location loc;
+
+	grid.width = size_t(gb.GetLength()) + 2;
+	grid.open.assign((size_t(gb.GetHeight()) + 2) * grid.width, 0);
+	grid.colour.assign(grid.open.size(), 0);
+	for (loc.row = 0; loc.row < gb.GetHeight(); loc.row++)
+	{
+		for (loc.col = 0; loc.col < gb.GetLength(); loc.col++)
+		{
+			size_t cell = (size_t(loc.row) + 1) * grid.width + loc.col + 1;
+
+			grid.open[cell] = gb.IsOpen(loc);
+			grid.colour[cell] = char((loc.row + loc.col) % 2);
+		}
+	}
+
+	grid.offset[NORTH] = -(long long)grid.width;
+	grid.offset[SOUTH] = (long long)grid.width;
+	grid.offset[EAST] = 1;
+	grid.offset[WEST] = -1;
+	grid.entryCell = (size_t(entry.row) + 1) * grid.width + entry.col + 1;
+	grid.exitCell = (size_t(exit.row) + 1) * grid.width + exit.col + 1;
+
+	work.best = NO_PATH;
+	work.stop = false;
+	work.reason = STOP_NONE;
+	work.budget = &budget;
+	work.token = token;
+	work.nodes = 0;
+	work.start = chrono::steady_clock::now();
+	work.totals.proven = true;
+	work.totals.upperBound = 0;
+	work.totals.provingThread = 0;
+	work.totals.nodes = 0;
+	work.totals.reachCuts = 0;
+	work.totals.sizeCuts = 0;
+	work.totals.parityCuts = 0;
+	work.totals.pocketCuts = 0;
+	work.totals.blockCuts = 0;
+	work.totals.improvements = 0;
+
+	moves.clear();
+	reason = STOP_NONE;
+
+	//The bound at the entry is the most any thread could find, and a path that long ends the search
+	root.grid = &grid;
+	root.onPath.assign(grid.open.size(), 0);
+	root.found.assign(grid.open.size(), 0);
+	root.low.assign(grid.open.size(), 0);
+	root.pending[0].assign(grid.open.size(), 0);
+	root.pending[1].assign(grid.open.size(), 0);
+	root.hasExit.assign(grid.open.size(), 0);
+	root.stamp = 1;
+	root.onPath[grid.entryCell] = 1;
+
+	if (grid.entryCell == grid.exitCell)
+		work.best = 0;
+
+	else if (FindReachable(root, grid.entryCell, cells))
+	{
+		work.totals.upperBound = int(min(cells.blockMoves, (long long)INT_MAX));
+		work.totals.proven = false;
+
+		for (int t = 0; t < threads; t++)
+			workers.push_back(thread(LongestWorker, &grid, &work, work.totals.upperBound, t, device() + unsigned(t)));
+		for (int t = 0; t < threads; t++)
+			workers[t].join();
+
+		reason = work.reason;
+
+	}//end search
+
+	//The path is kept as cells, each move is the direction from one to the next
+	for (size_t i = 1; i < work.cells.size(); i++)
+	{
+		long long step = (long long)work.cells[i] - (long long)work.cells[i - 1];
+
+		for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+		{
+			if (grid.offset[dir] == step)
+				moves.push_back(Direction(dir));
+		}
+	}
+
+	stats = work.totals;
+	stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - work.start).count();
+
+	return work.best != NO_PATH;
+
+}//end LongestPath
+
+
+/***************************************************************************************************/
+
+
+//pre: stats was filled in by LongestPath
+//post: the proof statistics of the search have been written to out
+void WriteLongestStats(	/*in*/const LongestStats &stats,	//description of the search
+						/*inout*/ostream &out)				//stream to write to
+{
+	out << "Upper bound at the entry: " << stats.upperBound << " moves" << endl;
+	out << "Cells expanded: " << stats.nodes << ", longer paths found: " << stats.improvements << endl;
+	out << "Paths cut: " << stats.reachCuts << " exit unreachable, " << stats.sizeCuts << " too few cells, "
+		<< stats.parityCuts << " parity, " << stats.pocketCuts << " pockets, " << stats.blockCuts << " blocks" << endl;
+
+	if (stats.proven)
+		out << "Proven longest by thread " << stats.provingThread << " in " << stats.seconds << " seconds" << endl;
+	else
+		out << "Not proven longest, stopped after " << stats.seconds << " seconds" << endl;
+
+}//end WriteLongestStats
@@ -0,0 +1,93 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: LongestPath.h
+Purpose: Provides the specification for the longest path solver, which finds a path from the entry to
+			the exit with the most moves without finding every path. It is a depth first search that
+			gives up on a partial path as soon as a bound on the moves it has left shows it cannot beat
+			the longest path found so far. The bound is worked out from the open cells the path could
+			still reach, each step tighter than the last:
+				the exit must still be reachable,
+				no more moves are left than there are reachable cells,
+				the board is a checkerboard and a path alternates colours, so the cells of the colour
+				there are more of can only be used about as often as those of the other, and the
+				number of moves left is odd or even as the current cell and the exit differ in colour,
+				a pocket joined to the rest through a single cell, without the exit in it, can be
+				entered but not left, so its cells are not counted at all,
+				what is left is a chain of blocks joined through single cells, and the colours bound
+				the moves across each block from the cell it is entered by to the one it is left by.
+			Moves are tried in the order most likely to find long paths early, and on many threads each
+			thread searches in an order of its own, all of them cutting with the longest path any of
+			them has found. The first thread to finish its search has proven that path the longest.
+*/
+
+#ifndef LONGESTPATH_H
+#define LONGESTPATH_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include "SearchBudget.h"		//Run limits and cancellation
+#include <ostream>				//Writing the statistics
+#include <vector>				//Path movements
+
+using namespace std;
+
+//int constants
+const long long LONGEST_CHECK_NODES = 256;		//Cells a thread expands between looks at the budget
+
+//How the longest path search went
+struct LongestStats
+{
+	bool proven;				//the search finished, so no path is longer than the one found
+	int upperBound;				//most moves any path could have, from the bound at the entry
+	int provingThread;			//thread whose search finished first, if proven
+	long long nodes;			//cells expanded by every thread
+	long long reachCuts;		//partial paths given up on as the exit could not be reached
+	long long sizeCuts;			//given up on by the count of reachable cells
+	long long parityCuts;		//given up on by the checkerboard colours of the cells
+	long long pocketCuts;		//given up on once pockets off the way to the exit were left out
+	long long blockCuts;		//given up on by the colours of each block on the way to the exit
+	long long improvements;		//times a longer path was found
+	double seconds;				//time taken
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool LongestPath(Board &gb, Location entry, Location exit, int threads, const SearchBudget &budget,
+				 const CancelToken *token, vector<Direction> &moves, LongestStats &stats, StopReason &reason);
+	Given: a board, an entry and exit point, a number of threads, a budget and a cancel token
+		-> returns true if exit can be reached, with moves holding the longest path found from entry to exit
+
+void WriteLongestStats(const LongestStats &stats, ostream &out);
+	Writes how the longest path search went
+*/
+
+
+//pre: gb is a valid gameboard, entry and exit are open cells within its bounds, threads is greater
+//		than zero, token is null or lives as long as the search
+//post: returns true to the caller if exit can be reached from entry, with moves holding the most
+//		moves of any path found from entry to exit. If the search ran to the end, stats.proven is
+//		true and no path is longer. If the seconds or nodes of budget ran out or token was cancelled
+//		first, reason says which and moves holds the longest path found by then. stats describes
+//		the search
+/*out*/bool LongestPath(								//boolean value returned to the caller
+				/*in*/Board &gb,						//board to search
+				/*in*/Location entry,					//starting location
+				/*in*/Location exit,					//location to reach
+				/*in*/int threads,						//number of threads
+				/*in*/const SearchBudget &budget,		//limits of the search
+				/*in*/const CancelToken *token,			//stops the search when cancelled
+				/*out*/vector<Direction> &moves,		//movements of the longest path found
+				/*out*/LongestStats &stats,				//description of the search
+				/*out*/StopReason &reason);				//why the search stopped early, if it did
+
+//pre: stats was filled in by LongestPath
+//post: the proof statistics of the search have been written to out
+void WriteLongestStats(	/*in*/const LongestStats &stats,	//description of the search
+						/*inout*/ostream &out);				//stream to write to
+
+#endif
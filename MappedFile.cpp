@@ -0,0 +1,168 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: MappedFile.cpp
+Purpose: Provides the implementation of a mapped file, with mmap or with a Windows file mapping.
+*/
+
+#include "MappedFile.h"
+
+#if defined(_WIN32)
+#include <windows.h>			//CreateFileMapping, MapViewOfFile
+#else
+#include <fcntl.h>				//open
+#include <sys/mman.h>			//mmap
+#include <sys/stat.h>			//fstat
+#include <unistd.h>				//close
+#endif
+
+using namespace std;
+
+
+//pre: none
+//post: a MappedFile with nothing mapped has been created
+MappedFile::MappedFile()
+{
+	data = nullptr;
+	size = 0;
+	handle = nullptr;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the file has been unmapped
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: any file mapped before has been unmapped, and fileName has been mapped read only.
+//		Returns true to the caller if it could be mapped. An empty file maps to no bytes
+/*out*/bool MappedFile::Open(/*in*/const string &fileName)	//file to map
+{
+	Close();
+
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+							  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	LARGE_INTEGER fileSize;
+
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	if (!GetFileSizeEx(file, &fileSize))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	size = size_t(fileSize.QuadPart);
+
+	//A mapping of no bytes is an error on Windows, an empty file needs none
+	if (size > 0)
+	{
+		handle = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (handle != NULL)
+			data = static_cast<const char*>(MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0));
+	}
+
+	CloseHandle(file);
+
+	if (size > 0 && data == nullptr)
+	{
+		Close();
+		return false;
+	}
+#else
+	int file = open(fileName.c_str(), O_RDONLY);
+	struct stat info;
+
+	if (file < 0)
+		return false;
+
+	if (fstat(file, &info) != 0)
+	{
+		close(file);
+		return false;
+	}
+
+	size = size_t(info.st_size);
+
+	//mmap of no bytes is an error, an empty file needs none
+	if (size > 0)
+	{
+		void *mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+
+		if (mapping != MAP_FAILED)
+			data = static_cast<const char*>(mapping);
+	}
+
+	close(file);
+
+	if (size > 0 && data == nullptr)
+	{
+		size = 0;
+		return false;
+	}
+#endif
+
+	return true;
+
+}//end Open
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the file has been unmapped
+void MappedFile::Close()
+{
+#if defined(_WIN32)
+	if (data != nullptr)
+		UnmapViewOfFile(data);
+	if (handle != nullptr)
+		CloseHandle(handle);
+#else
+	if (data != nullptr)
+		munmap(const_cast<char*>(data), size);
+#endif
+
+	data = nullptr;
+	size = 0;
+	handle = nullptr;
+
+}//end Close
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the first byte of the file has been returned to the caller, null if nothing is mapped
+/*out*/const char *MappedFile::GetData() const		//bytes of the file
+{
+	return data;
+
+}//end GetData
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the number of bytes mapped has been returned to the caller
+/*out*/size_t MappedFile::GetSize() const			//bytes in the file
+{
+	return size;
+
+}//end GetSize
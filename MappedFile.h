@@ -0,0 +1,94 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: MappedFile.h
+Purpose: Provides the specification for a MappedFile, a file mapped read only into memory. The
+			system reads in only the pages that are touched, so a look at a few bytes of a file of
+			many gigabytes costs a few pages rather than a read of the whole file.
+*/
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>				//size_t
+#include <string>				//File names
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+MappedFile();
+	Creates a MappedFile with nothing mapped
+
+~MappedFile();
+	Unmaps the file
+
+bool Open(const string &fileName);
+	Maps fileName into memory, returns false if it could not be mapped
+
+void Close();
+	Unmaps the file
+
+const char *GetData() const;
+	Returns the first byte of the file
+
+size_t GetSize() const;
+	Returns the number of bytes in the file
+*/
+
+class MappedFile
+{
+
+	public:
+
+		//pre: none
+		//post: a MappedFile with nothing mapped has been created
+		MappedFile();
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the file has been unmapped
+		~MappedFile();
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: any file mapped before has been unmapped, and fileName has been mapped read only.
+		//		Returns true to the caller if it could be mapped. An empty file maps to no bytes
+		/*out*/bool Open(/*in*/const string &fileName);	//file to map
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the file has been unmapped
+		void Close();
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the first byte of the file has been returned to the caller, null if nothing is mapped
+		/*out*/const char *GetData() const;		//bytes of the file
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the number of bytes mapped has been returned to the caller
+		/*out*/size_t GetSize() const;			//bytes in the file
+
+		/***************************************************************************************************/
+
+	private:
+
+		const char *data;				//first byte of the mapping
+		size_t size;					//bytes mapped
+		void *handle;					//file mapping object, Windows only
+
+		MappedFile(const MappedFile &);				//not copyable
+		MappedFile &operator=(const MappedFile &);	//not assignable
+};
+
+#endif
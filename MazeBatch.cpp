@@ -0,0 +1,416 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: MazeBatch.cpp
+Purpose: Provides the implementation of a maze batch.
+*/
+
+#include "MazeBatch.h"
+#include "BitBoard.h"			//CountTrailingZeros
+#include <algorithm>			//min, fill
+#include <cstdlib>				//strtol
+#include <fstream>				//Batch files
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BATCH_HAS_AVX2
+#define BATCH_AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define BATCH_HAS_AVX2
+#define BATCH_AVX2_TARGET
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+//int constants
+const int BATCH_VECTOR_CELLS = 8;		//Cells in a 256 bit vector
+
+//Grows the frontier of every lane a layer over the cells first to last: next = (west | east | north |
+//south neighbors in the frontier) & open & ~visited. visited is updated with next. Returns the lanes
+//that grew anywhere
+typedef unsigned int (*ExpandCellsFn)(const unsigned int *frontier, const unsigned int *open,
+									  unsigned int *visited, unsigned int *next, size_t first, size_t last,
+									  size_t width);
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+unsigned int ExpandCellsScalar(...);
+	Grows the frontier of every lane a cell at a time
+
+unsigned int ExpandCellsAvx2(...);
+	Grows the frontier of every lane 8 cells at a time
+
+bool ReadNumber(const string &token, int &number);
+	Reads a whole number from a token of a batch file
+*/
+
+
+//pre: every pointer holds the cells of a grid width cells wide, first is at least width
+//post: next holds the lanes added to each cell from first to last, visited has been updated. The
+//		lanes that grew anywhere are returned
+static /*out*/unsigned int ExpandCellsScalar(		//lanes that grew
+				/*in*/const unsigned int *frontier,	//lanes of each cell reached by the last layer
+				/*in*/const unsigned int *open,		//lanes each cell is open in
+				/*inout*/unsigned int *visited,		//lanes of each cell reached so far
+				/*out*/unsigned int *next,			//lanes of each cell reached by this layer
+				/*in*/size_t first,					//first cell to grow
+				/*in*/size_t last,					//one past the last cell to grow
+				/*in*/size_t width)					//cells in a row of the grid
+{
+	unsigned int any = 0;			//union of every cell added
+
+	for (size_t c = first; c < last; c++)
+	{
+		unsigned int grown = (frontier[c - 1] | frontier[c + 1] | frontier[c - width] | frontier[c + width]) &
+							 open[c] & ~visited[c];
+
+		next[c] = grown;
+		visited[c] |= grown;
+		any |= grown;
+
+	}//end for
+
+	return any;
+
+}//end ExpandCellsScalar
+
+
+/***************************************************************************************************/
+
+
+#ifdef BATCH_HAS_AVX2
+
+//pre: every pointer holds the cells of a grid width cells wide, first is at least width, and the grid
+//		holds BATCH_VECTOR_CELLS cells more than width past last
+//post: next holds the lanes added to each cell from first to last, visited has been updated. Cells
+//		past last to the end of the last vector are grown as well. The lanes that grew anywhere are
+//		returned
+BATCH_AVX2_TARGET
+static /*out*/unsigned int ExpandCellsAvx2(			//lanes that grew
+				/*in*/const unsigned int *frontier,	//lanes of each cell reached by the last layer
+				/*in*/const unsigned int *open,		//lanes each cell is open in
+				/*inout*/unsigned int *visited,		//lanes of each cell reached so far
+				/*out*/unsigned int *next,			//lanes of each cell reached by this layer
+				/*in*/size_t first,					//first cell to grow
+				/*in*/size_t last,					//one past the last cell to grow
+				/*in*/size_t width)					//cells in a row of the grid
+{
+	__m256i any = _mm256_setzero_si256();		//union of every vector added
+	unsigned int lanes[BATCH_VECTOR_CELLS];
+
+	for (size_t c = first; c < last; c += BATCH_VECTOR_CELLS)
+	{
+		__m256i west = _mm256_loadu_si256((const __m256i*)(frontier + c - 1));
+		__m256i east = _mm256_loadu_si256((const __m256i*)(frontier + c + 1));
+		__m256i north = _mm256_loadu_si256((const __m256i*)(frontier + c - width));
+		__m256i south = _mm256_loadu_si256((const __m256i*)(frontier + c + width));
+		__m256i seen = _mm256_loadu_si256((const __m256i*)(visited + c));
+		__m256i grown = _mm256_and_si256(_mm256_or_si256(_mm256_or_si256(west, east), _mm256_or_si256(north, south)),
+										 _mm256_loadu_si256((const __m256i*)(open + c)));
+		grown = _mm256_andnot_si256(seen, grown);
+
+		_mm256_storeu_si256((__m256i*)(next + c), grown);
+		_mm256_storeu_si256((__m256i*)(visited + c), _mm256_or_si256(seen, grown));
+		any = _mm256_or_si256(any, grown);
+
+	}//end for
+
+	_mm256_storeu_si256((__m256i*)lanes, any);
+	return lanes[0] | lanes[1] | lanes[2] | lanes[3] | lanes[4] | lanes[5] | lanes[6] | lanes[7];
+
+}//end ExpandCellsAvx2
+
+#endif
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: if token is a whole number, number holds it and true has been returned to the caller.
+//		Otherwise false is returned
+static /*out*/bool ReadNumber(					//boolean value returned to the caller
+				/*in*/const string &token,		//token of the file
+				/*out*/int &number)				//number read
+{
+	char *end;
+
+	number = int(strtol(token.c_str(), &end, 10));
+	return !token.empty() && *end == '\0';
+
+}//end ReadNumber
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: An empty batch with no size has been created, ready for Load
+MazeBatch::MazeBatch()
+{
+	height = 0;
+	length = 0;
+	width = 0;
+	gridCells = 0;
+	size = 0;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: height and length are greater than zero
+//post: An empty batch of mazes height x length has been created
+MazeBatch::MazeBatch(	/*in*/int inHeight,			//height of every maze
+						/*in*/int inLength)			//length of every maze
+{
+	height = inHeight;
+	length = inLength;
+	width = size_t(length) + 2;
+	gridCells = (size_t(height) + 2) * width + BATCH_VECTOR_CELLS;
+	size = 0;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: if fileName is a batch file, a line "length height" followed by each maze as a line
+//		reading BATCH_MAZE_HEADER and then its walls, a "row col" line each, the batch holds
+//		those mazes in order and true is returned to the caller. Otherwise false is returned
+/*out*/bool MazeBatch::Load(/*in*/const string &fileName)	//batch file to read
+{
+	ifstream indat(fileName.c_str());
+	vector<Location> walls;		//walls of the maze being read
+	string token;				//word of the file
+	int fileLength, fileHeight;
+	bool inMaze = false;		//a maze has been started
+	Location loc;
+
+	if (!(indat >> fileLength >> fileHeight) || fileLength <= 0 || fileHeight <= 0)
+		return false;
+
+	*this = MazeBatch(fileHeight, fileLength);
+
+	while (indat >> token)
+	{
+		//The maze read so far is complete
+		if (token == BATCH_MAZE_HEADER)
+		{
+			if (inMaze && !AddMaze(walls))
+				return false;
+
+			walls.clear();
+			inMaze = true;
+			continue;
+
+		}//end next maze
+
+		string colToken;
+
+		if (!inMaze || !ReadNumber(token, loc.row) || !(indat >> colToken) || !ReadNumber(colToken, loc.col))
+			return false;
+
+		walls.push_back(loc);
+
+	}//end while
+
+	return !inMaze || AddMaze(walls);
+
+}//end Load
+
+
+/***************************************************************************************************/
+
+
+//pre: the batch has a size
+//post: if every wall is on the board, a maze open everywhere but the walls has been added and
+//		true is returned to the caller. Otherwise the batch is unchanged and false is returned
+/*out*/bool MazeBatch::AddMaze(/*in*/const vector<Location> &walls)	//closed cells of the maze
+{
+	for (size_t i = 0; i < walls.size(); i++)
+	{
+		if (walls[i].row < 0 || walls[i].row >= height || walls[i].col < 0 || walls[i].col >= length)
+			return false;
+	}
+
+	//The first maze of a group starts a grid of its own
+	if (size % BATCH_LANES == 0)
+		open.resize(open.size() + gridCells, 0);
+
+	unsigned int *cells = &open[size_t(size / BATCH_LANES) * gridCells];
+	unsigned int lane = 1u << (size % BATCH_LANES);
+
+	for (int row = 0; row < height; row++)
+	{
+		for (int col = 0; col < length; col++)
+			cells[(size_t(row) + 1) * width + col + 1] |= lane;
+	}
+
+	for (size_t i = 0; i < walls.size(); i++)
+		cells[(size_t(walls[i].row) + 1) * width + walls[i].col + 1] &= ~lane;
+
+	size++;
+	return true;
+
+}//end AddMaze
+
+
+/***************************************************************************************************/
+
+
+//pre: the batch has a size
+//post: if gb is the size of the batch, a maze with its open cells has been added and true is
+//		returned to the caller. Otherwise the batch is unchanged and false is returned
+/*out*/bool MazeBatch::AddMaze(/*in*/Board &gb)		//board to add
+{
+	Location loc;
+
+	if (gb.GetHeight() != height || gb.GetLength() != length)
+		return false;
+
+	if (size % BATCH_LANES == 0)
+		open.resize(open.size() + gridCells, 0);
+
+	unsigned int *cells = &open[size_t(size / BATCH_LANES) * gridCells];
+	unsigned int lane = 1u << (size % BATCH_LANES);
+
+	for (loc.row = 0; loc.row < height; loc.row++)
+	{
+		for (loc.col = 0; loc.col < length; loc.col++)
+		{
+			if (gb.IsOpen(loc))
+				cells[(size_t(loc.row) + 1) * width + loc.col + 1] |= lane;
+		}
+	}
+
+	size++;
+	return true;
+
+}//end AddMaze
+
+
+/***************************************************************************************************/
+
+
+//pre: entry and exit are within the bounds of the mazes, kernel is supported
+//post: moves holds, for every maze in the order they were added, the fewest movements from entry
+//		to exit over its open cells, or UNREACHABLE
+void MazeBatch::Solve(	/*in*/Location entry,				//starting location
+						/*in*/Location exit,				//location to reach
+						/*in*/FrontierKernel kernel,		//cell expansion to use
+						/*out*/vector<int> &moves) const	//movements of each maze
+{
+	vector<unsigned int> frontier(gridCells, 0);
+	vector<unsigned int> next(gridCells, 0);
+	vector<unsigned int> visited(gridCells, 0);
+	size_t entryCell = (size_t(entry.row) + 1) * width + entry.col + 1;
+	size_t exitCell = (size_t(exit.row) + 1) * width + exit.col + 1;
+
+	moves.assign(size, UNREACHABLE);
+
+	//Entry point is the exit point, as the frontier search counts it
+	if (entryCell == exitCell)
+	{
+		moves.assign(size, 0);
+		return;
+
+	}//end single cell path
+
+	for (size_t group = 0; group * BATCH_LANES < size_t(size); group++)
+		SolveGroup(group, entryCell, exitCell, kernel, frontier, next, visited, moves);
+
+}//end Solve
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the number of mazes in the batch has been returned to the caller
+/*out*/int MazeBatch::GetSize() const			//number of mazes
+{
+	return size;
+
+}//end GetSize
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the height of the mazes has been returned to the caller
+/*out*/int MazeBatch::GetHeight() const			//height of the mazes
+{
+	return height;
+
+}//end GetHeight
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the length of the mazes has been returned to the caller
+/*out*/int MazeBatch::GetLength() const			//length of the mazes
+{
+	return length;
+
+}//end GetLength
+
+
+/***************************************************************************************************/
+
+
+//pre: group is a group of the batch
+//post: moves holds the fewest movements of every maze of the group, from index group * BATCH_LANES
+void MazeBatch::SolveGroup(	/*in*/size_t group,				//group of mazes to search
+							/*in*/size_t entryCell,			//cell of the entry point
+							/*in*/size_t exitCell,			//cell of the exit point
+							/*in*/FrontierKernel kernel,	//cell expansion to use
+							/*inout*/vector<unsigned int> &frontier,	//cells reached by the last layer
+							/*inout*/vector<unsigned int> &next,		//cells reached by this layer
+							/*inout*/vector<unsigned int> &visited,		//cells reached so far
+							/*inout*/vector<int> &moves) const			//movements of each maze
+{
+	const unsigned int *cells = &open[group * gridCells];
+	size_t firstMaze = group * BATCH_LANES;
+	int mazes = min(BATCH_LANES, size - int(firstMaze));
+	unsigned int lanes = (mazes == BATCH_LANES) ? ~0u : (1u << mazes) - 1;
+	unsigned int searching;					//lanes that have neither reached the exit nor run out of cells
+	ExpandCellsFn expand = ExpandCellsScalar;
+	int level = 0;
+
+#ifdef BATCH_HAS_AVX2
+	if (kernel == KERNEL_AVX2)
+		expand = ExpandCellsAvx2;
+#endif
+
+	fill(frontier.begin(), frontier.end(), 0u);
+	fill(visited.begin(), visited.end(), 0u);
+
+	frontier[entryCell] = cells[entryCell] & lanes;
+	visited[entryCell] = frontier[entryCell];
+	searching = frontier[entryCell];
+
+	//Every lane moves a layer at a time, and drops out once it reaches the exit or stops growing
+	while (searching != 0)
+	{
+		unsigned int grew = expand(&frontier[0], cells, &visited[0], &next[0], width, (size_t(height) + 1) * width, width);
+		unsigned int arrived = next[exitCell] & searching;
+
+		level++;
+		for (unsigned int bits = arrived; bits != 0; bits &= bits - 1)
+			moves[firstMaze + CountTrailingZeros(bits)] = level;
+
+		searching &= grew & ~arrived;
+		frontier.swap(next);
+
+	}//end while
+
+}//end SolveGroup
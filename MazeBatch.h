@@ -0,0 +1,163 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: MazeBatch.h
+Purpose: Provides the specification for a MazeBatch. A maze batch holds many mazes of the same size and
+			finds the shortest distance from the entry to the exit of every one of them at once. The
+			mazes are bit-sliced: each cell of the grid is a 32 bit word whose bit m is open if that
+			cell is open in maze m of a group of BATCH_LANES mazes, so a single instruction moves the
+			breadth first frontier of every maze of the group a step, and a 256 bit vector does it for
+			8 cells of all of them. Mazes can be added from their walls without building a Board, and
+			a whole batch read from a single file, so a maze costs neither a file of its own nor a
+			search of its own.
+*/
+
+#ifndef MAZEBATCH_H
+#define MAZEBATCH_H
+
+#include "Board.h"				//For use of a board
+#include "FrontierBfs.h"		//Kernels, UNREACHABLE
+#include "Location.h"			//Location struct
+#include <string>				//File names
+#include <vector>				//Lanes
+
+using namespace std;
+
+//int constants
+const int BATCH_LANES = 32;				//Mazes searched together, one to each bit of a cell's word
+
+//String constants
+const string BATCH_MAZE_HEADER = "MAZE";	//Line starting each maze of a batch file
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+MazeBatch();
+	Creates a new, empty MazeBatch with no size
+
+MazeBatch(int height, int length);
+	Creates a new, empty MazeBatch of mazes height x length
+
+bool Load(const string &fileName);
+	Replaces the batch with the mazes of a batch file, returns false if it could not be read
+
+bool AddMaze(const vector<Location> &walls);
+	Adds a maze with the given walls, returns false if a wall is off the board
+
+bool AddMaze(Board &gb);
+	Adds a maze with the open cells of gb, returns false if gb is not the size of the batch
+
+void Solve(Location entry, Location exit, FrontierKernel kernel, vector<int> &moves) const;
+	Finds the fewest movements from entry to exit of every maze, in the order they were added
+
+int GetSize() const;
+	Returns the number of mazes
+
+int GetHeight() const;
+	Returns the height of the mazes
+
+int GetLength() const;
+	Returns the length of the mazes
+*/
+
+class MazeBatch
+{
+
+	public:
+
+		//pre: none
+		//post: An empty batch with no size has been created, ready for Load
+		MazeBatch();
+
+		/***************************************************************************************************/
+
+		//pre: height and length are greater than zero
+		//post: An empty batch of mazes height x length has been created
+		MazeBatch(	/*in*/int height,			//height of every maze
+					/*in*/int length);			//length of every maze
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: if fileName is a batch file, a line "length height" followed by each maze as a line
+		//		reading BATCH_MAZE_HEADER and then its walls, a "row col" line each, the batch holds
+		//		those mazes in order and true is returned to the caller. Otherwise false is returned
+		/*out*/bool Load(							//boolean value returned to the caller
+					/*in*/const string &fileName);	//batch file to read
+
+		/***************************************************************************************************/
+
+		//pre: the batch has a size
+		//post: if every wall is on the board, a maze open everywhere but the walls has been added and
+		//		true is returned to the caller. Otherwise the batch is unchanged and false is returned
+		/*out*/bool AddMaze(						//boolean value returned to the caller
+					/*in*/const vector<Location> &walls);	//closed cells of the maze
+
+		/***************************************************************************************************/
+
+		//pre: the batch has a size
+		//post: if gb is the size of the batch, a maze with its open cells has been added and true is
+		//		returned to the caller. Otherwise the batch is unchanged and false is returned
+		/*out*/bool AddMaze(						//boolean value returned to the caller
+					/*in*/Board &gb);				//board to add
+
+		/***************************************************************************************************/
+
+		//pre: entry and exit are within the bounds of the mazes, kernel is supported
+		//post: moves holds, for every maze in the order they were added, the fewest movements from entry
+		//		to exit over its open cells, or UNREACHABLE
+		void Solve(	/*in*/Location entry,				//starting location
+					/*in*/Location exit,				//location to reach
+					/*in*/FrontierKernel kernel,		//cell expansion to use
+					/*out*/vector<int> &moves) const;	//movements of each maze
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the number of mazes in the batch has been returned to the caller
+		/*out*/int GetSize() const;				//number of mazes
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the height of the mazes has been returned to the caller
+		/*out*/int GetHeight() const;			//height of the mazes
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the length of the mazes has been returned to the caller
+		/*out*/int GetLength() const;			//length of the mazes
+
+		/***************************************************************************************************/
+
+	private:
+
+		//pre: group is a group of the batch
+		//post: moves holds the fewest movements of every maze of the group, from index group * BATCH_LANES
+		void SolveGroup(	/*in*/size_t group,				//group of mazes to search
+							/*in*/size_t entryCell,			//cell of the entry point
+							/*in*/size_t exitCell,			//cell of the exit point
+							/*in*/FrontierKernel kernel,	//cell expansion to use
+							/*inout*/vector<unsigned int> &frontier,	//cells reached by the last layer
+							/*inout*/vector<unsigned int> &next,		//cells reached by this layer
+							/*inout*/vector<unsigned int> &visited,		//cells reached so far
+							/*inout*/vector<int> &moves) const;			//movements of each maze
+
+		/***************************************************************************************************/
+
+		//Cells are numbered over the board with a border of closed cells, (row+1)*width+(col+1), so a
+		//neighbor is always a fixed offset away. A group's grid is followed by a few closed cells so a
+		//vector of cells never reads past it
+
+		vector<unsigned int> open;		//open cells of every group, a grid after another
+		int height;						//height of every maze
+		int length;						//length of every maze
+		size_t width;					//cols of the grid, with its border
+		size_t gridCells;				//cells of a group's grid, with its border and padding
+		int size;						//number of mazes
+};
+
+#endif
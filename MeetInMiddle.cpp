@@ -0,0 +1,519 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: MeetInMiddle.cpp
+Purpose: Provides the implementation of the meet in the middle path search.
+*/
+
+#include "MeetInMiddle.h"
+#include <string>				//Crossing keys
+#include <thread>				//Searching both sides at once
+#include <unordered_map>		//Halves by crossing key
+#include <vector>				//Grid and movements
+
+using namespace std;
+
+//Movements are attempted south, east, north, west, respectively
+const Direction MEET_ORDER[NUM_DIRECTIONS] = {SOUTH, EAST, NORTH, WEST};
+
+//Marks the end of each piece of a half kept above the cut
+const unsigned char PIECE_END = 0xFF;
+
+
+//What a half search does with each half it finds
+enum HalfMode {HALF_COUNT, HALF_STORE, HALF_JOIN};
+
+//Halves kept by the columns they cross at. A key is the crossing columns in order from the entry,
+//each as the bytes of an int
+typedef unordered_map<string, unsigned long long> HalfCounts;
+typedef unordered_map<string, vector<unsigned char> > HalfMoves;
+
+
+//The search of one side of the cut. Cells are numbered over the board with a border of closed
+//cells, (row+1)*width+(col+1), so a neighbor is always a fixed offset away
+struct HalfSearch
+{
+	vector<char> allowed;				//open cells on this side of the cut
+	vector<char> visited;				//cells on the current half
+	vector<char> crossable;				//columns open on both sides of the cut
+	long long offset[NUM_DIRECTIONS];	//index change moving in each Direction
+	size_t width;						//cols of the grid, with its border
+	int length;							//cols of the board
+	int edgeRow;						//row of this side next to the cut
+	bool below;							//searching from the exit, the side below the cut
+
+	string key;							//columns crossed at so far
+	vector<Direction> moves;			//movements of every piece so far
+	vector<size_t> pieceStarts;			//index into moves of the start of each piece
+
+	HalfMode mode;						//what is done with each half found
+	HalfCounts counts;					//halves of each key (HALF_COUNT)
+	HalfMoves halves;					//movements of the halves of each key (HALF_STORE)
+	const HalfMoves *above;				//halves above the cut to join with (HALF_JOIN)
+	PathCallback callback;				//called with each joined path (HALF_JOIN)
+	void *context;						//handed to callback (HALF_JOIN)
+	long long joined;					//paths joined (HALF_JOIN)
+	vector<Direction> path;				//movements of a joined path (HALF_JOIN)
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int CountCrossings(Board &gb, int cutRow);
+	Returns the number of columns open on both sides of a cut above cutRow
+
+void SetupHalf(Board &gb, int cutRow, bool below, HalfSearch &half);
+	Lays out one side of the cut for the search
+
+void SearchHalf(HalfSearch &half, Location start);
+	Finds every half of the side from start
+
+void VisitCell(HalfSearch &half, size_t cell);
+	Extends the current half from cell, within its piece or across the cut
+
+void CrossCut(HalfSearch &half, int col);
+	Records the half crossing the cut at col, then carries it on from every column it may come back at
+
+void RecordHalf(HalfSearch &half);
+	Counts, keeps or joins the half just found
+
+void JoinHalf(HalfSearch &half, const vector<unsigned char> &aboveMoves);
+	Joins the half just found below the cut with every half above it of the same key
+
+Direction Inverse(Direction dir);
+	Returns the movement that undoes dir
+*/
+
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~Method Prototypes~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+static void VisitCell(HalfSearch &half, size_t cell);
+static void CrossCut(HalfSearch &half, int col);
+static void RecordHalf(HalfSearch &half);
+static void JoinHalf(HalfSearch &half, const vector<unsigned char> &aboveMoves);
+static Direction Inverse(Direction dir);
+
+
+
+//pre: 0 < cutRow < gb.GetHeight()
+//post: the number of columns open in both the row above cutRow and cutRow has been returned to the caller
+static /*out*/int CountCrossings(				//number of columns
+				/*in*/Board &gb,				//board to search
+				/*in*/int cutRow)				//first row below the cut
+{
+	Location above, below;
+	int crossings = 0;
+
+	above.row = cutRow - 1;
+	below.row = cutRow;
+	for (above.col = 0; above.col < gb.GetLength(); above.col++)
+	{
+		below.col = above.col;
+		if (gb.IsOpen(above) && gb.IsOpen(below))
+			crossings++;
+	}
+
+	return crossings;
+
+}//end CountCrossings
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized, 0 < cutRow < gb.GetHeight()
+//post: half holds the open cells of gb on its side of the cut, below it if below is true, and no half
+static void SetupHalf(	/*in*/Board &gb,				//board to search
+						/*in*/int cutRow,				//first row below the cut
+						/*in*/bool below,				//side below the cut
+						/*out*/HalfSearch &half)		//side laid out for the search
+{
+	int height = gb.GetHeight();
+	int firstRow = below ? cutRow : 0;
+	int lastRow = below ? height - 1 : cutRow - 1;
+	Location loc;
+
+	half.length = gb.GetLength();
+	half.width = size_t(half.length) + 2;
+	half.allowed.assign((size_t(height) + 2) * half.width, 0);
+	half.visited.assign(half.allowed.size(), 0);
+	half.crossable.assign(half.length, 0);
+	half.edgeRow = below ? cutRow : cutRow - 1;
+	half.below = below;
+
+	for (loc.row = firstRow; loc.row <= lastRow; loc.row++)
+	{
+		for (loc.col = 0; loc.col < half.length; loc.col++)
+		{
+			if (gb.IsOpen(loc))
+				half.allowed[(size_t(loc.row) + 1) * half.width + loc.col + 1] = 1;
+		}
+	}
+
+	//A column can be crossed at if it is open on this side and the other
+	for (loc.col = 0; loc.col < half.length; loc.col++)
+	{
+		Location other;
+
+		loc.row = half.edgeRow;
+		other.row = below ? cutRow - 1 : cutRow;
+		other.col = loc.col;
+		half.crossable[loc.col] = gb.IsOpen(loc) && gb.IsOpen(other);
+	}
+
+	half.offset[NORTH] = -(long long)half.width;
+	half.offset[SOUTH] = (long long)half.width;
+	half.offset[EAST] = 1;
+	half.offset[WEST] = -1;
+
+	half.key.clear();
+	half.moves.clear();
+	half.pieceStarts.clear();
+	half.joined = 0;
+
+}//end SetupHalf
+
+
+/***************************************************************************************************/
+
+
+//pre: half has been set up, start is an open cell on its side
+//post: every half of the side starting from start has been recorded
+static void SearchHalf(	/*inout*/HalfSearch &half,		//side to search
+						/*in*/Location start)			//entry or exit point
+{
+	size_t cell = (size_t(start.row) + 1) * half.width + start.col + 1;
+
+	half.pieceStarts.push_back(0);
+	half.visited[cell] = 1;
+	VisitCell(half, cell);
+	half.visited[cell] = 0;
+	half.pieceStarts.pop_back();
+
+}//end SearchHalf
+
+
+/***************************************************************************************************/
+
+
+//pre: cell is the last cell of the current half and has been marked visited
+//post: every half carrying on from cell has been recorded, and the current half is as it was
+static void VisitCell(	/*inout*/HalfSearch &half,		//side being searched
+						/*in*/size_t cell)				//last cell of the current half
+{
+	int row = int(cell / half.width) - 1;
+	int col = int(cell % half.width) - 1;
+
+	//A piece that has just come back across the cut cannot cross it again at the same column
+	bool justCrossed = !half.key.empty() && half.moves.size() == half.pieceStarts.back();
+
+	if (row == half.edgeRow && half.crossable[col] && !justCrossed)
+		CrossCut(half, col);
+
+	for (int i = 0; i < NUM_DIRECTIONS; i++)
+	{
+		Direction dir = MEET_ORDER[i];
+		size_t next = size_t(cell + half.offset[dir]);
+
+		if (half.allowed[next] && !half.visited[next])
+		{
+			half.visited[next] = 1;
+			half.moves.push_back(dir);
+			VisitCell(half, next);
+			half.moves.pop_back();
+			half.visited[next] = 0;
+		}
+
+	}//end for
+
+}//end VisitCell
+
+
+/***************************************************************************************************/
+
+
+//pre: the current half ends in the edge row at col, which is crossable
+//post: the half crossing the cut at col has been recorded, along with every half that comes back
+//		across the cut at a column it has not visited and carries on from there
+static void CrossCut(	/*inout*/HalfSearch &half,		//side being searched
+						/*in*/int col)					//column crossed at
+{
+	size_t edgeStart = (size_t(half.edgeRow) + 1) * half.width + 1;
+
+	half.key.append((const char*)&col, sizeof(col));
+	RecordHalf(half);
+
+	for (int back = 0; back < half.length; back++)
+	{
+		size_t cell = edgeStart + back;
+
+		if (half.crossable[back] && !half.visited[cell])
+		{
+			half.key.append((const char*)&back, sizeof(back));
+			half.pieceStarts.push_back(half.moves.size());
+			half.visited[cell] = 1;
+
+			VisitCell(half, cell);
+
+			half.visited[cell] = 0;
+			half.pieceStarts.pop_back();
+			half.key.resize(half.key.size() - sizeof(back));
+		}
+
+	}//end for
+
+	half.key.resize(half.key.size() - sizeof(col));
+
+}//end CrossCut
+
+
+/***************************************************************************************************/
+
+
+//pre: the current half has just crossed the cut for the last time
+//post: the half has been counted, kept or joined as half.mode says
+static void RecordHalf(/*inout*/HalfSearch &half)		//side being searched
+{
+	string key = half.key;
+
+	//Halves below the cut cross at the columns in order from the exit, keys are kept from the entry
+	if (half.below)
+	{
+		size_t crossings = key.size() / sizeof(int);
+
+		for (size_t i = 0; i < crossings; i++)
+			key.replace(i * sizeof(int), sizeof(int), half.key, (crossings - 1 - i) * sizeof(int), sizeof(int));
+	}
+
+	if (half.mode == HALF_COUNT)
+		half.counts[key]++;
+
+	else if (half.mode == HALF_STORE)
+	{
+		vector<unsigned char> &stored = half.halves[key];
+
+		for (size_t p = 0; p < half.pieceStarts.size(); p++)
+		{
+			size_t end = p + 1 < half.pieceStarts.size() ? half.pieceStarts[p + 1] : half.moves.size();
+
+			for (size_t i = half.pieceStarts[p]; i < end; i++)
+				stored.push_back((unsigned char)half.moves[i]);
+			stored.push_back(PIECE_END);
+		}
+
+	}//end store
+
+	else
+	{
+		HalfMoves::const_iterator match = half.above->find(key);
+
+		if (match != half.above->end())
+			JoinHalf(half, match->second);
+
+	}//end join
+
+}//end RecordHalf
+
+
+/***************************************************************************************************/
+
+
+//pre: the current half is below the cut, aboveMoves holds the halves above the cut of the same key
+//post: the callback has been called with the path made of the current half and each half above
+static void JoinHalf(	/*inout*/HalfSearch &half,						//side being searched
+						/*in*/const vector<unsigned char> &aboveMoves)	//halves above the cut
+{
+	size_t numPieces = half.pieceStarts.size();
+	vector<vector<Direction> > forward(numPieces);
+	size_t at = 0;
+
+	//The pieces below were found from the exit back, piece p of the path is the last found, walked backwards
+	for (size_t p = 0; p < numPieces; p++)
+	{
+		size_t found = numPieces - 1 - p;
+		size_t start = half.pieceStarts[found];
+		size_t end = found + 1 < numPieces ? half.pieceStarts[found + 1] : half.moves.size();
+
+		for (size_t i = end; i > start; i--)
+			forward[p].push_back(Inverse(half.moves[i - 1]));
+	}
+
+	//Each half above is its pieces in order, each followed by a crossing down, the piece below and a
+	//crossing back up to the next
+	while (at < aboveMoves.size())
+	{
+		half.path.clear();
+		for (size_t p = 0; p < numPieces; p++)
+		{
+			while (aboveMoves[at] != PIECE_END)
+				half.path.push_back(Direction(aboveMoves[at++]));
+			at++;
+
+			half.path.push_back(SOUTH);
+			half.path.insert(half.path.end(), forward[p].begin(), forward[p].end());
+
+			if (p + 1 < numPieces)
+				half.path.push_back(NORTH);
+		}
+
+		half.joined++;
+		if (half.callback != NULL)
+			half.callback(&half.path[0], int(half.path.size()), half.context);
+
+	}//end while
+
+}//end JoinHalf
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the movement back the way dir came has been returned to the caller
+static /*out*/Direction Inverse(/*in*/Direction dir)	//movement to undo
+{
+	switch (dir)
+	{
+		case NORTH:	return SOUTH;
+		case SOUTH:	return NORTH;
+		case EAST:	return WEST;
+		default:	return EAST;
+	}
+
+}//end Inverse
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized
+//post: True is returned to the caller if the entry and exit are within the bounds of gb and the
+//		entry is in a row above the exit, so every row of the cut is a row of gb, false otherwise
+/*out*/bool CanMeetInMiddle(						//boolean value returned to the caller
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit)				//location to reach
+{
+	if (entry.row < 0 || entry.col < 0 || entry.col >= gb.GetLength() ||
+		exit.col < 0 || exit.col >= gb.GetLength() || exit.row >= gb.GetHeight())
+		return false;
+
+	return entry.row < exit.row;
+
+}//end CanMeetInMiddle
+
+
+/***************************************************************************************************/
+
+
+//pre: CanMeetInMiddle(gb, entry, exit)
+//post: the first row below the cut has been returned to the caller. It is the row, in the middle
+//		quarter between the entry and the exit, with the fewest columns open on both sides of the
+//		cut, the closest to the middle of those
+/*out*/int ChooseCutRow(							//first row below the cut
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit)				//location to reach
+{
+	int middle = (entry.row + exit.row + 1) / 2;
+	int span = (exit.row - entry.row) / 8;
+	int best = middle;
+	int bestCrossings = CountCrossings(gb, middle);
+
+	for (int away = 1; away <= span; away++)
+	{
+		int rows[2] = {middle - away, middle + away};
+
+		for (int i = 0; i < 2; i++)
+		{
+			if (rows[i] > entry.row && rows[i] <= exit.row)
+			{
+				int crossings = CountCrossings(gb, rows[i]);
+
+				if (crossings < bestCrossings)
+				{
+					best = rows[i];
+					bestCrossings = crossings;
+				}
+			}
+
+		}//end for
+
+	}//end for
+
+	return best;
+
+}//end ChooseCutRow
+
+
+/***************************************************************************************************/
+
+
+//pre: CanMeetInMiddle(gb, entry, exit)
+//post: the number of paths from entry to exit that visit no cell twice has been returned to the
+//		caller. The halves above and below the cut were searched at the same time
+/*out*/unsigned long long MeetCountPaths(			//number of paths
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit)				//location to reach
+{
+	int cutRow = ChooseCutRow(gb, entry, exit);
+	HalfSearch above, below;
+	unsigned long long paths = 0;
+
+	SetupHalf(gb, cutRow, false, above);
+	SetupHalf(gb, cutRow, true, below);
+	above.mode = HALF_COUNT;
+	below.mode = HALF_COUNT;
+
+	thread aboveThread(SearchHalf, ref(above), entry);
+	SearchHalf(below, exit);
+	aboveThread.join();
+
+	//Every half above makes a path with every half below of the same key
+	for (HalfCounts::const_iterator it = below.counts.begin(); it != below.counts.end(); ++it)
+	{
+		HalfCounts::const_iterator match = above.counts.find(it->first);
+
+		if (match != above.counts.end())
+			paths += match->second * it->second;
+	}
+
+	return paths;
+
+}//end MeetCountPaths
+
+
+/***************************************************************************************************/
+
+
+//pre: CanMeetInMiddle(gb, entry, exit)
+//post: callback has been called with the movements of every path from entry to exit that visits
+//		no cell twice, and the number of paths returned to the caller. Every half above the cut is
+//		kept, so this takes memory in proportion to the number of them
+/*out*/long long MeetStreamPaths(					//number of paths
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*in*/PathCallback callback,		//called with each path
+				/*in*/void *context)				//handed to callback
+{
+	int cutRow = ChooseCutRow(gb, entry, exit);
+	HalfSearch above, below;
+
+	SetupHalf(gb, cutRow, false, above);
+	above.mode = HALF_STORE;
+	SearchHalf(above, entry);
+
+	//Each half below is joined as it is found, so only the halves above are ever kept
+	SetupHalf(gb, cutRow, true, below);
+	below.mode = HALF_JOIN;
+	below.above = &above.halves;
+	below.callback = callback;
+	below.context = context;
+	SearchHalf(below, exit);
+
+	return below.joined;
+
+}//end MeetStreamPaths
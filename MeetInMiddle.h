@@ -0,0 +1,83 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: MeetInMiddle.h
+Purpose: Provides the specification for the meet in the middle path search. The board is cut between two
+			rows near the middle. Any path from the entry above the cut to the exit below it crosses the
+			cut an odd number of times, so its cells above the cut are a set of separate pieces, the
+			first starting at the entry, each ending where the path crosses down and the next starting
+			where it crosses back up. Its cells below the cut are pieces the same way, the last ending
+			at the exit. Two such halves, one from each side, make a path exactly when they cross at
+			the same columns in the same order, and every path is made of exactly one such pair. So
+			each half is searched on its own, from the entry and from the exit, and its halves are
+			kept by the columns they cross at. Each side is only about half the board, so there are
+			far fewer halves than paths, and the paths are counted by multiplying matching counts.
+*/
+
+#ifndef MEETINMIDDLE_H
+#define MEETINMIDDLE_H
+
+#include "Board.h"				//For use of a board
+#include "Location.h"			//Location struct
+#include "SmallMazeSolver.h"	//PathCallback
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool CanMeetInMiddle(Board &gb, Location entry, Location exit);
+	Returns true if entry and exit are on the board and there is a row to cut it between them at
+
+int ChooseCutRow(Board &gb, Location entry, Location exit);
+	Returns the first row below the cut, the row near the middle with the fewest columns to cross at
+
+unsigned long long MeetCountPaths(Board &gb, Location entry, Location exit);
+	Given: a board, an entry and exit point
+		-> returns the number of paths from the entry to the exit, each side searched on its own thread
+
+long long MeetStreamPaths(Board &gb, Location entry, Location exit, PathCallback callback, void *context);
+	Given: a board, an entry and exit point
+		-> calls callback with every path from the entry to the exit, returns the number of paths
+*/
+
+
+//pre: gb has been initialized
+//post: True is returned to the caller if the entry and exit are within the bounds of gb and the
+//		entry is in a row above the exit, so every row of the cut is a row of gb, false otherwise
+/*out*/bool CanMeetInMiddle(						//boolean value returned to the caller
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit);				//location to reach
+
+//pre: CanMeetInMiddle(gb, entry, exit)
+//post: the first row below the cut has been returned to the caller. It is the row, in the middle
+//		quarter between the entry and the exit, with the fewest columns open on both sides of the
+//		cut, the closest to the middle of those
+/*out*/int ChooseCutRow(							//first row below the cut
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit);				//location to reach
+
+//pre: CanMeetInMiddle(gb, entry, exit)
+//post: the number of paths from entry to exit that visit no cell twice has been returned to the
+//		caller. The halves above and below the cut were searched at the same time
+/*out*/unsigned long long MeetCountPaths(			//number of paths
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit);				//location to reach
+
+//pre: CanMeetInMiddle(gb, entry, exit)
+//post: callback has been called with the movements of every path from entry to exit that visits
+//		no cell twice, and the number of paths returned to the caller. Every half above the cut is
+//		kept, so this takes memory in proportion to the number of them
+/*out*/long long MeetStreamPaths(					//number of paths
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*in*/PathCallback callback,		//called with each path
+				/*in*/void *context);				//handed to callback
+
+#endif
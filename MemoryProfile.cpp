@@ -0,0 +1,317 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: MemoryProfile.cpp
+Purpose: Provides the implementation of memory profiling, and the operator new and delete that count
+			every allocation. Only built into the program with MAZE_MEMORY_PROFILE defined.
+*/
+
+#include "MemoryProfile.h"
+
+#ifdef MAZE_MEMORY_PROFILE
+
+#include <atomic>				//Counts shared by every thread
+#include <cstdlib>				//malloc, free
+#include <fstream>				//JSON report
+#include <iomanip>				//setw
+#include <new>					//bad_alloc
+
+#if defined(_WIN32)
+#include <windows.h>			//GetCurrentProcess
+#include <psapi.h>				//GetProcessMemoryInfo
+#else
+#include <sys/resource.h>		//getrusage
+#endif
+
+using namespace std;
+
+//Bytes in front of each allocation holding its size, keeping what follows aligned for any type
+const size_t ALLOC_HEADER = alignof(max_align_t) < sizeof(size_t) ? sizeof(size_t) : alignof(max_align_t);
+
+//Names of the phases and hooks in reports
+const char *const PHASE_NAMES[NUM_PHASES] = {"load", "search", "write"};
+const char *const HOOK_NAMES[NUM_HOOKS] = {"board", "boardCopy", "searchFrames", "solutionCopy"};
+
+
+//The counts of a single phase. Everything here is zero before main, so operator new may be
+//called before any constructor has run
+struct PhaseCounts
+{
+	atomic<long long> allocations;				//operator new calls
+	atomic<long long> frees;					//operator delete calls
+	atomic<long long> bytesAllocated;			//bytes asked for by operator new
+	atomic<long long> bytesFreed;				//bytes given back by operator delete
+	atomic<long long> peakLive;					//most bytes allocated and not freed at once
+	atomic<long long> hookCounts[NUM_HOOKS];	//allocations counted by each hook
+	atomic<long long> hookBytes[NUM_HOOKS];		//bytes counted by each hook
+	long long peakRss;							//peak resident set size by the end of the phase
+};
+
+static PhaseCounts phases[NUM_PHASES];			//counts of each phase
+static atomic<int> currentPhase;				//phase allocations are counted under
+static atomic<long long> liveBytes;				//bytes allocated and not freed
+static atomic<long long> peakLiveBytes;			//most bytes allocated and not freed at once
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+long long PeakRss();
+	Returns the peak resident set size of the process in bytes
+
+void RaisePeak(atomic<long long> &peak, long long value);
+	Raises peak to value if it is lower
+
+void *CountedNew(size_t bytes);
+	Allocates bytes with their size in front and counts them
+
+void CountedDelete(void *memory);
+	Counts and frees memory from CountedNew
+*/
+
+
+//pre: none
+//post: the most memory the process has had resident at once, in bytes, has been returned to the caller
+static /*out*/long long PeakRss()					//bytes returned to the caller
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters;
+
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+		return 0;
+	return (long long)counters.PeakWorkingSetSize;
+#else
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+#if defined(__APPLE__)
+	return (long long)usage.ru_maxrss;
+#else
+	return (long long)usage.ru_maxrss * 1024;
+#endif
+#endif
+
+}//end PeakRss
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: peak is at least value
+static void RaisePeak(	/*inout*/atomic<long long> &peak,	//peak to raise
+						/*in*/long long value)				//value reached
+{
+	long long seen = peak.load(memory_order_relaxed);
+
+	while (seen < value && !peak.compare_exchange_weak(seen, value, memory_order_relaxed))
+		;
+
+}//end RaisePeak
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: bytes of memory have been allocated and counted under the current phase, and a pointer to
+//		them returned to the caller. Throws bad_alloc if there is not enough memory
+static /*out*/void *CountedNew(/*in*/size_t bytes)		//bytes to allocate
+{
+	char *block = static_cast<char*>(malloc(bytes + ALLOC_HEADER));
+	PhaseCounts &counts = phases[currentPhase.load(memory_order_relaxed)];
+
+	if (block == NULL)
+		throw bad_alloc();
+
+	*reinterpret_cast<size_t*>(block) = bytes;
+
+	long long live = liveBytes.fetch_add((long long)bytes, memory_order_relaxed) + (long long)bytes;
+
+	counts.allocations.fetch_add(1, memory_order_relaxed);
+	counts.bytesAllocated.fetch_add((long long)bytes, memory_order_relaxed);
+	RaisePeak(counts.peakLive, live);
+	RaisePeak(peakLiveBytes, live);
+
+	return block + ALLOC_HEADER;
+
+}//end CountedNew
+
+
+/***************************************************************************************************/
+
+
+//pre: memory is null or was returned by CountedNew and not yet freed
+//post: memory has been counted under the current phase and freed
+static void CountedDelete(/*in*/void *memory)		//memory to free
+{
+	if (memory == NULL)
+		return;
+
+	char *block = static_cast<char*>(memory) - ALLOC_HEADER;
+	size_t bytes = *reinterpret_cast<size_t*>(block);
+	PhaseCounts &counts = phases[currentPhase.load(memory_order_relaxed)];
+
+	liveBytes.fetch_sub((long long)bytes, memory_order_relaxed);
+	counts.frees.fetch_add(1, memory_order_relaxed);
+	counts.bytesFreed.fetch_add((long long)bytes, memory_order_relaxed);
+	free(block);
+
+}//end CountedDelete
+
+
+/***************************************************************************************************/
+
+
+//Every allocation of the program goes through these
+void *operator new(size_t bytes)								{ return CountedNew(bytes); }
+void *operator new[](size_t bytes)								{ return CountedNew(bytes); }
+void operator delete(void *memory) noexcept						{ CountedDelete(memory); }
+void operator delete[](void *memory) noexcept					{ CountedDelete(memory); }
+
+//The size of the block is read from its header, the one passed in is not needed
+void operator delete(void *memory, size_t) noexcept				{ CountedDelete(memory); }
+void operator delete[](void *memory, size_t) noexcept			{ CountedDelete(memory); }
+
+void *operator new(size_t bytes, const nothrow_t &) noexcept
+{
+	try { return CountedNew(bytes); } catch (...) { return NULL; }
+}
+
+void *operator new[](size_t bytes, const nothrow_t &) noexcept
+{
+	try { return CountedNew(bytes); } catch (...) { return NULL; }
+}
+
+void operator delete(void *memory, const nothrow_t &) noexcept		{ CountedDelete(memory); }
+void operator delete[](void *memory, const nothrow_t &) noexcept	{ CountedDelete(memory); }
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: true has been returned to the caller
+/*out*/bool IsMemoryProfiled()					//boolean value returned to the caller
+{
+	return true;
+
+}//end IsMemoryProfiled
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the peak resident set size of the current phase has been sampled, and the allocations from
+//		now on, on any thread, are counted under phase
+void SetMemoryPhase(/*in*/MemoryPhase phase)		//phase starting
+{
+	phases[currentPhase.load()].peakRss = PeakRss();
+	currentPhase.store(int(phase));
+
+}//end SetMemoryPhase
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: an allocation of bytes at hook has been counted under the current phase
+void CountAllocation(	/*in*/MemoryHook hook,		//place allocating
+						/*in*/size_t bytes)			//bytes allocated
+{
+	PhaseCounts &counts = phases[currentPhase.load(memory_order_relaxed)];
+
+	counts.hookCounts[hook].fetch_add(1, memory_order_relaxed);
+	counts.hookBytes[hook].fetch_add((long long)bytes, memory_order_relaxed);
+
+}//end CountAllocation
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the allocations, frees and bytes of each phase, the live and peak bytes, the peak resident
+//		set size by the end of each phase and the counts of each hook have been written to out
+void WriteMemoryReport(/*inout*/ostream &out)		//stream to write to
+{
+	phases[currentPhase.load()].peakRss = PeakRss();
+
+	out << left << setw(14) << "phase" << right << setw(14) << "allocations" << setw(14) << "frees"
+		<< setw(16) << "bytes" << setw(16) << "peak live" << setw(16) << "peak rss" << endl;
+
+	for (int p = 0; p < NUM_PHASES; p++)
+	{
+		out << left << setw(14) << PHASE_NAMES[p] << right
+			<< setw(14) << phases[p].allocations.load() << setw(14) << phases[p].frees.load()
+			<< setw(16) << phases[p].bytesAllocated.load() << setw(16) << phases[p].peakLive.load()
+			<< setw(16) << phases[p].peakRss << endl;
+	}
+
+	out << endl << left << setw(14) << "hook";
+	for (int p = 0; p < NUM_PHASES; p++)
+		out << right << setw(14) << PHASE_NAMES[p] << setw(16) << "bytes";
+	out << endl;
+
+	for (int h = 0; h < NUM_HOOKS; h++)
+	{
+		out << left << setw(14) << HOOK_NAMES[h] << right;
+		for (int p = 0; p < NUM_PHASES; p++)
+			out << setw(14) << phases[p].hookCounts[h].load() << setw(16) << phases[p].hookBytes[h].load();
+		out << endl;
+	}
+
+	out << endl << "live bytes " << liveBytes.load() << ", peak live bytes " << peakLiveBytes.load() << endl;
+
+}//end WriteMemoryReport
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the same counts as WriteMemoryReport have been written to fileName as JSON. Returns true
+//		to the caller if it could be written
+/*out*/bool WriteMemoryJson(/*in*/const string &fileName)	//file to write
+{
+	ofstream out(fileName.c_str());
+
+	phases[currentPhase.load()].peakRss = PeakRss();
+
+	out << "{" << endl << "  \"phases\": {" << endl;
+	for (int p = 0; p < NUM_PHASES; p++)
+	{
+		out << "    \"" << PHASE_NAMES[p] << "\": {"
+			<< "\"allocations\": " << phases[p].allocations.load()
+			<< ", \"frees\": " << phases[p].frees.load()
+			<< ", \"bytesAllocated\": " << phases[p].bytesAllocated.load()
+			<< ", \"bytesFreed\": " << phases[p].bytesFreed.load()
+			<< ", \"peakLiveBytes\": " << phases[p].peakLive.load()
+			<< ", \"peakRssBytes\": " << phases[p].peakRss
+			<< ", \"hooks\": {";
+
+		for (int h = 0; h < NUM_HOOKS; h++)
+		{
+			out << (h > 0 ? ", " : "") << "\"" << HOOK_NAMES[h] << "\": {\"count\": "
+				<< phases[p].hookCounts[h].load() << ", \"bytes\": " << phases[p].hookBytes[h].load() << "}";
+		}
+
+		out << "}}" << (p + 1 < NUM_PHASES ? "," : "") << endl;
+
+	}//end for
+
+	out << "  }," << endl
+		<< "  \"liveBytes\": " << liveBytes.load() << "," << endl
+		<< "  \"peakLiveBytes\": " << peakLiveBytes.load() << endl
+		<< "}" << endl;
+
+	out.close();
+	return !out.fail();
+
+}//end WriteMemoryJson
+
+#endif
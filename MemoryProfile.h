@@ -0,0 +1,91 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: MemoryProfile.h
+Purpose: Provides the specification for memory profiling. Built with MAZE_MEMORY_PROFILE defined, every
+			operator new and delete of the program is counted, along with the live and peak bytes, and
+			the places that allocate the most (each Board and its copies, each growth of the search's
+			frames, each ring slot or spilled record of the writer grown to hold a solution) count
+			themselves as well. The counts are kept for each phase of the run, and the peak resident set size is
+			sampled as each phase ends, so a report shows which of loading, searching and writing the
+			memory went to. Built without it, every call here is empty and the allocators are the
+			standard ones.
+*/
+
+#ifndef MEMORYPROFILE_H
+#define MEMORYPROFILE_H
+
+#include <cstddef>				//size_t
+#include <ostream>				//Reports
+#include <string>				//File names
+
+using namespace std;
+
+//String constants
+const string MEMORY_OUT = "memory.json";		//Report of the memory profile, for comparing runs
+
+//Parts of a run memory is counted under
+enum MemoryPhase {PHASE_LOAD, PHASE_SEARCH, PHASE_WRITE, NUM_PHASES};
+
+//Places that count their own allocations
+enum MemoryHook {HOOK_BOARD, HOOK_BOARD_COPY, HOOK_SEARCH_FRAMES, HOOK_SOLUTION_COPY, NUM_HOOKS};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool IsMemoryProfiled();
+	Returns true if the program was built with MAZE_MEMORY_PROFILE
+
+void SetMemoryPhase(MemoryPhase phase);
+	Ends the current phase and counts everything after under phase
+
+void CountAllocation(MemoryHook hook, size_t bytes);
+	Counts an allocation of bytes made at hook
+
+void WriteMemoryReport(ostream &out);
+	Writes the counts of each phase and hook as a table
+
+bool WriteMemoryJson(const string &fileName);
+	Writes the counts of each phase and hook to fileName as JSON
+*/
+
+#ifdef MAZE_MEMORY_PROFILE
+
+//pre: none
+//post: true has been returned to the caller
+/*out*/bool IsMemoryProfiled();					//boolean value returned to the caller
+
+//pre: none
+//post: the peak resident set size of the current phase has been sampled, and the allocations from
+//		now on, on any thread, are counted under phase
+void SetMemoryPhase(/*in*/MemoryPhase phase);		//phase starting
+
+//pre: none
+//post: an allocation of bytes at hook has been counted under the current phase
+void CountAllocation(	/*in*/MemoryHook hook,		//place allocating
+						/*in*/size_t bytes);		//bytes allocated
+
+//pre: none
+//post: the allocations, frees and bytes of each phase, the live and peak bytes, the peak resident
+//		set size by the end of each phase and the counts of each hook have been written to out
+void WriteMemoryReport(/*inout*/ostream &out);		//stream to write to
+
+//pre: none
+//post: the same counts as WriteMemoryReport have been written to fileName as JSON. Returns true
+//		to the caller if it could be written
+/*out*/bool WriteMemoryJson(/*in*/const string &fileName);	//file to write
+
+#else
+
+//Without MAZE_MEMORY_PROFILE nothing is counted and these do nothing
+inline bool IsMemoryProfiled()										{ return false; }
+inline void SetMemoryPhase(MemoryPhase)								{}
+inline void CountAllocation(MemoryHook, size_t)						{}
+inline void WriteMemoryReport(ostream &)							{}
+inline bool WriteMemoryJson(const string &)							{ return true; }
+
+#endif
+
+#endif
@@ -0,0 +1,510 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Options.cpp
+Purpose: Provides the implementation for reading the command line options of the program.
+*/
+
+#include "Options.h"
+#include <cstdlib>				//atoi, atoll
+#include <thread>				//hardware_concurrency
+
+using namespace std;
+
+
+//pre: argv holds argc command line arguments
+//post: options holds the settings given on the command line, or their defaults.
+//		Returns true to the caller if the command line was valid, false otherwise
+/*out*/bool ParseOptions(						//boolean value returned to the caller
+				/*in*/int argc,					//number of command line arguments
+				/*in*/char *argv[],				//command line arguments
+				/*out*/RunOptions &options)		//settings for the run
+{
+	options.mazeFile = "";
+	options.benchmark = false;
+	options.benchSize = DEFAULT_BENCH_SIZE;
+	options.shortest = false;
+	options.ringSize = DEFAULT_RING_SIZE;
+	options.backpressure = BACKPRESSURE_BLOCK;
+	options.threads = int(thread::hardware_concurrency());
+	options.checkpoint = false;
+	options.checkpointFile = DEFAULT_CHECKPOINT_FILE;
+	options.checkpointSecs = 0;
+	options.checkpointNodes = 0;
+	options.resume = false;
+	options.shard = 0;
+	options.numShards = 0;
+	options.merge = false;
+	options.tiledFile = "";
+	options.tileCacheMb = DEFAULT_TILE_CACHE_MB;
+	options.hpa = false;
+	options.clusterSize = DEFAULT_CLUSTER_SIZE;
+	options.renderFile = "";
+	options.heatmap = false;
+	options.stats = false;
+	options.meet = false;
+	options.meetCount = false;
+	options.estimate = false;
+	options.estimateMethod = ESTIMATE_SIS;
+	options.estimateSecs = DEFAULT_ESTIMATE_SECS;
+	options.budget.seconds = 0;
+	options.budget.nodes = 0;
+	options.budget.solutions = 0;
+	options.budget.bytes = 0;
+	options.cacheDir = "";
+	options.cacheMb = DEFAULT_CACHE_MB;
+	options.indexStride = DEFAULT_INDEX_STRIDE;
+	options.pathFirst = 0;
+	options.pathLast = 0;
+	options.longest = false;
+	options.kShortest = 0;
+	options.maxMoves = 0;
+	options.maxMovesPercent = 0;
+	options.batchFile = "";
+	options.progressSecs = 0;
+	options.progressFile = "";
+	options.gridFile = "";
+
+	if (options.threads <= 0)
+		options.threads = 1;
+
+	for (int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+
+		if (arg == "--bench")
+		{
+			options.benchmark = true;
+
+			//Board size is optional
+			if (i + 1 < argc && argv[i + 1][0] != '-')
+			{
+				options.benchSize = atoi(argv[++i]);
+				if (options.benchSize <= 0)
+					return false;
+			}
+
+		}//end benchmark
+
+		else if (arg == "--shortest")
+		{
+			options.shortest = true;
+
+		}//end shortest path
+
+		else if (arg == "--threads" && i + 1 < argc)
+		{
+			options.threads = atoi(argv[++i]);
+			if (options.threads <= 0)
+				return false;
+
+		}//end threads
+
+		else if (arg == "--ring" && i + 1 < argc)
+		{
+			options.ringSize = atoi(argv[++i]);
+			if (options.ringSize <= 0)
+				return false;
+
+		}//end ring size
+
+		else if (arg == "--backpressure" && i + 1 < argc)
+		{
+			string policy = argv[++i];
+
+			if (policy == "block")
+				options.backpressure = BACKPRESSURE_BLOCK;
+			else if (policy == "spill")
+				options.backpressure = BACKPRESSURE_SPILL;
+			else
+				return false;
+
+		}//end backpressure
+
+		else if (arg == "--checkpoint" && i + 1 < argc)
+		{
+			options.checkpoint = true;
+			options.checkpointFile = argv[++i];
+
+		}//end checkpoint file
+
+		else if (arg == "--checkpoint-secs" && i + 1 < argc)
+		{
+			options.checkpoint = true;
+			options.checkpointSecs = atoi(argv[++i]);
+			if (options.checkpointSecs <= 0)
+				return false;
+
+		}//end checkpoint seconds
+
+		else if (arg == "--checkpoint-nodes" && i + 1 < argc)
+		{
+			options.checkpoint = true;
+			options.checkpointNodes = atoll(argv[++i]);
+			if (options.checkpointNodes <= 0)
+				return false;
+
+		}//end checkpoint nodes
+
+		else if (arg == "--resume")
+		{
+			options.checkpoint = true;
+			options.resume = true;
+
+		}//end resume
+
+		else if (arg == "--shard" && i + 1 < argc)
+		{
+			string shard = argv[++i];
+			size_t slash = shard.find('/');
+
+			if (slash == string::npos)
+				return false;
+
+			options.shard = atoi(shard.substr(0, slash).c_str());
+			options.numShards = atoi(shard.substr(slash + 1).c_str());
+			if (options.numShards <= 0 || options.shard < 0 || options.shard >= options.numShards)
+				return false;
+
+		}//end shard
+
+		else if (arg == "--merge" && i + 1 < argc)
+		{
+			options.merge = true;
+			options.numShards = atoi(argv[++i]);
+			if (options.numShards <= 0)
+				return false;
+
+		}//end merge
+
+		else if (arg == "--tiled" && i + 1 < argc)
+		{
+			options.tiledFile = argv[++i];
+
+		}//end tiled board
+
+		else if (arg == "--tile-cache-mb" && i + 1 < argc)
+		{
+			int megabytes = atoi(argv[++i]);
+			if (megabytes <= 0)
+				return false;
+			options.tileCacheMb = size_t(megabytes);
+
+		}//end tile cache
+
+		else if (arg == "--hpa")
+		{
+			options.hpa = true;
+
+		}//end hierarchical path
+
+		else if (arg == "--cluster" && i + 1 < argc)
+		{
+			options.clusterSize = atoi(argv[++i]);
+			if (options.clusterSize <= 0)
+				return false;
+
+		}//end cluster size
+
+		else if (arg == "--render" && i + 1 < argc)
+		{
+			options.renderFile = argv[++i];
+
+		}//end render
+
+		else if (arg == "--heatmap")
+		{
+			options.heatmap = true;
+
+		}//end heatmap
+
+		else if (arg == "--stats")
+		{
+			options.stats = true;
+
+		}//end statistics
+
+		else if (arg == "--meet")
+		{
+			options.meet = true;
+
+		}//end meet in the middle
+
+		else if (arg == "--count")
+		{
+			options.meetCount = true;
+
+		}//end count only
+
+		else if (arg == "--estimate")
+		{
+			options.estimate = true;
+
+			//Method is optional
+			if (i + 1 < argc && string(argv[i + 1]) == "knuth")
+			{
+				options.estimateMethod = ESTIMATE_KNUTH;
+				i++;
+			}
+			else if (i + 1 < argc && string(argv[i + 1]) == "sis")
+			{
+				options.estimateMethod = ESTIMATE_SIS;
+				i++;
+			}
+
+		}//end estimate
+
+		else if (arg == "--estimate-secs" && i + 1 < argc)
+		{
+			options.estimateSecs = atoi(argv[++i]);
+			if (options.estimateSecs <= 0)
+				return false;
+
+		}//end estimate time
+
+		else if (arg == "--max-secs" && i + 1 < argc)
+		{
+			options.budget.seconds = atoi(argv[++i]);
+			if (options.budget.seconds <= 0)
+				return false;
+
+		}//end time limit
+
+		else if (arg == "--max-nodes" && i + 1 < argc)
+		{
+			options.budget.nodes = atoll(argv[++i]);
+			if (options.budget.nodes <= 0)
+				return false;
+
+		}//end node limit
+
+		else if (arg == "--max-solutions" && i + 1 < argc)
+		{
+			options.budget.solutions = atoll(argv[++i]);
+			if (options.budget.solutions <= 0)
+				return false;
+
+		}//end solution limit
+
+		else if (arg == "--max-bytes" && i + 1 < argc)
+		{
+			options.budget.bytes = atoll(argv[++i]);
+			if (options.budget.bytes <= 0)
+				return false;
+
+		}//end output limit
+
+		else if (arg == "--cache" && i + 1 < argc)
+		{
+			options.cacheDir = argv[++i];
+
+		}//end result cache
+
+		else if (arg == "--cache-mb" && i + 1 < argc)
+		{
+			options.cacheMb = atoi(argv[++i]);
+			if (options.cacheMb <= 0)
+				return false;
+
+		}//end cache size
+
+		else if (arg == "--index-stride" && i + 1 < argc)
+		{
+			options.indexStride = atoi(argv[++i]);
+			if (options.indexStride < 0)
+				return false;
+
+		}//end index stride
+
+		else if (arg == "--path" && i + 1 < argc)
+		{
+			string range = argv[++i];
+			size_t dash = range.find('-');
+
+			options.pathFirst = atoll(range.substr(0, dash).c_str());
+			options.pathLast = dash == string::npos ? options.pathFirst : atoll(range.substr(dash + 1).c_str());
+			if (options.pathFirst <= 0 || options.pathLast < options.pathFirst)
+				return false;
+
+		}//end path query
+
+		else if (arg == "--longest")
+		{
+			options.longest = true;
+
+		}//end longest path
+
+		else if (arg == "--k-shortest" && i + 1 < argc)
+		{
+			options.kShortest = atoi(argv[++i]);
+			if (options.kShortest <= 0)
+				return false;
+
+		}//end k shortest paths
+
+		else if (arg == "--max-moves" && i + 1 < argc)
+		{
+			string limit = argv[++i];
+
+			//A percent is of the shortest path's movements, known once the maze has been read
+			if (!limit.empty() && limit[limit.size() - 1] == '%')
+			{
+				options.maxMovesPercent = atoi(limit.c_str());
+				if (options.maxMovesPercent < 100)
+					return false;
+			}
+			else
+			{
+				options.maxMoves = atoi(limit.c_str());
+				if (options.maxMoves <= 0)
+					return false;
+			}
+
+		}//end length limit
+
+		else if (arg == "--batch" && i + 1 < argc)
+		{
+			options.batchFile = argv[++i];
+
+		}//end maze batch
+
+		else if (arg == "--progress" && i + 1 < argc)
+		{
+			options.progressSecs = atoi(argv[++i]);
+			if (options.progressSecs <= 0)
+				return false;
+
+		}//end progress
+
+		else if (arg == "--progress-file" && i + 1 < argc)
+		{
+			options.progressFile = argv[++i];
+
+		}//end progress file
+
+		else if (arg == "--grid" && i + 1 < argc)
+		{
+			options.gridFile = argv[++i];
+
+		}//end grid
+
+		else if (arg[0] != '-' && options.mazeFile.empty())
+		{
+			options.mazeFile = arg;
+
+		}//end maze file
+
+		else
+		{
+			return false;
+
+		}//end unknown option
+
+	}//end for
+
+	//Checkpoints were asked for without saying how often
+	if (options.checkpoint && options.checkpointSecs == 0 && options.checkpointNodes == 0)
+		options.checkpointSecs = DEFAULT_CHECKPOINT_SECS;
+
+	//A progress file was asked for without saying how often
+	if (!options.progressFile.empty() && options.progressSecs == 0)
+		options.progressSecs = DEFAULT_PROGRESS_SECS;
+
+	//Checkpoints and shards only cover the exhaustive search
+	if ((options.checkpoint || options.numShards > 0) && (options.shortest || options.benchmark || options.hpa))
+		return false;
+
+	//Statistics are counted over the whole search by every thread at once
+	if (options.stats && (options.checkpoint || options.numShards > 0 || options.shortest || options.hpa))
+		return false;
+
+	//The meet in the middle search has its own order of paths, and counting only applies to it
+	if (options.meet && (options.checkpoint || options.numShards > 0 || options.shortest || options.hpa || options.stats))
+		return false;
+
+	if (options.meetCount && !options.meet)
+		return false;
+
+	//An estimate finds no paths, so nothing else can be done with them
+	if (options.estimate && (options.checkpoint || options.numShards > 0 || options.shortest || options.hpa ||
+							 options.stats || options.meet))
+		return false;
+
+	//A longest path is a single path of its own search, which only a time or node budget can cut short
+	if (options.longest && (options.checkpoint || options.numShards > 0 || options.shortest || options.hpa ||
+							options.stats || options.meet || options.estimate || options.budget.solutions > 0 ||
+							options.budget.bytes > 0))
+		return false;
+
+	//So are the k shortest paths, handed back cheapest first
+	if (options.kShortest > 0 && (options.checkpoint || options.numShards > 0 || options.shortest || options.hpa ||
+								  options.stats || options.meet || options.estimate || options.longest ||
+								  options.budget.solutions > 0 || options.budget.bytes > 0))
+		return false;
+
+	//A length limit cuts the exhaustive search on a single stack, whose checkpoints and shards know
+	//nothing of it
+	if ((options.maxMoves > 0 || options.maxMovesPercent > 0) &&
+		(options.checkpoint || options.numShards > 0 || options.shortest || options.hpa || options.stats ||
+		 options.meet || options.estimate || options.longest || options.kShortest > 0 || !options.tiledFile.empty()))
+		return false;
+
+	//Budgets limit the exhaustive search, the other solvers finish quickly or have limits of their own
+	if (HasBudget(options.budget) && (options.shortest || options.benchmark || options.hpa || options.stats ||
+									  options.meet || options.estimate || options.merge || !options.tiledFile.empty()))
+		return false;
+
+	//Only complete results of the exhaustive search, the meet in the middle search and the
+	//statistics are cached, the rest are quick to find again or change from run to run
+	if (!options.cacheDir.empty() && (options.checkpoint || options.numShards > 0 || HasBudget(options.budget) ||
+									   options.shortest || options.hpa || options.estimate || options.longest ||
+									   options.kShortest > 0 || !options.renderFile.empty()))
+		return false;
+
+	//Paths are looked up in the solution file of an earlier run, nothing is solved
+	if (options.pathFirst > 0 && (!options.mazeFile.empty() || options.merge || options.benchmark ||
+								  !options.tiledFile.empty()))
+		return false;
+
+	if (options.merge && (options.checkpoint || !options.mazeFile.empty()))
+		return false;
+
+	//The heatmap is drawn into the image
+	if (options.heatmap && options.renderFile.empty())
+		return false;
+
+	//A batch file holds every maze of the run, and only the shortest distances of them are found
+	if (!options.batchFile.empty() && (!options.mazeFile.empty() || options.benchmark || options.merge ||
+									   !options.tiledFile.empty() || options.pathFirst > 0))
+		return false;
+
+	//Progress is only sampled from the exhaustive search, the other solvers report when they finish
+	if (options.progressSecs > 0 && (options.shortest || options.benchmark || options.hpa || options.stats ||
+									 options.meet || options.estimate || options.merge || options.longest ||
+									 options.kShortest > 0 || !options.tiledFile.empty() ||
+									 !options.batchFile.empty() || options.pathFirst > 0))
+		return false;
+
+	//A tiled board only has the shortest path and reachability solvers
+	if (!options.tiledFile.empty() && (options.checkpoint || options.numShards > 0 || options.longest ||
+								   options.kShortest > 0))
+		return false;
+
+	//A grid file holds a maze of its own, and only has the shortest path and every path found in it.
+	//Its paths are written straight to the file a block at a time, with no writer queue, index or
+	//checkpoint behind them, so the options of those are refused rather than ignored
+	if (!options.gridFile.empty() && (!options.mazeFile.empty() || options.benchmark || options.merge ||
+									  options.checkpoint || options.resume || options.numShards > 0 ||
+									  !options.tiledFile.empty() || options.hpa || !options.renderFile.empty() ||
+									  options.stats || options.meet || options.estimate || !options.cacheDir.empty() ||
+									  options.pathFirst > 0 || options.longest || options.kShortest > 0 ||
+									  options.maxMoves > 0 || options.maxMovesPercent > 0 ||
+									  !options.batchFile.empty() || options.progressSecs > 0 ||
+									  options.ringSize != DEFAULT_RING_SIZE || options.backpressure != BACKPRESSURE_BLOCK ||
+									  options.indexStride != DEFAULT_INDEX_STRIDE))
+		return false;
+
+	return true;
+
+}//end ParseOptions
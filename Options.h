@@ -0,0 +1,108 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Options.h
+Purpose: Provides the specification for the command line options of the program. With no options the
+			program prompts for the name of a maze file, as it always has.
+*/
+
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include "AsyncWriter.h"		//Backpressure policies
+#include "Checkpoint.h"			//Default checkpoint file
+#include "HpaGraph.h"			//Default cluster size
+#include "PathEstimator.h"		//Estimate methods
+#include "ProgressReporter.h"	//Default progress interval
+#include "ResultCache.h"		//Default cache size
+#include "SolutionIndex.h"		//Default index stride
+#include "SearchBudget.h"		//Run limits
+#include "TiledBoard.h"			//Default tile cache size
+#include <string>				//File names
+
+using namespace std;
+
+//int constants
+const int DEFAULT_BENCH_SIZE = 2048;								//Default benchmark board size
+const int DEFAULT_CHECKPOINT_SECS = 60;								//Default seconds between checkpoints
+
+//String constants
+const string USAGE = "Usage: maze [mazefile] [--bench [size]] [--shortest] [--threads n] "
+					"[--ring n] [--backpressure block|spill] [--checkpoint file] "
+					"[--checkpoint-secs s] [--checkpoint-nodes n] [--resume] "
+					"[--shard i/n] [--merge n] [--tiled file] [--tile-cache-mb n] "
+					"[--hpa] [--cluster n] [--render file] [--heatmap] [--stats] "
+					"[--meet] [--count] [--estimate [knuth|sis]] [--estimate-secs s] "
+					"[--max-secs s] [--max-nodes n] [--max-solutions n] [--max-bytes n] "
+					"[--cache dir] [--cache-mb n] "
+					"[--index-stride n] [--path n[-m]] [--longest] [--k-shortest k] "
+					"[--max-moves n|p%] [--batch file] [--progress s] [--progress-file file] "
+					"[--grid file]";	//Command line usage
+
+
+//Settings for a single run of the program
+struct RunOptions
+{
+	string mazeFile;		//maze file named on the command line, empty to prompt for one
+	bool benchmark;			//run the benchmarks instead of solving a maze
+	int benchSize;			//height and length of the benchmark board
+	bool shortest;			//find a single shortest path instead of every path
+	int threads;			//number of threads for the parallel solvers
+	int ringSize;			//number of solutions queued between the search and the writer
+	Backpressure backpressure;	//what the search does when the queue is full
+	bool checkpoint;		//save checkpoints of an exhaustive search
+	string checkpointFile;	//file checkpoints are saved to and resumed from
+	int checkpointSecs;		//seconds between checkpoints, zero for none by time
+	long long checkpointNodes;	//expanded cells between checkpoints, zero for none by count
+	bool resume;			//carry on the search saved in the checkpoint file
+	int shard;				//shard of the exhaustive search to run
+	int numShards;			//number of shards, zero to run the whole search
+	bool merge;				//merge the output of numShards shards instead of solving a maze
+	string tiledFile;		//tiled board file to solve, or to write the maze file to first
+	size_t tileCacheMb;		//megabytes of tiles the tiled solvers hold in memory
+	bool hpa;				//find a single path through the cached cluster graph
+	int clusterSize;		//rows and cols of cells in each cluster of the graph
+	string renderFile;		//image file to draw the maze to, empty for none
+	bool heatmap;			//colour the image by each cell's distance from the entry, or solutions through it
+	bool stats;				//count the solutions instead of writing them
+	bool meet;				//find every path by joining halves searched from the entry and the exit
+	bool meetCount;			//only count the paths of the meet in the middle search
+	bool estimate;			//estimate the number of paths instead of finding them
+	EstimateMethod estimateMethod;	//how the estimate's probes choose their moves
+	int estimateSecs;		//most seconds the estimate may run for
+	SearchBudget budget;	//limits of the exhaustive search, after which it stops with what it found
+	string cacheDir;		//directory of the results of mazes solved before, empty for none
+	int cacheMb;			//megabytes of results the cache keeps
+	int indexStride;		//paths between entries of the solution file's index, zero for no index
+	long long pathFirst;	//first path to print from the solution file instead of solving, zero for none
+	long long pathLast;		//last path to print from the solution file
+	bool longest;			//find a single longest path instead of every path
+	int kShortest;			//number of cheapest paths to find instead of every path, zero for every path
+	int maxMoves;			//most movements in a path found, zero for no limit
+	int maxMovesPercent;	//most movements in a path found, as a percent of the shortest path, zero for none
+	string batchFile;		//file of many mazes of a size to find the shortest distances of, empty for none
+	int progressSecs;		//seconds between samples of the exhaustive search's progress, zero for none
+	string progressFile;	//file to append the samples to as JSON lines, empty for the console
+	string gridFile;		//grid file of any dimensions to solve, empty for none
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool ParseOptions(int argc, char *argv[], RunOptions &options);
+	Given: the command line
+		-> fills in options, returns false if the command line is not valid
+*/
+
+
+//pre: argv holds argc command line arguments
+//post: options holds the settings given on the command line, or their defaults.
+//		Returns true to the caller if the command line was valid, false otherwise
+/*out*/bool ParseOptions(						//boolean value returned to the caller
+				/*in*/int argc,					//number of command line arguments
+				/*in*/char *argv[],				//command line arguments
+				/*out*/RunOptions &options);	//settings for the run
+
+#endif
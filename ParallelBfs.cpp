@@ -0,0 +1,438 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: ParallelBfs.cpp
+Purpose: Provides the implementation of the multi-threaded breadth first search.
+*/
+
+#include "ParallelBfs.h"
+#include "Barrier.h"			//Level synchronization
+#include <algorithm>			//min, reverse
+#include <atomic>				//Visited bitmap
+#include <thread>				//Worker threads
+
+using namespace std;
+
+//int constants
+const int TOP_DOWN_ALPHA = 14;		//Switch to bottom-up once the frontier exceeds 1/ALPHA of the unvisited cells
+const int BOTTOM_UP_BETA = 24;		//Switch back to top-down once the frontier falls below 1/BETA of the open cells
+
+//Movements are attempted south, east, north, west, respectively, to match PathEnumerator
+const Direction BFS_ORDER[NUM_DIRECTIONS] = {SOUTH, EAST, NORTH, WEST};
+
+
+//State shared by every thread of a single search. Cells are numbered over the board with a border of
+//closed cells, (row+1)*width+(col+1), so a neighbor is always a fixed offset away
+struct BfsState
+{
+	int width;									//length of a row, including the border
+	long long offset[NUM_DIRECTIONS];			//index change moving in each direction of BFS_ORDER
+	vector<unsigned long long> open;			//open cells
+	vector<atomic<unsigned long long> > visited;	//cells claimed by some thread
+	vector<unsigned char> parent;				//index into BFS_ORDER of the movement into each cell
+	vector<vector<size_t> > frontier;			//current frontier, one list per thread (top-down)
+	vector<vector<size_t> > next;				//next frontier, one list per thread (top-down)
+	vector<size_t> frontierStart;				//position of each list in the whole frontier
+	size_t frontierTotal;						//cells in the whole frontier
+	vector<unsigned long long> frontierBits;	//current frontier (bottom-up)
+	vector<unsigned long long> nextBits;		//next frontier (bottom-up)
+	vector<long long> added;					//cells each thread added in the last layer
+	long long openCells;						//open cells on the board
+	long long unvisited;						//open cells not yet reached
+	size_t exitCell;							//cell to reach
+	int numThreads;								//number of threads searching
+	bool bottomUp;								//current layer is expanded bottom-up
+	bool done;									//search has finished
+	BfsStats stats;								//description of the search
+	Barrier barrier;							//meeting point between layers
+
+	BfsState(int threads) : barrier(threads) {}
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool TestBit(const vector<unsigned long long> &bits, size_t cell);
+	Returns true if the bit for cell is set
+
+bool IsClaimed(BfsState &state, size_t cell);
+	Returns true if some thread has reached cell
+
+void TopDownStep(BfsState &state, int tid);
+	Expands this thread's share of the frontier lists into its own next list
+
+void BottomUpStep(BfsState &state, int tid);
+	Finds the unvisited cells of this thread's part of the board that neighbor the frontier bitmap
+
+void FinishLayer(BfsState &state);
+	Run by a single thread between layers. Decides whether the search is done and how the next layer
+	is expanded, converting the frontier between lists and a bitmap when that changes
+
+void BfsWorker(BfsState *state, int tid);
+	Expands layers until the search is done
+*/
+
+
+//pre: cell is within bits
+//post: returns true to the caller if the bit for cell is set, false otherwise
+static inline /*out*/bool TestBit(						//boolean value returned to the caller
+				/*in*/const vector<unsigned long long> &bits,	//bitmap to test
+				/*in*/size_t cell)						//cell to test
+{
+	return (bits[cell / WORD_BITS] >> (cell % WORD_BITS)) & 1;
+
+}//end TestBit
+
+
+/***************************************************************************************************/
+
+
+//pre: cell is within the board
+//post: returns true to the caller if some thread has reached cell, false otherwise
+static inline /*out*/bool IsClaimed(					//boolean value returned to the caller
+				/*in*/BfsState &state,					//shared search state
+				/*in*/size_t cell)						//cell to test
+{
+	return (state.visited[cell / WORD_BITS].load(memory_order_relaxed) >> (cell % WORD_BITS)) & 1;
+
+}//end IsClaimed
+
+
+/***************************************************************************************************/
+
+
+//pre: state.frontier holds the current frontier
+//post: every unvisited open neighbor of this thread's share of the frontier has been claimed and
+//		added to state.next[tid]
+static void TopDownStep(	/*inout*/BfsState &state,	//shared search state
+							/*in*/int tid)				//index of this thread
+{
+	vector<size_t> &local = state.next[tid];
+	size_t share = (state.frontierTotal + state.numThreads - 1) / state.numThreads;
+	size_t begin = min(state.frontierTotal, share * tid);
+	size_t end = min(state.frontierTotal, begin + share);
+
+	local.clear();
+
+	//This thread's share is a range of the lists laid end to end
+	for (int t = 0; t < state.numThreads; t++)
+	{
+		const vector<size_t> &list = state.frontier[t];
+		size_t listStart = state.frontierStart[t];
+		size_t from = max(begin, listStart);
+		size_t to = min(end, listStart + list.size());
+
+		for (size_t i = from; i < to; i++)
+		{
+			size_t cell = list[i - listStart];
+
+			for (int d = 0; d < NUM_DIRECTIONS; d++)
+			{
+				size_t neighbor = size_t(cell + state.offset[d]);
+				size_t word = neighbor / WORD_BITS;
+				unsigned long long bit = 1ULL << (neighbor % WORD_BITS);
+
+				if ((state.open[word] & bit) == 0 ||
+					(state.visited[word].load(memory_order_relaxed) & bit) != 0)
+					continue;
+
+				//Another thread may claim the same cell, only one of them succeeds
+				if ((state.visited[word].fetch_or(bit, memory_order_relaxed) & bit) != 0)
+					continue;
+
+				state.parent[neighbor] = (unsigned char)d;
+				local.push_back(neighbor);
+
+			}//end for
+
+		}//end for
+
+	}//end for
+
+	state.added[tid] = (long long)local.size();
+
+}//end TopDownStep
+
+
+/***************************************************************************************************/
+
+
+//pre: state.frontierBits holds the current frontier
+//post: every unvisited open cell in this thread's part of the board that neighbors the frontier has
+//		been claimed and set in state.nextBits
+static void BottomUpStep(	/*inout*/BfsState &state,	//shared search state
+							/*in*/int tid)				//index of this thread
+{
+	size_t words = state.open.size();
+	size_t share = (words + state.numThreads - 1) / state.numThreads;
+	size_t begin = min(words, share * tid);
+	size_t end = min(words, begin + share);
+	long long count = 0;
+
+	for (size_t w = begin; w < end; w++)
+	{
+		unsigned long long candidates = state.open[w] & ~state.visited[w].load(memory_order_relaxed);
+		unsigned long long found = 0;
+
+		for (; candidates != 0; candidates &= candidates - 1)
+		{
+			int bit = CountTrailingZeros(candidates);
+			size_t cell = w * WORD_BITS + bit;
+
+			for (int d = 0; d < NUM_DIRECTIONS; d++)
+			{
+				if (TestBit(state.frontierBits, size_t(cell - state.offset[d])))
+				{
+					state.parent[cell] = (unsigned char)d;
+					found |= 1ULL << bit;
+					break;
+
+				}//end if
+
+			}//end for
+
+		}//end for
+
+		//Only this thread writes these words during a bottom-up layer
+		state.nextBits[w] = found;
+		if (found != 0)
+		{
+			state.visited[w].fetch_or(found, memory_order_relaxed);
+			count += PopCount(found);
+
+		}//end if
+
+	}//end for
+
+	state.added[tid] = count;
+
+}//end BottomUpStep
+
+
+/***************************************************************************************************/
+
+
+//pre: every thread has finished expanding the current layer
+//post: state.done is set if the exit was reached or the frontier is empty. Otherwise the next
+//		frontier has become the current one, in the form the next layer is expanded in
+static void FinishLayer(/*inout*/BfsState &state)		//shared search state
+{
+	long long added = 0;
+	bool wasBottomUp = state.bottomUp;
+
+	for (int t = 0; t < state.numThreads; t++)
+		added += state.added[t];
+
+	state.stats.levels++;
+	if (wasBottomUp)
+		state.stats.bottomUpLevels++;
+	else
+		state.stats.topDownLevels++;
+
+	state.unvisited -= added;
+	state.stats.visitedCells += added;
+
+	if (added == 0 || IsClaimed(state, state.exitCell))
+	{
+		state.done = true;
+		return;
+
+	}//end if
+
+	if (wasBottomUp)
+		state.bottomUp = (added >= state.openCells / BOTTOM_UP_BETA);
+	else
+		state.bottomUp = (added > state.unvisited / TOP_DOWN_ALPHA);
+
+	//Lists to lists
+	if (!wasBottomUp && !state.bottomUp)
+	{
+		state.frontier.swap(state.next);
+
+	}//end if
+
+	//Lists to bitmap
+	else if (!wasBottomUp)
+	{
+		fill(state.frontierBits.begin(), state.frontierBits.end(), 0ULL);
+		for (int t = 0; t < state.numThreads; t++)
+		{
+			for (size_t i = 0; i < state.next[t].size(); i++)
+			{
+				size_t cell = state.next[t][i];
+				state.frontierBits[cell / WORD_BITS] |= 1ULL << (cell % WORD_BITS);
+			}
+		}
+
+	}//end else if
+
+	//Bitmap to bitmap
+	else if (state.bottomUp)
+	{
+		state.frontierBits.swap(state.nextBits);
+
+	}//end else if
+
+	//Bitmap to lists
+	else
+	{
+		for (int t = 0; t < state.numThreads; t++)
+			state.frontier[t].clear();
+
+		for (size_t w = 0; w < state.nextBits.size(); w++)
+		{
+			for (unsigned long long bits = state.nextBits[w]; bits != 0; bits &= bits - 1)
+				state.frontier[0].push_back(w * WORD_BITS + CountTrailingZeros(bits));
+		}
+
+	}//end else
+
+	//Position of each list in the whole frontier
+	state.frontierTotal = 0;
+	for (int t = 0; t < state.numThreads; t++)
+	{
+		state.frontierStart[t] = state.frontierTotal;
+		state.frontierTotal += state.frontier[t].size();
+	}
+
+}//end FinishLayer
+
+
+/***************************************************************************************************/
+
+
+//pre: state has been set up with the entry point as the frontier
+//post: layers have been expanded until the search finished
+static void BfsWorker(	/*inout*/BfsState *state,	//shared search state
+						/*in*/int tid)				//index of this thread
+{
+	while (true)
+	{
+		if (state->bottomUp)
+			BottomUpStep(*state, tid);
+		else
+			TopDownStep(*state, tid);
+
+		state->barrier.Wait();
+
+		if (tid == 0)
+			FinishLayer(*state);
+
+		state->barrier.Wait();
+
+		if (state->done)
+			break;
+
+	}//end while
+
+}//end BfsWorker
+
+
+/***************************************************************************************************/
+
+
+//pre: entry and exit are valid locations within the bounds of bb, numThreads is greater than zero
+//post: returns true to the caller if exit can be reached from entry through open cells, false otherwise.
+//		If it can, moves holds the movements of a shortest path from entry to exit. Paths of equal
+//		length may be chosen differently from run to run. stats describes the search
+/*out*/bool ParallelShortestPath(				//boolean value returned to the caller
+				/*in*/const BitBoard &bb,		//board to search
+				/*in*/Location entry,			//starting location
+				/*in*/Location exit,			//location to reach
+				/*in*/int numThreads,			//number of threads to search with
+				/*out*/vector<Direction> &moves,	//movements of the shortest path
+				/*out*/BfsStats &stats)			//description of the search
+{
+	BfsState state(numThreads);
+	int width = bb.GetLength() + 2;
+	size_t cells = size_t(bb.GetHeight() + 2) * width;
+	size_t words = (cells + WORD_BITS - 1) / WORD_BITS;
+	size_t entryCell = size_t(entry.row + 1) * width + entry.col + 1;
+	Location loc;
+
+	moves.clear();
+	stats.levels = stats.topDownLevels = stats.bottomUpLevels = 0;
+	stats.visitedCells = 0;
+
+	//Entry point is the exit point
+	if (entry.row == exit.row && entry.col == exit.col)
+		return true;
+
+	//Entry point is not available
+	if (!bb.IsOpen(entry))
+		return false;
+
+	state.width = width;
+	state.offset[0] = width;		//South
+	state.offset[1] = 1;			//East
+	state.offset[2] = -width;		//North
+	state.offset[3] = -1;			//West
+	state.open.assign(words, 0);
+	state.parent.assign(cells, 0);
+	state.frontier.assign(numThreads, vector<size_t>());
+	state.next.assign(numThreads, vector<size_t>());
+	state.frontierStart.assign(numThreads, 0);
+	state.frontierBits.assign(words, 0);
+	state.nextBits.assign(words, 0);
+	state.added.assign(numThreads, 0);
+	state.exitCell = size_t(exit.row + 1) * width + exit.col + 1;
+	state.numThreads = numThreads;
+	state.bottomUp = false;
+	state.done = false;
+	state.openCells = 0;
+
+	vector<atomic<unsigned long long> > visited(words);
+	state.visited.swap(visited);
+	for (size_t w = 0; w < words; w++)
+		state.visited[w].store(0, memory_order_relaxed);
+
+	//Lay the board out with its border, the exit always counts as open
+	for (loc.row = 0; loc.row < bb.GetHeight(); loc.row++)
+	{
+		for (loc.col = 0; loc.col < bb.GetLength(); loc.col++)
+		{
+			size_t cell = size_t(loc.row + 1) * width + loc.col + 1;
+
+			if (bb.IsOpen(loc) || cell == state.exitCell)
+			{
+				state.open[cell / WORD_BITS] |= 1ULL << (cell % WORD_BITS);
+				state.openCells++;
+
+			}//end if
+
+		}//end for
+
+	}//end for
+
+	state.visited[entryCell / WORD_BITS].store(1ULL << (entryCell % WORD_BITS), memory_order_relaxed);
+	state.unvisited = state.openCells - 1;
+	state.frontier[0].push_back(entryCell);
+	state.frontierTotal = 1;
+	state.stats = stats;
+	state.stats.visitedCells = 1;
+
+	//This thread searches as thread 0
+	vector<thread> workers;
+	for (int t = 1; t < numThreads; t++)
+		workers.push_back(thread(BfsWorker, &state, t));
+
+	BfsWorker(&state, 0);
+
+	for (size_t t = 0; t < workers.size(); t++)
+		workers[t].join();
+
+	stats = state.stats;
+
+	if (!IsClaimed(state, state.exitCell))
+		return false;
+
+	//Follow the movements back from the exit point
+	for (size_t cell = state.exitCell; cell != entryCell; cell = size_t(cell - state.offset[state.parent[cell]]))
+		moves.push_back(BFS_ORDER[state.parent[cell]]);
+
+	reverse(moves.begin(), moves.end());
+	return true;
+
+}//end ParallelShortestPath
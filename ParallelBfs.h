@@ -0,0 +1,56 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: ParallelBfs.h
+Purpose: Provides the specification for a multi-threaded, level-synchronous breadth first search for
+			the shortest path through very large boards. Every thread expands its share of the current
+			frontier into a local next frontier, claiming cells in a shared atomic visited bitmap. When
+			the frontier grows large relative to the unvisited cells, the search switches to bottom-up
+			steps, where each thread scans its own part of the board for unvisited cells next to the
+			frontier, and switches back once the frontier shrinks.
+*/
+
+#ifndef PARALLELBFS_H
+#define PARALLELBFS_H
+
+#include "BitBoard.h"			//Bit-packed board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include <vector>				//Path movements
+
+using namespace std;
+
+//Counts describing a single parallel search
+struct BfsStats
+{
+	int levels;					//number of layers expanded
+	int topDownLevels;			//layers expanded from the frontier outward
+	int bottomUpLevels;			//layers expanded from the unvisited cells inward
+	long long visitedCells;		//cells reached
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool ParallelShortestPath(const BitBoard &bb, Location entry, Location exit, int numThreads,
+						  vector<Direction> &moves, BfsStats &stats);
+	Given: a board, an entry and exit point, and a number of threads
+		-> returns true if exit can be reached, with moves holding a shortest path from entry to exit
+*/
+
+
+//pre: entry and exit are valid locations within the bounds of bb, numThreads is greater than zero
+//post: returns true to the caller if exit can be reached from entry through open cells, false otherwise.
+//		If it can, moves holds the movements of a shortest path from entry to exit. Paths of equal
+//		length may be chosen differently from run to run. stats describes the search
+/*out*/bool ParallelShortestPath(				//boolean value returned to the caller
+				/*in*/const BitBoard &bb,		//board to search
+				/*in*/Location entry,			//starting location
+				/*in*/Location exit,			//location to reach
+				/*in*/int numThreads,			//number of threads to search with
+				/*out*/vector<Direction> &moves,	//movements of the shortest path
+				/*out*/BfsStats &stats);		//description of the search
+
+#endif
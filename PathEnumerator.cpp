@@ -0,0 +1,746 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: PathEnumerator.cpp
+Purpose: Provides the implementation of a path enumerator.
+*/
+
+#include "PathEnumerator.h"
+#include "FrontierBfs.h"			//UNREACHABLE
+#include "MemoryProfile.h"			//Counting the frames as they grow
+
+using namespace std;
+
+//Movements are attempted south, east, north, west, respectively
+const Direction ORDER[NUM_DIRECTIONS] = {SOUTH, EAST, NORTH, WEST};
+
+//Saved state identification
+const unsigned int STATE_MAGIC = 0x4B435A4D;		//"MZCK"
+const unsigned int STATE_VERSION = 2;
+
+//Progress estimate
+const int ESTIMATE_FRAMES = 4096;					//Most frames of the path looked at
+const double ESTIMATE_MIN_SHARE = 1e-9;				//Share of the search below which frames are not looked at
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void WriteValue(ostream &out, T value);
+	Writes the bytes of value to out
+
+bool ReadValue(istream &in, T &value);
+	Reads the bytes of value from in, returns false if the stream ran out
+*/
+
+
+//pre: out is a valid binary output stream
+//post: the bytes of value have been written to out
+template <class T>
+static void WriteValue(	/*inout*/ostream &out,		//stream to write to
+						/*in*/T value)				//value to write
+{
+	out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: in is a valid binary input stream
+//post: value has been read from in. Returns true if the stream held enough bytes
+template <class T>
+static /*out*/bool ReadValue(		//boolean value returned to the caller
+				/*inout*/istream &in,	//stream to read from
+				/*out*/T &value)		//value read
+{
+	in.read(reinterpret_cast<char*>(&value), sizeof(T));
+	return in.good();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, entry and exit are within its bounds
+//post: An enumerator for every path from entry to exit has been created. The board is not
+//		modified or referenced after construction
+PathEnumerator::PathEnumerator(	/*in*/Board &gb,			//board to search
+								/*in*/Location entry,		//starting location
+								/*in*/Location exit)		//location to reach
+{
+	int width = gb.GetLength() + 2;
+	Location loc;
+
+	open.assign(size_t(gb.GetHeight() + 2) * width, 0);
+	for (loc.row = 0; loc.row < gb.GetHeight(); loc.row++)
+	{
+		for (loc.col = 0; loc.col < gb.GetLength(); loc.col++)
+		{
+			if (gb.IsOpen(loc))
+				open[size_t(loc.row + 1) * width + loc.col + 1] = 1;
+		}
+	}
+
+	offset[0] = width;		//South
+	offset[1] = 1;			//East
+	offset[2] = -width;		//North
+	offset[3] = -1;			//West
+
+	entryCell = size_t(entry.row + 1) * width + entry.col + 1;
+	exitCell = size_t(exit.row + 1) * width + exit.col + 1;
+	endCell = exitCell;
+	numExits = 1;
+	solutionExit = 0;
+	boardHash = gb.Hash();
+	depth = -1;
+	baseDepth = 0;
+	depthLimit = 0;
+	lengthLimit = 0;
+	numMoves = 0;
+	nodes = 0;
+	pauseInterval = 0;
+	untilPause = 0;
+	cancelToken = nullptr;
+	keptDepth = 0;
+	solutionKept = 0;
+	started = false;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: PathEnumerator has been initialized
+//post: the search has carried on until the next solution (SEARCH_SOLUTION), until the pause
+//		interval has passed (SEARCH_PAUSED) or until every path has been found (SEARCH_DONE)
+/*out*/SearchStatus PathEnumerator::Next()			//why the search stopped
+{
+	if (!started)
+	{
+		started = true;
+
+		//Entry point is the exit point, the only path is no movement at all
+		if (entryCell == endCell)
+		{
+			numMoves = 0;
+			solutionKept = 0;
+			return SEARCH_SOLUTION;
+
+		}//end single cell path
+
+		//Entry point is not available
+		if (open[entryCell] == 0)
+			return SEARCH_DONE;
+
+		open[entryCell] = 0;
+		cells.assign(1, entryCell);
+		nextDir.assign(1, 0);
+		moves.resize(1);
+		depth = 0;
+		nodes = 1;
+		keptDepth = 0;
+
+		//Among many exit points, one at the entry point is reached with no movement at all
+		if (!exitOf.empty() && exitOf[entryCell] >= 0)
+		{
+			numMoves = 0;
+			solutionExit = exitOf[entryCell];
+			solutionKept = 0;
+			keptDepth = 1;
+			return SEARCH_SOLUTION;
+
+		}//end exit at the entry point
+
+	}//end start
+
+	while (depth >= baseDepth)
+	{
+		//No possible movements, set the space as open, backtrack
+		if (nextDir[depth] == NUM_DIRECTIONS)
+		{
+			open[cells[depth]] = 1;
+			depth--;
+			if (keptDepth > depth + 1)
+				keptDepth = depth + 1;
+			continue;
+
+		}//end backtrack
+
+		int dir = nextDir[depth]++;
+		size_t next = size_t(cells[depth] + offset[dir]);
+
+		//If we are at an exit point, we have a solution
+		if (next == endCell)
+		{
+			moves[depth] = ORDER[dir];
+			numMoves = depth + 1;
+			solutionKept = keptDepth;
+			keptDepth = depth + 1;
+			return SEARCH_SOLUTION;
+
+		}//end solution
+
+		//Too far from the exit to reach it within the length limit, so nothing below it is searched
+		if (!toExit.empty() && depth + 1 + toExit[next] > lengthLimit)
+			continue;
+
+		//If the space is available, move to it
+		if (open[next] != 0)
+		{
+			open[next] = 0;
+			moves[depth] = ORDER[dir];
+			depth++;
+
+			if (depth == int(cells.size()))
+			{
+				size_t frames = cells.capacity();
+
+				cells.push_back(next);
+				nextDir.push_back(0);
+				moves.push_back(SOUTH);
+
+				if (cells.capacity() != frames)
+					CountAllocation(HOOK_SEARCH_FRAMES, cells.capacity() *
+									(sizeof(size_t) + sizeof(unsigned char) + sizeof(Direction)));
+			}
+			else
+			{
+				cells[depth] = next;
+				nextDir[depth] = 0;
+			}
+
+			nodes++;
+
+			//Deep enough, hand the prefix back instead of searching below it
+			if (depth == depthLimit)
+			{
+				nextDir[depth] = NUM_DIRECTIONS;
+				numMoves = depth;
+				return SEARCH_PREFIX;
+
+			}//end prefix
+
+			//Reaching one of many exit points is a solution, and the search carries on from it to the others
+			if (!exitOf.empty() && exitOf[next] >= 0)
+			{
+				numMoves = depth;
+				solutionExit = exitOf[next];
+				solutionKept = keptDepth;
+				keptDepth = depth + 1;
+				return SEARCH_SOLUTION;
+
+			}//end solution at an exit point
+
+			if (pauseInterval > 0 && --untilPause == 0)
+			{
+				untilPause = pauseInterval;
+				return SEARCH_PAUSED;
+
+			}//end pause
+
+			//Another thread or a signal asked the search to stop
+			if (cancelToken != nullptr && cancelToken->IsCancelled())
+				return SEARCH_PAUSED;
+
+		}//end move
+
+	}//end while
+
+	return SEARCH_DONE;
+
+}//end Next
+
+
+/***************************************************************************************************/
+
+
+//pre: nodes is not negative
+//post: Next returns SEARCH_PAUSED after every nodes expanded cells. Zero never pauses
+void PathEnumerator::SetPauseInterval(/*in*/long long inNodes)	//expanded cells between pauses
+{
+	pauseInterval = inNodes;
+	untilPause = inNodes;
+
+}//end SetPauseInterval
+
+
+/***************************************************************************************************/
+
+
+//pre: token is null or lives as long as the search
+//post: Next returns SEARCH_PAUSED after any expanded cell once token has been cancelled.
+//		Null never cancels
+void PathEnumerator::SetCancelToken(/*in*/const CancelToken *token)	//token to look at
+{
+	cancelToken = token;
+
+}//end SetCancelToken
+
+
+/***************************************************************************************************/
+
+
+//pre: numMoves is not negative
+//post: Next returns SEARCH_PREFIX whenever the current path reaches numMoves movements, and
+//		does not search below it. Zero never stops
+void PathEnumerator::SetDepthLimit(/*in*/int inNumMoves)		//movements in a prefix
+{
+	depthLimit = inNumMoves;
+
+}//end SetDepthLimit
+
+
+/***************************************************************************************************/
+
+
+//pre: toExit holds, for every cell (row*length+col), the number of movements from it to the exit
+//		point or UNREACHABLE, as ComputeDistanceLayers fills it from the exit point. maxMoves is
+//		not negative
+//post: Next only finds paths of at most maxMoves movements, and does not search below a path
+//		that cannot reach the exit point in that many. The limit is rounded down to the parity
+//		every path to the exit shares and returned to the caller. Zero finds every path
+/*out*/int PathEnumerator::SetLengthLimit(				//movements in the longest path searched for
+					/*in*/const vector<int> &inToExit,	//movements from each cell to the exit
+					/*in*/int maxMoves)					//most movements in a path
+{
+	size_t width = size_t(offset[0]);
+	size_t length = width - 2;
+	int unreachable = int(open.size());		//more movements than any path has
+
+	lengthLimit = 0;
+	if (maxMoves == 0)
+	{
+		toExit.clear();
+		return 0;
+
+	}//end no limit
+
+	toExit.assign(open.size(), unreachable);
+	for (size_t i = 0; i < inToExit.size(); i++)
+	{
+		if (inToExit[i] != UNREACHABLE)
+			toExit[(i / length + 1) * width + i % length + 1] = inToExit[i];
+	}
+
+	//Each movement changes the colour of the cell on a checkerboard, so every path from the entry point
+	//to the exit point has as many movements, odd or even, as the shortest one
+	if (toExit[entryCell] < unreachable && (maxMoves - toExit[entryCell]) % 2 != 0)
+		maxMoves--;
+
+	lengthLimit = maxMoves;
+	return lengthLimit;
+
+}//end SetLengthLimit
+
+
+/***************************************************************************************************/
+
+
+//pre: Next has not been called, exit is within the bounds of the board and not an exit point
+//		already. There is no length limit, depth limit or prefix, and the state is not saved
+//post: Next also returns SEARCH_SOLUTION for every path from the entry point to exit, and GetExit
+//		tells the exit points apart, numbered from 1 in the order they were added. Once there are
+//		many, a path reaching one carries on through it, so paths to the others may cross it
+void PathEnumerator::AddExit(/*in*/Location exit)			//another location to reach
+{
+	int width = int(offset[0]);
+
+	//Every exit point is entered like any other cell, and the move into it ends a solution
+	if (exitOf.empty())
+	{
+		exitOf.assign(open.size(), -1);
+		exitOf[exitCell] = 0;
+		endCell = size_t(-1);
+	}
+
+	exitOf[size_t(exit.row + 1) * width + exit.col + 1] = numExits++;
+
+}//end AddExit
+
+
+/***************************************************************************************************/
+
+
+//pre: prefix holds numPrefix movements
+//post: if the movements lead from the entry point over open cells, none of them the exit point
+//		or visited twice, the search restarts over only the paths that start with them and true
+//		is returned. Otherwise the search is unchanged and false is returned. No movements
+//		restarts the whole search
+/*out*/bool PathEnumerator::SetPrefix(						//boolean value returned to the caller
+					/*in*/const Direction prefix[],		//movements every path starts with
+					/*in*/int numPrefix)				//number of movements in prefix
+{
+	vector<Direction> path(prefix, prefix + numPrefix);
+
+	//The whole search starts from nothing on the path
+	if (numPrefix == 0)
+	{
+		TakePath(path, -1);
+		depth = -1;
+		baseDepth = 0;
+		started = false;
+
+	}//end whole search
+
+	else
+	{
+		if (!TakePath(path, numPrefix))
+			return false;
+
+		//Each frame below the top has already tried its movement and everything before it
+		nextDir.assign(numPrefix + 1, 0);
+		for (int i = 0; i < numPrefix; i++)
+		{
+			while (ORDER[nextDir[i]] != prefix[i])
+				nextDir[i]++;
+			nextDir[i]++;
+		}
+
+		path.push_back(SOUTH);
+		moves.swap(path);
+		depth = numPrefix;
+		baseDepth = numPrefix;
+		started = true;
+
+	}//end prefix
+
+	nodes = 0;
+	numMoves = 0;
+	untilPause = pauseInterval;
+	return true;
+
+}//end SetPrefix
+
+
+/***************************************************************************************************/
+
+
+//pre: PathEnumerator has been initialized
+//post: returns true to the caller if the exit point can be reached from the last cell of the
+//		current path without crossing the path, false otherwise
+/*out*/bool PathEnumerator::CanReachExit() const			//boolean value returned to the caller
+{
+	vector<unsigned char> seen(open.size(), 0);
+	vector<size_t> queue;
+	size_t head = 0;
+
+	if (depth < 0)
+		return open[entryCell] != 0 || entryCell == exitCell;
+
+	queue.push_back(cells[depth]);
+	seen[cells[depth]] = 1;
+
+	while (head < queue.size())
+	{
+		size_t cell = queue[head++];
+
+		for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+		{
+			size_t next = size_t(cell + offset[dir]);
+
+			if (next == exitCell)
+				return true;
+
+			if (open[next] != 0 && seen[next] == 0)
+			{
+				seen[next] = 1;
+				queue.push_back(next);
+			}
+
+		}//end for
+
+	}//end while
+
+	return false;
+
+}//end CanReachExit
+
+
+/***************************************************************************************************/
+
+
+//pre: Next returned SEARCH_SOLUTION or SEARCH_PREFIX, or SEARCH_PAUSED for the GetDepth() - 1
+//		movements of the current path
+//post: the movements of the path have been returned to the caller. They are valid until
+//		the next call to Next
+/*out*/const Direction* PathEnumerator::GetMoves() const	//movements from the entry point
+{
+	return moves.empty() ? nullptr : &moves[0];
+
+}//end GetMoves
+
+
+/***************************************************************************************************/
+
+
+//pre: Next returned SEARCH_SOLUTION or SEARCH_PREFIX
+//post: the number of movements in the path has been returned to the caller
+/*out*/int PathEnumerator::GetNumMoves() const		//number of movements
+{
+	return numMoves;
+
+}//end GetNumMoves
+
+
+/***************************************************************************************************/
+
+
+//pre: Next returned SEARCH_SOLUTION
+//post: the number of the exit point the solution reaches has been returned to the caller, 0 for
+//		the one the search was created with and the rest in the order they were added
+/*out*/int PathEnumerator::GetExit() const			//exit point reached
+{
+	return solutionExit;
+
+}//end GetExit
+
+
+/***************************************************************************************************/
+
+
+//pre: PathEnumerator has been initialized
+//post: the number of cells expanded so far has been returned to the caller
+/*out*/long long PathEnumerator::GetNodes() const		//cells expanded
+{
+	return nodes;
+
+}//end GetNodes
+
+
+/***************************************************************************************************/
+
+
+//pre: PathEnumerator has been initialized
+//post: the number of cells on the current path has been returned to the caller
+/*out*/int PathEnumerator::GetDepth() const			//cells on the path
+{
+	return depth + 1;
+
+}//end GetDepth
+
+
+/***************************************************************************************************/
+
+
+//pre: Next returned SEARCH_SOLUTION
+//post: the number of cells at the start of the solution that have stayed on the path since the
+//		last solution has been returned to the caller. Zero after a restart or a load
+/*out*/int PathEnumerator::GetKeptDepth() const		//cells kept from the last solution
+{
+	return solutionKept;
+
+}//end GetKeptDepth
+
+
+/***************************************************************************************************/
+
+
+//pre: PathEnumerator has been initialized
+//post: a rough estimate of the share of the search below the prefix done so far has been
+//		returned to the caller, from 0 before it starts to 1 once it is over. Each branch of a frame
+//		is taken as an equal share of the frame, so the finished branches of the frames of the
+//		current path, each weighed by the share of the frame it is in, add up to the share done
+/*out*/double PathEnumerator::EstimateDone() const		//share of the search done
+{
+	double done = 0;
+	double share = 1;											//share of the search below the frame
+
+	if (!started)
+		return 0;
+
+	if (depth < baseDepth)
+		return 1;
+
+	//A branch of a frame may lead to a cell the path went on to, which was open when the frame was reached
+	if (pathFrame.size() != open.size())
+		pathFrame.assign(open.size(), -1);
+	for (int frame = 0; frame <= depth; frame++)
+		pathFrame[cells[frame]] = frame;
+
+	for (int frame = baseDepth; frame <= depth && frame < baseDepth + ESTIMATE_FRAMES; frame++)
+	{
+		int branches = 0;										//movements the frame can search below
+		int finished = 0;										//of them, those already searched
+		int current = frame < depth ? nextDir[frame] - 1 : nextDir[frame];	//movement being searched
+
+		//The neighbors open when the frame was reached are those open now and those deeper on the path
+		for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+		{
+			size_t next = size_t(cells[frame] + offset[dir]);
+
+			if ((open[next] != 0 || pathFrame[next] > frame) &&
+				(toExit.empty() || frame + 1 + toExit[next] <= lengthLimit))
+			{
+				branches++;
+				if (dir < current)
+					finished++;
+			}
+
+		}//end for
+
+		if (branches == 0)
+			break;
+
+		done += share * finished / branches;
+		share /= branches;
+
+		//The rest of the path is too small a share to move the estimate
+		if (share < ESTIMATE_MIN_SHARE)
+			break;
+
+	}//end for
+
+	for (int frame = 0; frame <= depth; frame++)
+		pathFrame[cells[frame]] = -1;
+
+	return done;
+
+}//end EstimateDone
+
+
+/***************************************************************************************************/
+
+
+//pre: out is a valid binary output stream
+//post: the state of the search has been written to out
+void PathEnumerator::SaveState(/*inout*/ostream &out) const	//stream to write to
+{
+	WriteValue(out, STATE_MAGIC);
+	WriteValue(out, STATE_VERSION);
+	WriteValue(out, boardHash);
+	WriteValue(out, (unsigned long long)entryCell);
+	WriteValue(out, (unsigned long long)exitCell);
+	WriteValue(out, (unsigned char)(started ? 1 : 0));
+	WriteValue(out, nodes);
+	WriteValue(out, depth);
+	WriteValue(out, baseDepth);
+
+	//The cells and the cells on the path follow from the movements, so each frame is two bytes
+	for (int i = 0; i <= depth; i++)
+	{
+		WriteValue(out, nextDir[i]);
+		WriteValue(out, (unsigned char)moves[i]);
+	}
+
+}//end SaveState
+
+
+/***************************************************************************************************/
+
+
+//pre: in is a valid binary input stream
+//post: if in holds a state written by SaveState for the same board, entry and exit, the search
+//		continues from that state and true is returned. Otherwise the search is unchanged and
+//		false is returned
+/*out*/bool PathEnumerator::LoadState(			//boolean value returned to the caller
+				/*inout*/istream &in)			//stream to read from
+{
+	unsigned int magic, version;
+	unsigned long long hash, entry, exit;
+	unsigned char wasStarted;
+	long long savedNodes;
+	int savedDepth, savedBase;
+
+	if (!ReadValue(in, magic) || !ReadValue(in, version) || magic != STATE_MAGIC ||
+		version != STATE_VERSION || !ReadValue(in, hash) || !ReadValue(in, entry) ||
+		!ReadValue(in, exit) || !ReadValue(in, wasStarted) || !ReadValue(in, savedNodes) ||
+		!ReadValue(in, savedDepth) || !ReadValue(in, savedBase))
+		return false;
+
+	if (hash != boardHash || entry != entryCell || exit != exitCell || savedDepth < -1 ||
+		size_t(savedDepth + 1) > open.size() || savedBase < 0 || savedBase > savedDepth + 1)
+		return false;
+
+	vector<unsigned char> savedDir(savedDepth + 1);
+	vector<Direction> savedMoves(savedDepth + 1);
+
+	for (int i = 0; i <= savedDepth; i++)
+	{
+		unsigned char move;
+
+		if (!ReadValue(in, savedDir[i]) || !ReadValue(in, move) ||
+			savedDir[i] > NUM_DIRECTIONS || move >= NUM_DIRECTIONS)
+			return false;
+
+		savedMoves[i] = Direction(move);
+
+	}//end for
+
+	if (!TakePath(savedMoves, savedDepth))
+		return false;
+
+	nextDir.swap(savedDir);
+	moves.swap(savedMoves);
+	if (moves.empty())
+		moves.resize(1);
+
+	depth = savedDepth;
+	baseDepth = savedBase;
+	nodes = savedNodes;
+	started = (wasStarted != 0);
+	numMoves = 0;
+	untilPause = pauseInterval;
+	return true;
+
+}//end LoadState
+
+
+/***************************************************************************************************/
+
+
+//pre: path holds at least newDepth movements, newDepth is at least -1
+//post: if the first newDepth movements lead from the entry point over open cells, none of them
+//		the exit point or visited twice, the current path has been replaced by their newDepth + 1
+//		cells and true is returned. Otherwise nothing is changed and false is returned
+/*out*/bool PathEnumerator::TakePath(						//boolean value returned to the caller
+					/*in*/const vector<Direction> &path,	//movements from the entry point
+					/*in*/int newDepth)					//index of the last cell of the new path
+{
+	vector<size_t> newCells(newDepth + 1);
+
+	//Rebuild the cells of the path from the movements
+	for (int i = 0; i <= newDepth; i++)
+	{
+		if (i == 0)
+			newCells[i] = entryCell;
+		else
+		{
+			int dir = 0;
+			while (ORDER[dir] != path[i - 1])
+				dir++;
+			newCells[i] = size_t(newCells[i - 1] + offset[dir]);
+		}
+
+		if (newCells[i] >= open.size() || (i > 0 && newCells[i] == exitCell))
+			return false;
+
+	}//end for
+
+	//Put the current path back on the board, then take the new one off it
+	for (int i = 0; i <= depth; i++)
+		open[cells[i]] = 1;
+
+	for (int i = 0; i <= newDepth; i++)
+	{
+		//Every cell of the new path must be open, and on the path only once
+		if (open[newCells[i]] == 0)
+		{
+			for (int j = 0; j < i; j++)
+				open[newCells[j]] = 1;
+			for (int j = 0; j <= depth; j++)
+				open[cells[j]] = 0;
+			return false;
+
+		}//end if
+
+		open[newCells[i]] = 0;
+
+	}//end for
+
+	cells.swap(newCells);
+	keptDepth = 0;
+	return true;
+
+}//end TakePath
@@ -0,0 +1,290 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: PathEnumerator.h
+Purpose: Provides the specification for a PathEnumerator. A path enumerator finds every path through a
+			board, in the same order as the original recursive search (south, east, north, west), but
+			keeps the search on an explicit stack of frames instead of the call stack. Each frame is a
+			cell of the current path and the next movement to try from it. Because the whole search is
+			held in the object, it can be stopped after any solution or after a number of expanded cells,
+			saved, and later carried on from exactly the same point. A search given a cancel token also
+			pauses as soon as the token is cancelled, so a run can be stopped from another thread. A search can also be limited to the
+			paths that start with a given prefix, or stopped at a given depth to list the prefixes. Given
+			the distance from every cell to the exit, it can also be limited to paths of at most a number
+			of movements: a branch is cut as soon as the movements so far plus the distance left exceed it,
+			so the search takes time in proportion to the paths short enough rather than to every path.
+			More exit points can be added, so a single search finds the paths to all of them: reaching
+			any of them is a solution, and the path may carry on through it to reach the others.
+*/
+
+#ifndef PATHENUMERATOR_H
+#define PATHENUMERATOR_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include "SearchBudget.h"		//Cancel token
+#include <istream>				//Loading state
+#include <ostream>				//Saving state
+#include <vector>				//Frames
+
+using namespace std;
+
+//Result of advancing the search
+enum SearchStatus
+{
+	SEARCH_SOLUTION,			//the current path reaches the exit point
+	SEARCH_PREFIX,				//the current path has reached the depth limit
+	SEARCH_PAUSED,				//the pause interval has passed since the search last stopped
+	SEARCH_DONE					//every path has been found
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+PathEnumerator(Board &gb, Location entry, Location exit);
+	Creates a new PathEnumerator for every path from entry to exit on gb
+
+SearchStatus Next();
+	Carries on the search until the next solution, a pause, or the end
+
+void SetPauseInterval(long long nodes);
+	Makes Next return SEARCH_PAUSED after every nodes expanded cells. Zero never pauses
+
+void SetCancelToken(const CancelToken *token);
+	Makes Next return SEARCH_PAUSED once token has been cancelled
+
+void SetDepthLimit(int numMoves);
+	Makes Next return SEARCH_PREFIX for paths of numMoves movements instead of going deeper. Zero never stops
+
+int SetLengthLimit(const vector<int> &toExit, int maxMoves);
+	Makes Next skip every path of more than maxMoves movements, returns the limit kept. Zero finds every path
+
+void AddExit(Location exit);
+	Makes the paths to exit solutions as well
+
+bool SetPrefix(const Direction prefix[], int numPrefix);
+	Restarts the search over only the paths that start with the given movements
+
+bool CanReachExit() const;
+	Returns true if the exit point can still be reached from the end of the current path
+
+const Direction* GetMoves() const;
+	Returns the movements of the current solution or prefix
+
+int GetNumMoves() const;
+	Returns the number of movements in the current solution or prefix
+
+int GetExit() const;
+	Returns which exit point the current solution reaches, 0 for the one the search was created with
+
+long long GetNodes() const;
+	Returns the number of cells expanded so far
+
+int GetDepth() const;
+	Returns the number of cells on the current path
+
+int GetKeptDepth() const;
+	Returns the number of cells at the start of the current solution that were also on the last one
+
+double EstimateDone() const;
+	Returns a rough estimate of the share of the search done so far, from 0 to 1
+
+void SaveState(ostream &out) const;
+	Writes the state of the search to out
+
+bool LoadState(istream &in);
+	Replaces the state of the search with one written by SaveState, returns false if it does not fit
+*/
+
+class PathEnumerator
+{
+
+	public:
+
+		//pre: gb is a valid gameboard, entry and exit are within its bounds
+		//post: An enumerator for every path from entry to exit has been created. The board is not
+		//		modified or referenced after construction
+		PathEnumerator(	/*in*/Board &gb,			//board to search
+						/*in*/Location entry,		//starting location
+						/*in*/Location exit);		//location to reach
+
+		/***************************************************************************************************/
+
+		//pre: PathEnumerator has been initialized
+		//post: the search has carried on until the next solution (SEARCH_SOLUTION), until the pause
+		//		interval has passed (SEARCH_PAUSED) or until every path has been found (SEARCH_DONE)
+		/*out*/SearchStatus Next();					//why the search stopped
+
+		/***************************************************************************************************/
+
+		//pre: nodes is not negative
+		//post: Next returns SEARCH_PAUSED after every nodes expanded cells. Zero never pauses
+		void SetPauseInterval(/*in*/long long nodes);	//expanded cells between pauses
+
+		/***************************************************************************************************/
+
+		//pre: token is null or lives as long as the search
+		//post: Next returns SEARCH_PAUSED after any expanded cell once token has been cancelled.
+		//		Null never cancels
+		void SetCancelToken(/*in*/const CancelToken *token);	//token to look at
+
+		/***************************************************************************************************/
+
+		//pre: numMoves is not negative
+		//post: Next returns SEARCH_PREFIX whenever the current path reaches numMoves movements, and
+		//		does not search below it. Zero never stops
+		void SetDepthLimit(/*in*/int numMoves);		//movements in a prefix
+
+		/***************************************************************************************************/
+
+		//pre: toExit holds, for every cell (row*length+col), the number of movements from it to the exit
+		//		point or UNREACHABLE, as ComputeDistanceLayers fills it from the exit point. maxMoves is
+		//		not negative
+		//post: Next only finds paths of at most maxMoves movements, and does not search below a path
+		//		that cannot reach the exit point in that many. The limit is rounded down to the parity
+		//		every path to the exit shares and returned to the caller. Zero finds every path
+		/*out*/int SetLengthLimit(					//movements in the longest path searched for
+					/*in*/const vector<int> &toExit,	//movements from each cell to the exit
+					/*in*/int maxMoves);			//most movements in a path
+
+		/***************************************************************************************************/
+
+		//pre: Next has not been called, exit is within the bounds of the board and not an exit point
+		//		already. There is no length limit, depth limit or prefix, and the state is not saved
+		//post: Next also returns SEARCH_SOLUTION for every path from the entry point to exit, and GetExit
+		//		tells the exit points apart, numbered from 1 in the order they were added. Once there are
+		//		many, a path reaching one carries on through it, so paths to the others may cross it
+		void AddExit(/*in*/Location exit);			//another location to reach
+
+		/***************************************************************************************************/
+
+		//pre: prefix holds numPrefix movements
+		//post: if the movements lead from the entry point over open cells, none of them the exit point
+		//		or visited twice, the search restarts over only the paths that start with them and true
+		//		is returned. Otherwise the search is unchanged and false is returned. No movements
+		//		restarts the whole search
+		/*out*/bool SetPrefix(						//boolean value returned to the caller
+					/*in*/const Direction prefix[],	//movements every path starts with
+					/*in*/int numPrefix);			//number of movements in prefix
+
+		/***************************************************************************************************/
+
+		//pre: PathEnumerator has been initialized
+		//post: returns true to the caller if the exit point can be reached from the last cell of the
+		//		current path without crossing the path, false otherwise
+		/*out*/bool CanReachExit() const;			//boolean value returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: Next returned SEARCH_SOLUTION or SEARCH_PREFIX, or SEARCH_PAUSED for the GetDepth() - 1
+		//		movements of the current path
+		//post: the movements of the path have been returned to the caller. They are valid until
+		//		the next call to Next
+		/*out*/const Direction* GetMoves() const;	//movements from the entry point
+
+		/***************************************************************************************************/
+
+		//pre: Next returned SEARCH_SOLUTION or SEARCH_PREFIX
+		//post: the number of movements in the path has been returned to the caller
+		/*out*/int GetNumMoves() const;				//number of movements
+
+		/***************************************************************************************************/
+
+		//pre: Next returned SEARCH_SOLUTION
+		//post: the number of the exit point the solution reaches has been returned to the caller, 0 for
+		//		the one the search was created with and the rest in the order they were added
+		/*out*/int GetExit() const;					//exit point reached
+
+		/***************************************************************************************************/
+
+		//pre: PathEnumerator has been initialized
+		//post: the number of cells expanded so far has been returned to the caller
+		/*out*/long long GetNodes() const;			//cells expanded
+
+		/***************************************************************************************************/
+
+		//pre: PathEnumerator has been initialized
+		//post: the number of cells on the current path has been returned to the caller
+		/*out*/int GetDepth() const;				//cells on the path
+
+		/***************************************************************************************************/
+
+		//pre: Next returned SEARCH_SOLUTION
+		//post: the number of cells at the start of the solution that have stayed on the path since the
+		//		last solution has been returned to the caller. Zero after a restart or a load. A caller
+		//		keeping something for each cell of the path only has to redo the cells after them
+		/*out*/int GetKeptDepth() const;			//cells kept from the last solution
+
+		/***************************************************************************************************/
+
+		//pre: PathEnumerator has been initialized
+		//post: a rough estimate of the share of the search below the prefix done so far has been
+		//		returned to the caller, from 0 before it starts to 1 once it is over. Each branch of a frame
+		//		is taken as an equal share of the frame, so the finished branches of the frames of the
+		//		current path, each weighed by the share of the frame it is in, add up to the share done
+		/*out*/double EstimateDone() const;		//share of the search done
+
+		/***************************************************************************************************/
+
+		//pre: out is a valid binary output stream
+		//post: the state of the search has been written to out
+		void SaveState(/*inout*/ostream &out) const;	//stream to write to
+
+		/***************************************************************************************************/
+
+		//pre: in is a valid binary input stream
+		//post: if in holds a state written by SaveState for the same board, entry and exit, the search
+		//		continues from that state and true is returned. Otherwise the search is unchanged and
+		//		false is returned
+		/*out*/bool LoadState(						//boolean value returned to the caller
+					/*inout*/istream &in);			//stream to read from
+
+		/***************************************************************************************************/
+
+	private:
+
+		//pre: path holds at least newDepth movements, newDepth is at least -1
+		//post: if the first newDepth movements lead from the entry point over open cells, none of them
+		//		the exit point or visited twice, the current path has been replaced by their newDepth + 1
+		//		cells and true is returned. Otherwise nothing is changed and false is returned
+		/*out*/bool TakePath(						//boolean value returned to the caller
+					/*in*/const vector<Direction> &path,	//movements from the entry point
+					/*in*/int newDepth);			//index of the last cell of the new path
+
+		/***************************************************************************************************/
+
+		//Cells are numbered over the board with a border of closed cells, (row+1)*width+(col+1), so a
+		//neighbor is always a fixed offset away and no bounds checks are needed
+
+		vector<unsigned char> open;		//open cells not on the current path
+		vector<size_t> cells;			//cell of each frame
+		vector<unsigned char> nextDir;	//next movement to try from each frame, index into ORDER
+		vector<Direction> moves;		//movement out of each frame
+		vector<int> toExit;				//movements from each cell to the exit, empty for no length limit
+		long long offset[NUM_DIRECTIONS];	//index change moving in each direction of ORDER
+		size_t entryCell;				//cell of the entry point
+		size_t exitCell;				//cell of the exit point
+		size_t endCell;					//cell ending a path without being entered, none once there are many exits
+		vector<int> exitOf;				//number of the exit point of each cell, -1 elsewhere, empty for a single exit
+		int numExits;					//number of exit points
+		int solutionExit;				//exit point the current solution reaches
+		unsigned long long boardHash;	//hash of the board, to match saved states
+		int depth;						//index of the top frame, -1 once the search is over
+		int baseDepth;					//index of the lowest frame the search may backtrack
+		int depthLimit;					//movements in a prefix, zero for no limit
+		int lengthLimit;				//movements in the longest path searched for, if toExit is not empty
+		int numMoves;					//movements in the current solution
+		long long nodes;				//cells expanded so far
+		long long pauseInterval;		//expanded cells between pauses
+		long long untilPause;			//expanded cells left before the next pause
+		const CancelToken *cancelToken;	//token that stops the search, null for none
+		int keptDepth;					//cells of the path not backtracked over since the last solution
+		int solutionKept;				//keptDepth when the current solution was found
+		bool started;					//Next has been called
+		mutable vector<int> pathFrame;	//frame of each cell on the current path while estimating, -1 elsewhere
+};
+
+#endif
@@ -0,0 +1,660 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: PathEstimator.cpp
+Purpose: Provides the implementation of the path count estimator.
+*/
+
+#include "PathEstimator.h"
+#include <atomic>				//Stopping the threads
+#include <chrono>				//Time budget
+#include <cmath>				//log, exp, sqrt
+#include <iomanip>				//setprecision
+#include <limits>				//infinity
+#include <mutex>				//Totals shared by the threads
+#include <random>				//Random moves
+#include <sstream>				//Formatted estimates
+#include <thread>				//Probe threads
+#include <vector>				//Grid
+
+using namespace std;
+
+//Confidence interval is this many standard errors either side of the estimate
+const double CONFIDENCE_Z = 1.96;
+
+//Movements around a cell in order, so each is next to the one before across a corner
+const Direction CLOCKWISE[NUM_DIRECTIONS] = {NORTH, EAST, SOUTH, WEST};
+
+//Base of the logarithms estimates are written in
+const double LOG_10 = 2.302585092994046;
+
+
+//Probe estimates as a sum kept relative to the largest one so far, since the estimates themselves
+//may not fit in a double. Each is exp(logWeight), the sums are of exp(logWeight - maxLog) and its square
+struct LogSum
+{
+	double maxLog;						//natural logarithm of the largest estimate
+	double sum;							//sum of the estimates over exp(maxLog)
+	double sumSquares;					//sum of the squared estimates over exp(2 maxLog)
+	long long count;					//probes added, counting those that found no path
+};
+
+//The board laid out for probes. Cells are numbered over the board with a border of closed cells,
+//(row+1)*width+(col+1), so a neighbor is always a fixed offset away
+struct ProbeGrid
+{
+	vector<char> open;					//open cells
+	long long offset[NUM_DIRECTIONS];	//index change moving in each Direction
+	size_t width;						//cols of the grid, with its border
+	size_t entryCell;					//cell of the entry point
+	size_t exitCell;					//cell of the exit point
+	EstimateMethod method;				//how probes choose their moves
+};
+
+//A single thread's probes. Cells are marked with stamps rather than cleared between probes
+struct Prober
+{
+	const ProbeGrid *grid;				//board laid out for probes
+	mt19937_64 random;					//this thread's random numbers
+	vector<unsigned int> visited;		//probe each cell was last on the path of
+	vector<unsigned int> reached;		//reachability search each cell was last reached by
+	vector<size_t> stack;				//cells waiting in a reachability search
+	vector<size_t> otherStack;			//cells waiting in the second search of a race
+	unsigned int probe;					//stamp of the current probe
+	unsigned int search;				//stamp of the last reachability search
+};
+
+//State shared by every thread of an estimate
+struct EstimateWork
+{
+	mutex lock;							//guards the totals
+	LogSum totals;						//probes of every thread
+	atomic<bool> stop;					//the estimate is done, read without the lock
+	chrono::steady_clock::time_point start;		//when the estimate began
+	chrono::steady_clock::duration budget;		//most time to take
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void AddEstimate(LogSum &total, double logWeight);
+	Adds the estimate exp(logWeight) of a probe
+
+void MergeSums(LogSum &total, const LogSum &other);
+	Adds the estimates of other
+
+double RelativeError(const LogSum &total);
+	Returns the half width of the 95% confidence interval over the mean
+
+bool CanReachExit(Prober &prober, size_t from, unsigned int stampBase, const char results[]);
+	Returns true if the exit can be reached from a cell without crossing the current path
+
+int GroupMoves(const Prober &prober, size_t cell, size_t moves[], int groups[], int firsts[], int &numGroups);
+	Finds the moves from a cell, joined where a corner makes them reach the same cells
+
+void RaceToExit(Prober &prober, size_t fromA, size_t fromB, bool &reachA, bool &reachB);
+	Searches from two cells at once to find which can reach the exit
+
+double RunProbe(Prober &prober);
+	Walks a random path from the entry, returns the natural logarithm of its estimate
+
+void ProbeWorker(const ProbeGrid *grid, EstimateWork *work, unsigned int seed);
+	Runs batches of probes until the estimate is done
+*/
+
+
+//pre: total has been initialized
+//post: exp(logWeight) has been added to total, minus infinity adding a probe that found nothing
+static void AddEstimate(	/*inout*/LogSum &total,			//estimates so far
+							/*in*/double logWeight)			//natural logarithm of the estimate
+{
+	total.count++;
+
+	if (logWeight == -numeric_limits<double>::infinity())
+		return;
+
+	//Keep the sums relative to the largest estimate
+	if (logWeight > total.maxLog)
+	{
+		double scale = exp(total.maxLog - logWeight);
+
+		total.sum *= scale;
+		total.sumSquares *= scale * scale;
+		total.maxLog = logWeight;
+	}
+
+	double relative = exp(logWeight - total.maxLog);
+
+	total.sum += relative;
+	total.sumSquares += relative * relative;
+
+}//end AddEstimate
+
+
+/***************************************************************************************************/
+
+
+//pre: total and other have been initialized
+//post: the estimates of other have been added to total
+static void MergeSums(	/*inout*/LogSum &total,			//estimates to add to
+						/*in*/const LogSum &other)		//estimates to add
+{
+	if (other.maxLog > total.maxLog)
+	{
+		double scale = exp(total.maxLog - other.maxLog);
+
+		total.sum = total.sum * scale + other.sum;
+		total.sumSquares = total.sumSquares * scale * scale + other.sumSquares;
+		total.maxLog = other.maxLog;
+	}
+	else if (other.sum > 0)
+	{
+		double scale = exp(other.maxLog - total.maxLog);
+
+		total.sum += other.sum * scale;
+		total.sumSquares += other.sumSquares * scale * scale;
+	}
+
+	total.count += other.count;
+
+}//end MergeSums
+
+
+/***************************************************************************************************/
+
+
+//pre: total has been initialized
+//post: the half width of the 95% confidence interval of the mean estimate, over the mean, has been
+//		returned to the caller. Infinity if there are too few probes or no path has been found
+static /*out*/double RelativeError(/*in*/const LogSum &total)	//estimates so far
+{
+	double n = double(total.count);
+
+	if (total.count < 2 || total.sum <= 0)
+		return numeric_limits<double>::infinity();
+
+	double mean = total.sum / n;
+	double variance = (total.sumSquares / n - mean * mean) * n / (n - 1);
+
+	if (variance < 0)
+		variance = 0;
+
+	return CONFIDENCE_Z * sqrt(variance / n) / mean;
+
+}//end RelativeError
+
+
+/***************************************************************************************************/
+
+
+//pre: from is an open cell off the current path. stampBase is the stamp of the first reachability
+//		search of this step, and results holds whether each search of the step so far reached the exit
+//post: True is returned to the caller if the exit can be reached from the cell without crossing the
+//		current path. A search that runs into the cells of an earlier one of this step takes its answer
+static /*out*/bool CanReachExit(								//boolean value returned to the caller
+				/*inout*/Prober &prober,						//probes of this thread
+				/*in*/size_t from,								//cell to search from
+				/*in*/unsigned int stampBase,					//first search of this step
+				/*in*/const char results[])						//outcome of each search of this step
+{
+	const ProbeGrid &grid = *prober.grid;
+	long long exitRow = (long long)(grid.exitCell / grid.width);
+	long long exitCol = (long long)(grid.exitCell % grid.width);
+	unsigned int stamp = ++prober.search;
+
+	if (prober.reached[from] >= stampBase && prober.reached[from] < stamp)
+		return results[prober.reached[from] - stampBase] != 0;
+
+	prober.stack.clear();
+	prober.stack.push_back(from);
+	prober.reached[from] = stamp;
+
+	while (!prober.stack.empty())
+	{
+		size_t cell = prober.stack.back();
+		long long row = (long long)(cell / grid.width);
+		long long col = (long long)(cell % grid.width);
+		Direction order[NUM_DIRECTIONS];
+
+		prober.stack.pop_back();
+		if (cell == grid.exitCell)
+			return true;
+
+		//Pushed from the furthest from the exit to the nearest, so the way toward it is tried first
+		order[3] = exitRow > row ? SOUTH : NORTH;
+		order[2] = exitCol > col ? EAST : WEST;
+		order[1] = order[2] == EAST ? WEST : EAST;
+		order[0] = order[3] == SOUTH ? NORTH : SOUTH;
+
+		for (int i = 0; i < NUM_DIRECTIONS; i++)
+		{
+			size_t next = size_t(cell + grid.offset[order[i]]);
+			unsigned int mark = prober.reached[next];
+
+			if (!grid.open[next] || prober.visited[next] == prober.probe || mark == stamp)
+				continue;
+
+			//Cells of an earlier search of this step are in the same part of the board as it
+			if (mark >= stampBase && mark < stamp)
+				return results[mark - stampBase] != 0;
+
+			prober.reached[next] = stamp;
+			prober.stack.push_back(next);
+
+		}//end for
+
+	}//end while
+
+	return false;
+
+}//end CanReachExit
+
+
+/***************************************************************************************************/
+
+
+//pre: cell is on the current path
+//post: moves holds the open cells off the path next to cell, and the number of them has been
+//		returned to the caller. Moves either side of an open corner of cell are joined, as any
+//		search from one reaches the other. groups holds which of numGroups joined sets each move
+//		is in, and firsts the first move of each set
+static /*out*/int GroupMoves(						//number of moves
+				/*in*/const Prober &prober,			//probes of this thread
+				/*in*/size_t cell,					//last cell of the path
+				/*out*/size_t moves[],				//open cells next to cell
+				/*out*/int groups[],				//joined set of each move
+				/*out*/int firsts[],				//first move of each joined set
+				/*out*/int &numGroups)				//number of joined sets
+{
+	const ProbeGrid &grid = *prober.grid;
+	bool free[NUM_DIRECTIONS];
+	int label[NUM_DIRECTIONS];
+	int moveLabel[NUM_DIRECTIONS];
+	int numMoves = 0;
+
+	for (int i = 0; i < NUM_DIRECTIONS; i++)
+	{
+		size_t next = size_t(cell + grid.offset[CLOCKWISE[i]]);
+
+		free[i] = grid.open[next] && prober.visited[next] != prober.probe;
+		label[i] = i;
+	}
+
+	//Each open corner joins the two moves either side of it
+	for (int i = 0; i < NUM_DIRECTIONS; i++)
+	{
+		int j = (i + 1) % NUM_DIRECTIONS;
+		size_t corner = size_t(cell + grid.offset[CLOCKWISE[i]] + grid.offset[CLOCKWISE[j]]);
+
+		if (free[i] && free[j] && grid.open[corner] && prober.visited[corner] != prober.probe)
+		{
+			int old = label[j];
+
+			for (int k = 0; k < NUM_DIRECTIONS; k++)
+			{
+				if (label[k] == old)
+					label[k] = label[i];
+			}
+		}
+
+	}//end for
+
+	//Sets are numbered in the order their first move is found
+	numGroups = 0;
+	for (int i = 0; i < NUM_DIRECTIONS; i++)
+	{
+		if (!free[i])
+			continue;
+
+		int group = -1;
+
+		for (int m = 0; m < numMoves && group < 0; m++)
+		{
+			if (moveLabel[m] == label[i])
+				group = groups[m];
+		}
+
+		if (group < 0)
+		{
+			group = numGroups++;
+			firsts[group] = numMoves;
+		}
+
+		moves[numMoves] = size_t(cell + grid.offset[CLOCKWISE[i]]);
+		moveLabel[numMoves] = label[i];
+		groups[numMoves] = group;
+		numMoves++;
+
+	}//end for
+
+	return numMoves;
+
+}//end GroupMoves
+
+
+/***************************************************************************************************/
+
+
+//pre: fromA and fromB are open cells off the current path, the exit can be reached from at least one
+//post: reachA and reachB hold whether the exit can be reached from each without crossing the current
+//		path. Searches from both run a cell at a time, so the search of a pocket the exit is not in
+//		ends after about as many steps as the pocket has cells, and both end once they meet
+static void RaceToExit(	/*inout*/Prober &prober,		//probes of this thread
+						/*in*/size_t fromA,				//first cell to search from
+						/*in*/size_t fromB,				//second cell to search from
+						/*out*/bool &reachA,			//exit reached from fromA
+						/*out*/bool &reachB)			//exit reached from fromB
+{
+	const ProbeGrid &grid = *prober.grid;
+	vector<size_t> *stacks[2] = {&prober.stack, &prober.otherStack};
+	unsigned int stamps[2];
+	bool found[2] = {false, false};
+
+	stamps[0] = ++prober.search;
+	stamps[1] = ++prober.search;
+
+	for (int side = 0; side < 2; side++)
+	{
+		size_t from = side == 0 ? fromA : fromB;
+
+		stacks[side]->clear();
+		stacks[side]->push_back(from);
+		prober.reached[from] = stamps[side];
+	}
+
+	while (true)
+	{
+		for (int side = 0; side < 2; side++)
+		{
+			vector<size_t> &stack = *stacks[side];
+
+			if (found[side])
+				continue;
+
+			//Nothing left to search, the exit is the other side's
+			if (stack.empty())
+			{
+				reachA = side == 1;
+				reachB = side == 0;
+				return;
+			}
+
+			size_t cell = stack.back();
+			stack.pop_back();
+
+			if (cell == grid.exitCell)
+			{
+				found[side] = true;
+
+				//Both found it without meeting, as when the exit is next to the path
+				if (found[1 - side])
+				{
+					reachA = reachB = true;
+					return;
+				}
+				continue;
+			}
+
+			for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+			{
+				size_t next = size_t(cell + grid.offset[dir]);
+
+				if (!grid.open[next] || prober.visited[next] == prober.probe || prober.reached[next] == stamps[side])
+					continue;
+
+				//The searches met, both are in the part of the board the exit is in
+				if (prober.reached[next] == stamps[1 - side])
+				{
+					reachA = reachB = true;
+					return;
+				}
+
+				prober.reached[next] = stamps[side];
+				stack.push_back(next);
+
+			}//end for
+
+		}//end for
+
+	}//end while
+
+}//end RaceToExit
+
+
+/***************************************************************************************************/
+
+
+//pre: the exit can be reached from the entry
+//post: a random path has been walked from the entry and the natural logarithm of the product of the
+//		number of moves it chose from at each step returned to the caller. Minus infinity if it got
+//		stuck before the exit
+static /*out*/double RunProbe(/*inout*/Prober &prober)		//probes of this thread
+{
+	const ProbeGrid &grid = *prober.grid;
+	size_t cell = grid.entryCell;
+	double logWeight = 0;
+
+	//Stamps are about to wrap around, start the marks over
+	if (prober.probe == ~0U || prober.search + NUM_DIRECTIONS * (unsigned long long)prober.visited.size() > ~0U)
+	{
+		prober.visited.assign(prober.visited.size(), 0);
+		prober.reached.assign(prober.reached.size(), 0);
+		prober.probe = 0;
+		prober.search = 0;
+	}
+
+	prober.probe++;
+	prober.visited[cell] = prober.probe;
+
+	while (cell != grid.exitCell)
+	{
+		size_t moves[NUM_DIRECTIONS];
+		int groups[NUM_DIRECTIONS];
+		int firsts[NUM_DIRECTIONS];
+		int numGroups = 1;
+		int numMoves = 0;
+
+		if (grid.method == ESTIMATE_SIS)
+			numMoves = GroupMoves(prober, cell, moves, groups, firsts, numGroups);
+		else
+		{
+			for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+			{
+				size_t next = size_t(cell + grid.offset[dir]);
+
+				if (grid.open[next] && prober.visited[next] != prober.probe)
+					moves[numMoves++] = next;
+			}
+
+		}//end plain moves
+
+		//Only the moves the exit can still be reached from are chosen from. Moves joined around
+		//the cell reach it or not together, and at least one of them does
+		if (numGroups > 1)
+		{
+			bool reaches[NUM_DIRECTIONS];
+			int kept = 0;
+
+			if (numGroups == 2)
+				RaceToExit(prober, moves[firsts[0]], moves[firsts[1]], reaches[0], reaches[1]);
+			else
+			{
+				char results[NUM_DIRECTIONS];
+				unsigned int stampBase = prober.search + 1;
+				int found = 0;
+
+				for (int g = 0; g < numGroups; g++)
+				{
+					if (g == numGroups - 1 && found == 0)
+						reaches[g] = true;
+					else
+					{
+						reaches[g] = CanReachExit(prober, moves[firsts[g]], stampBase, results);
+						results[g] = reaches[g];
+					}
+
+					found += reaches[g];
+				}
+
+			}//end search each group
+
+			for (int i = 0; i < numMoves; i++)
+			{
+				if (reaches[groups[i]])
+					moves[kept++] = moves[i];
+			}
+
+			numMoves = kept;
+
+		}//end keep moves toward the exit
+
+		if (numMoves == 0)
+			return -numeric_limits<double>::infinity();
+
+		logWeight += log(double(numMoves));
+		cell = moves[prober.random() % numMoves];
+		prober.visited[cell] = prober.probe;
+
+	}//end while
+
+	return logWeight;
+
+}//end RunProbe
+
+
+/***************************************************************************************************/
+
+
+//pre: grid has been laid out, work has been initialized
+//post: batches of probes have been added to work's totals until it was done
+static void ProbeWorker(	/*in*/const ProbeGrid *grid,		//board laid out for probes
+							/*inout*/EstimateWork *work,		//state shared by every thread
+							/*in*/unsigned int seed)			//this thread's random seed
+{
+	Prober prober;
+	bool done = false;
+
+	prober.grid = grid;
+	prober.random.seed(seed);
+	prober.visited.assign(grid->open.size(), 0);
+	prober.reached.assign(grid->open.size(), 0);
+	prober.probe = 0;
+	prober.search = 0;
+
+	while (!done)
+	{
+		LogSum batch;
+
+		batch.maxLog = -numeric_limits<double>::infinity();
+		batch.sum = 0;
+		batch.sumSquares = 0;
+		batch.count = 0;
+
+		//Probes of large boards are slow, so the time is looked at after each one
+		for (int i = 0; i < PROBE_BATCH && !work->stop; i++)
+		{
+			AddEstimate(batch, RunProbe(prober));
+			if (chrono::steady_clock::now() - work->start >= work->budget)
+				break;
+		}
+
+		lock_guard<mutex> guard(work->lock);
+		MergeSums(work->totals, batch);
+
+		if (chrono::steady_clock::now() - work->start >= work->budget ||
+			(work->totals.count >= MIN_PROBES && RelativeError(work->totals) <= ESTIMATE_PRECISION))
+			work->stop = true;
+
+		done = work->stop;
+
+	}//end while
+
+}//end ProbeWorker
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, entry and exit are open cells within its bounds, threads and
+//		seconds are greater than zero
+//post: estimate holds the estimated number of paths from entry to exit, found by probes of the
+//		given method on threads threads. The probes stopped once the 95% confidence interval was
+//		within ESTIMATE_PRECISION of the estimate, after at least MIN_PROBES, or after seconds
+void EstimatePaths(	/*in*/Board &gb,					//board to estimate
+					/*in*/Location entry,				//starting location
+					/*in*/Location exit,				//location to reach
+					/*in*/EstimateMethod method,		//how probes choose their moves
+					/*in*/int threads,					//number of threads
+					/*in*/double seconds,				//most time to take
+					/*out*/PathEstimate &estimate)		//estimated number of paths
+{
+	ProbeGrid grid;
+	EstimateWork work;
+	vector<thread> workers;
+	random_device device;
+	Location loc;
+
+	grid.width = size_t(gb.GetLength()) + 2;
+	grid.open.assign((size_t(gb.GetHeight()) + 2) * grid.width, 0);
+	for (loc.row = 0; loc.row < gb.GetHeight(); loc.row++)
+	{
+		for (loc.col = 0; loc.col < gb.GetLength(); loc.col++)
+			grid.open[(size_t(loc.row) + 1) * grid.width + loc.col + 1] = gb.IsOpen(loc);
+	}
+
+	grid.offset[NORTH] = -(long long)grid.width;
+	grid.offset[SOUTH] = (long long)grid.width;
+	grid.offset[EAST] = 1;
+	grid.offset[WEST] = -1;
+	grid.entryCell = (size_t(entry.row) + 1) * grid.width + entry.col + 1;
+	grid.exitCell = (size_t(exit.row) + 1) * grid.width + exit.col + 1;
+	grid.method = method;
+
+	work.totals.maxLog = -numeric_limits<double>::infinity();
+	work.totals.sum = 0;
+	work.totals.sumSquares = 0;
+	work.totals.count = 0;
+	work.stop = false;
+	work.budget = chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(seconds));
+	work.start = chrono::steady_clock::now();
+
+	for (int t = 0; t < threads; t++)
+		workers.push_back(thread(ProbeWorker, &grid, &work, device() + unsigned(t)));
+	for (int t = 0; t < threads; t++)
+		workers[t].join();
+
+	estimate.found = work.totals.sum > 0;
+	estimate.log10Paths = estimate.found ?
+		(work.totals.maxLog + log(work.totals.sum / double(work.totals.count))) / LOG_10 : 0;
+	estimate.relativeError = RelativeError(work.totals);
+	estimate.probes = work.totals.count;
+	estimate.seconds = chrono::duration<double>(chrono::steady_clock::now() - work.start).count();
+
+}//end EstimatePaths
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: 10 to the power log10Value has been returned to the caller as a string like 1.23e+45
+/*out*/string FormatLog10(/*in*/double log10Value)	//base 10 logarithm of the number
+{
+	ostringstream out;
+	double exponent = floor(log10Value);
+	double mantissa = pow(10.0, log10Value - exponent);
+
+	//Rounding the mantissa may carry into the exponent
+	if (mantissa >= 9.995)
+	{
+		mantissa /= 10;
+		exponent++;
+	}
+
+	out << fixed << setprecision(2) << mantissa << (exponent < 0 ? "e-" : "e+") << (long long)fabs(exponent);
+
+	return out.str();
+
+}//end FormatLog10
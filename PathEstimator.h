@@ -0,0 +1,80 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: PathEstimator.h
+Purpose: Provides the specification for the path count estimator, for mazes with too many paths to find
+			them all. A probe walks a single random path down the search tree from the entry, and its
+			estimate is the product of the number of moves it had to choose from at each step. Averaged
+			over many probes this is the number of paths, as if the search were run (Knuth's estimator).
+			A plain probe chooses among every open cell next to it, and most of its walks get stuck
+			and count nothing. With sequential importance sampling a probe only chooses among the
+			moves from which the exit can still be reached, so every walk is a path and the average
+			settles far sooner. Probes run on many threads at once, each with its own random numbers,
+			until the confidence interval is tight enough or the time is up. The estimates are kept as
+			logarithms, since the path counts of large mazes do not fit in a double.
+*/
+
+#ifndef PATHESTIMATOR_H
+#define PATHESTIMATOR_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include <string>				//Formatted estimates
+
+using namespace std;
+
+//int constants
+const int DEFAULT_ESTIMATE_SECS = 10;			//Default seconds an estimate may run for
+const long long MIN_PROBES = 1000;				//Probes run before the interval is trusted
+const int PROBE_BATCH = 64;						//Probes a thread runs between looks at the totals
+
+//Relative half width of the 95% confidence interval an estimate stops at
+const double ESTIMATE_PRECISION = 0.01;
+
+//How a probe chooses its next move
+enum EstimateMethod {ESTIMATE_KNUTH, ESTIMATE_SIS};
+
+//The outcome of an estimate
+struct PathEstimate
+{
+	bool found;					//some probe reached the exit
+	double log10Paths;			//base 10 logarithm of the estimated number of paths, if found
+	double relativeError;		//half width of the 95% confidence interval over the estimate
+	long long probes;			//probes run
+	double seconds;				//time taken
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void EstimatePaths(Board &gb, Location entry, Location exit, EstimateMethod method, int threads, double seconds,
+				   PathEstimate &estimate);
+	Given: a board, an entry and exit point, a method, a number of threads and a time budget
+		-> estimates the number of paths from the entry to the exit
+
+string FormatLog10(double log10Value);
+	Returns the number whose base 10 logarithm is given, in scientific notation
+*/
+
+
+//pre: gb is a valid gameboard, entry and exit are open cells within its bounds, threads and
+//		seconds are greater than zero
+//post: estimate holds the estimated number of paths from entry to exit, found by probes of the
+//		given method on threads threads. The probes stopped once the 95% confidence interval was
+//		within ESTIMATE_PRECISION of the estimate, after at least MIN_PROBES, or after seconds
+void EstimatePaths(	/*in*/Board &gb,					//board to estimate
+					/*in*/Location entry,				//starting location
+					/*in*/Location exit,				//location to reach
+					/*in*/EstimateMethod method,		//how probes choose their moves
+					/*in*/int threads,					//number of threads
+					/*in*/double seconds,				//most time to take
+					/*out*/PathEstimate &estimate);		//estimated number of paths
+
+//pre: none
+//post: 10 to the power log10Value has been returned to the caller as a string like 1.23e+45
+/*out*/string FormatLog10(/*in*/double log10Value);	//base 10 logarithm of the number
+
+#endif
@@ -0,0 +1,135 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: PathGenerator.cpp
+Purpose: Provides the implementation of a path generator.
+*/
+
+#include "PathGenerator.h"
+
+using namespace std;
+
+
+//pre: gb is a valid gameboard, entry and exit are within its bounds
+//post: A generator of every path from entry to exit has been created. Nothing has been searched
+//		yet, and the board is not modified or referenced after construction
+PathGenerator::PathGenerator(	/*in*/Board &gb,			//board to search
+								/*in*/Location entry,		//starting location
+								/*in*/Location exit)		//location to reach
+	: search(gb, entry, exit)
+{
+	current.moves = nullptr;
+	current.numMoves = 0;
+	current.number = 0;
+	started = false;
+	done = false;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: if there was another path, the search has stopped on it, path views its movements and
+//		true is returned to the caller. Otherwise the generator is done and false is returned
+/*out*/bool PathGenerator::Next(/*out*/PathView &path)	//view of the next path
+{
+	started = true;
+
+	if (done)
+		return false;
+
+	//With no pause interval the search only pauses when its token has been cancelled
+	if (search.Next() != SEARCH_SOLUTION)
+	{
+		done = true;
+		return false;
+
+	}//end no more paths
+
+	current.moves = search.GetMoves();
+	current.numMoves = search.GetNumMoves();
+	current.number++;
+	path = current;
+
+	return true;
+
+}//end Next
+
+
+/***************************************************************************************************/
+
+
+//pre: token is null or lives as long as the generator
+//post: the generator is done as soon as token has been cancelled, even partway through a search
+void PathGenerator::SetCancelToken(/*in*/const CancelToken *token)	//token to look at
+{
+	search.SetCancelToken(token);
+
+}//end SetCancelToken
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: true has been returned to the caller if every path has been handed back or the
+//		cancel token was cancelled
+/*out*/bool PathGenerator::IsDone() const			//boolean value returned to the caller
+{
+	return done;
+
+}//end IsDone
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the number of paths handed back so far has been returned to the caller
+/*out*/long long PathGenerator::GetCount() const		//paths handed back
+{
+	return current.number;
+
+}//end GetCount
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the number of cells expanded so far has been returned to the caller
+/*out*/long long PathGenerator::GetNodes() const		//cells expanded
+{
+	return search.GetNodes();
+
+}//end GetNodes
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: an iterator at the current path has been returned to the caller. If no path has been
+//		asked for yet, the first one has been searched for
+/*out*/PathGenerator::Iterator PathGenerator::begin()	//iterator returned to the caller
+{
+	if (!started)
+		Next(current);
+
+	return Iterator(this);
+
+}//end begin
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the iterator past the last path has been returned to the caller
+/*out*/PathGenerator::Iterator PathGenerator::end()		//iterator returned to the caller
+{
+	return Iterator(nullptr);
+
+}//end end
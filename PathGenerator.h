@@ -0,0 +1,200 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: PathGenerator.h
+Purpose: Provides the specification for a PathGenerator, a pull based way of walking every path through
+			a board. Rather than handing each solution to a callback or a file, the generator hands
+			back one solution each time it is asked, and the search goes no further until it is asked
+			again. It holds the whole search in a PathEnumerator, so asking for the next path only
+			carries on the explicit stack where it stopped. Each solution is a PathView of the
+			search's own movement buffer, nothing is copied, and it stays valid until the next path
+			is asked for. A caller can stop after any number of paths, take turns between the
+			generators of several mazes, or pass each path on to another stage as it comes. A
+			generator can be walked with Next, or with begin and end as a range.
+*/
+
+#ifndef PATHGENERATOR_H
+#define PATHGENERATOR_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include "PathEnumerator.h"		//Search state
+#include "SearchBudget.h"		//Cancel token
+#include <cstddef>				//ptrdiff_t
+#include <iterator>				//input_iterator_tag
+
+using namespace std;
+
+
+//A solution, as a view of the movements in the search's buffer
+struct PathView
+{
+	const Direction *moves;		//movements from the entry point, valid until the next path is asked for
+	int numMoves;				//number of movements in moves
+	long long number;			//solution number, from 1
+
+	const Direction *begin() const		{ return moves; }
+	const Direction *end() const		{ return moves + numMoves; }
+	int size() const					{ return numMoves; }
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+PathGenerator(Board &gb, Location entry, Location exit);
+	Creates a generator of every path from entry to exit on gb, without searching yet
+
+bool Next(PathView &path);
+	Searches on to the next path, returns false once there are none left
+
+void SetCancelToken(const CancelToken *token);
+	Ends the paths as soon as token has been cancelled
+
+bool IsDone() const;
+	Returns true once every path has been handed back, or the token was cancelled
+
+long long GetCount() const;
+	Returns the number of paths handed back so far
+
+long long GetNodes() const;
+	Returns the number of cells expanded so far
+
+Iterator begin();
+	Returns an iterator at the current path, searching for the first one if none has been asked for
+
+Iterator end();
+	Returns the iterator past the last path
+*/
+
+class PathGenerator
+{
+
+	public:
+
+		//An input iterator over the paths of a generator. Advancing it asks the generator for the
+		//next path, so every iterator of a generator moves together
+		class Iterator
+		{
+
+			public:
+
+				typedef input_iterator_tag iterator_category;
+				typedef PathView value_type;
+				typedef ptrdiff_t difference_type;
+				typedef const PathView *pointer;
+				typedef const PathView &reference;
+
+				//pre: generator is null for the end iterator
+				//post: an iterator at generator's current path has been created
+				explicit Iterator(/*in*/PathGenerator *generator)	//generator to walk
+				{
+					owner = generator;
+				}
+
+				//pre: the iterator is not the end iterator
+				//post: the current path has been returned to the caller
+				reference operator*() const				{ return owner->current; }
+				pointer operator->() const				{ return &owner->current; }
+
+				//pre: the iterator is not the end iterator
+				//post: the generator has searched on to the next path
+				Iterator &operator++()
+				{
+					owner->Next(owner->current);
+					return *this;
+				}
+
+				//pre: none
+				//post: true has been returned to the caller if both iterators are at the end, or both
+				//		are iterators of the same generator that is not at the end
+				bool operator==(/*in*/const Iterator &other) const
+				{
+					return AtEnd() == other.AtEnd() && (AtEnd() || owner == other.owner);
+				}
+
+				bool operator!=(/*in*/const Iterator &other) const	{ return !(*this == other); }
+
+			private:
+
+				//pre: none
+				//post: true has been returned to the caller if there is no current path
+				bool AtEnd() const
+				{
+					return owner == nullptr || owner->IsDone();
+				}
+
+				PathGenerator *owner;		//generator walked, null for the end iterator
+		};
+
+		/***************************************************************************************************/
+
+		//pre: gb is a valid gameboard, entry and exit are within its bounds
+		//post: A generator of every path from entry to exit has been created. Nothing has been searched
+		//		yet, and the board is not modified or referenced after construction
+		PathGenerator(	/*in*/Board &gb,			//board to search
+						/*in*/Location entry,		//starting location
+						/*in*/Location exit);		//location to reach
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: if there was another path, the search has stopped on it, path views its movements and
+		//		true is returned to the caller. Otherwise the generator is done and false is returned
+		/*out*/bool Next(							//boolean value returned to the caller
+					/*out*/PathView &path);			//view of the next path
+
+		/***************************************************************************************************/
+
+		//pre: token is null or lives as long as the generator
+		//post: the generator is done as soon as token has been cancelled, even partway through a search
+		void SetCancelToken(/*in*/const CancelToken *token);	//token to look at
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: true has been returned to the caller if every path has been handed back or the
+		//		cancel token was cancelled
+		/*out*/bool IsDone() const;				//boolean value returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the number of paths handed back so far has been returned to the caller
+		/*out*/long long GetCount() const;			//paths handed back
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the number of cells expanded so far has been returned to the caller
+		/*out*/long long GetNodes() const;			//cells expanded
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: an iterator at the current path has been returned to the caller. If no path has been
+		//		asked for yet, the first one has been searched for
+		/*out*/Iterator begin();					//iterator returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the iterator past the last path has been returned to the caller
+		/*out*/Iterator end();						//iterator returned to the caller
+
+		/***************************************************************************************************/
+
+	private:
+
+		PathEnumerator search;			//state of the search between paths
+		PathView current;				//path the iterators are at
+		bool started;					//a path has been asked for
+		bool done;						//no paths are left, or the search was cancelled
+
+		PathGenerator(const PathGenerator &);				//not copyable
+		PathGenerator &operator=(const PathGenerator &);	//not assignable
+};
+
+#endif
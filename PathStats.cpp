@@ -0,0 +1,408 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: PathStats.cpp
+Purpose: Provides the implementation for PathStats and the multi-threaded collection of path statistics.
+*/
+
+#include "PathStats.h"
+#include "Shard.h"				//Splitting the search into units
+#include <algorithm>			//max
+#include <atomic>				//Next unit to search
+#include <fstream>				//Cell count file
+#include <thread>				//Worker threads
+
+using namespace std;
+
+
+//State shared by every thread collecting statistics
+struct StatsWork
+{
+	vector<ShardUnit> units;				//units of the search, taken in order by whichever thread is free
+	atomic<int> nextUnit;					//first unit no thread has taken
+	vector<PathEnumerator*> searches;		//search of each thread
+	vector<PathStats*> stats;				//statistics of each thread
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void StatsWorker(StatsWork *work, int tid);
+	Counts the solutions of units into this thread's statistics until every unit has been taken
+
+void WriteHistogram(ostream &out, const vector<long long> &counts);
+	Writes the non-zero counts of a histogram as a JSON list of [value, count] pairs
+*/
+
+
+//pre: work holds the units, and a search and statistics for thread tid
+//post: the solutions of every unit this thread took have been counted into its statistics
+static void StatsWorker(	/*inout*/StatsWork *work,		//state shared by every thread
+							/*in*/int tid)				//index of this thread
+{
+	PathEnumerator &search = *work->searches[tid];
+	PathStats &stats = *work->stats[tid];
+	int unit;
+
+	//Units are small and many, so a thread that drew small ones simply takes more
+	while ((unit = work->nextUnit++) < int(work->units.size()))
+	{
+		const vector<Direction> &prefix = work->units[unit].moves;
+
+		//A solution shorter than the prefixes is a unit of its own
+		if (work->units[unit].solution)
+		{
+			stats.AddPath(prefix.empty() ? nullptr : &prefix[0], int(prefix.size()));
+			continue;
+
+		}//end solution unit
+
+		search.SetPrefix(prefix.empty() ? nullptr : &prefix[0], int(prefix.size()));
+
+		while (search.Next() == SEARCH_SOLUTION)
+			stats.AddSolution(search);
+
+		stats.EndSearch();
+
+	}//end while
+
+	stats.EndSearch();
+
+}//end StatsWorker
+
+
+/***************************************************************************************************/
+
+
+//pre: out is a valid output stream
+//post: each non-zero count has been written to out as [index, count], in a JSON list
+static void WriteHistogram(	/*inout*/ostream &out,					//stream to write to
+							/*in*/const vector<long long> &counts)	//count of each value
+{
+	bool first = true;
+
+	out << "[";
+	for (size_t i = 0; i < counts.size(); i++)
+	{
+		if (counts[i] == 0)
+			continue;
+
+		out << (first ? "" : ", ") << "[" << i << ", " << counts[i] << "]";
+		first = false;
+	}
+	out << "]";
+
+}//end WriteHistogram
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, entry and exit are within its bounds
+//post: Statistics of no solutions have been created
+PathStats::PathStats(	/*in*/Board &gb,			//board searched
+						/*in*/Location entry,		//starting location
+						/*in*/Location exit)		//location to reach
+{
+	height = gb.GetHeight();
+	length = gb.GetLength();
+	entryCell = size_t(entry.row) * length + entry.col;
+	exitCell = size_t(exit.row) * length + exit.col;
+	cellCounts.assign(size_t(height) * length, 0);
+	numSolutions = 0;
+
+}//end PathStats
+
+
+/***************************************************************************************************/
+
+
+//pre: search just returned SEARCH_SOLUTION, and every solution it found before since its last
+//		restart has been added to these statistics
+//post: the solution has been counted
+void PathStats::AddSolution(/*in*/const PathEnumerator &search)	//search that found the solution
+{
+	Record(search.GetMoves(), search.GetNumMoves(), search.GetKeptDepth());
+
+}//end AddSolution
+
+
+/***************************************************************************************************/
+
+
+//pre: moves holds numMoves movements of a solution
+//post: the solution has been counted
+void PathStats::AddPath(	/*in*/const Direction moves[],		//movements from the entry point
+							/*in*/int numMoves)					//number of movements
+{
+	Record(moves, numMoves, 0);
+
+}//end AddPath
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the cells of the last solution's path have been counted. Must be called before the
+//		counts are read or merged, and whenever the search is restarted
+void PathStats::EndSearch()
+{
+	while (!frameCells.empty())
+	{
+		cellCounts[frameCells.back()] += numSolutions - frameStarts.back();
+		frameCells.pop_back();
+		frameStarts.pop_back();
+		frameTurns.pop_back();
+	}
+
+}//end EndSearch
+
+
+/***************************************************************************************************/
+
+
+//pre: other is of the same board, both have ended their search
+//post: the counts of other have been added to these
+void PathStats::Merge(/*in*/const PathStats &other)		//statistics to add
+{
+	for (size_t i = 0; i < cellCounts.size(); i++)
+		cellCounts[i] += other.cellCounts[i];
+
+	lengthCounts.resize(max(lengthCounts.size(), other.lengthCounts.size()), 0);
+	for (size_t i = 0; i < other.lengthCounts.size(); i++)
+		lengthCounts[i] += other.lengthCounts[i];
+
+	turnCounts.resize(max(turnCounts.size(), other.turnCounts.size()), 0);
+	for (size_t i = 0; i < other.turnCounts.size(); i++)
+		turnCounts[i] += other.turnCounts[i];
+
+	numSolutions += other.numSolutions;
+
+}//end Merge
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the number of solutions counted has been returned to the caller
+/*out*/long long PathStats::GetNumSolutions() const		//solutions counted
+{
+	return numSolutions;
+
+}//end GetNumSolutions
+
+
+/***************************************************************************************************/
+
+
+//pre: the search has ended
+//post: the number of solutions through each cell, indexed by row * length + col, has been
+//		returned to the caller
+/*out*/const vector<long long>& PathStats::GetCellCounts() const	//solutions through each cell
+{
+	return cellCounts;
+
+}//end GetCellCounts
+
+
+/***************************************************************************************************/
+
+
+//pre: the search has ended
+//post: the number of solutions through each cell has been written to fileName as 64 bit
+//		integers, row by row. Returns true to the caller if it could be written
+/*out*/bool PathStats::WriteCellCounts(							//boolean value returned to the caller
+						/*in*/const string &fileName) const		//file to write
+{
+	ofstream outdat(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+
+	outdat.write(reinterpret_cast<const char*>(cellCounts.data()), cellCounts.size() * sizeof(long long));
+	outdat.close();
+	return !outdat.fail();
+
+}//end WriteCellCounts
+
+
+/***************************************************************************************************/
+
+
+//pre: the search has ended
+//post: the number of solutions, the shortest, longest and mean lengths, the length and turn
+//		histograms and where the cell counts were written have been written to out as JSON
+void PathStats::WriteSummary(	/*inout*/ostream &out,					//stream to write to
+								/*in*/const string &cellFile) const		//file holding the cell counts
+{
+	long long shortest = -1, longest = -1, fewestTurns = -1, mostTurns = -1;
+	double totalLength = 0, totalTurns = 0;
+
+	for (size_t i = 0; i < lengthCounts.size(); i++)
+	{
+		if (lengthCounts[i] == 0)
+			continue;
+		if (shortest < 0)
+			shortest = (long long)i;
+		longest = (long long)i;
+		totalLength += double(i) * double(lengthCounts[i]);
+	}
+
+	for (size_t i = 0; i < turnCounts.size(); i++)
+	{
+		if (turnCounts[i] == 0)
+			continue;
+		if (fewestTurns < 0)
+			fewestTurns = (long long)i;
+		mostTurns = (long long)i;
+		totalTurns += double(i) * double(turnCounts[i]);
+	}
+
+	out << "{" << endl;
+	out << "\t\"height\": " << height << "," << endl;
+	out << "\t\"length\": " << length << "," << endl;
+	out << "\t\"solutions\": " << numSolutions << "," << endl;
+	out << "\t\"shortest\": " << shortest << "," << endl;
+	out << "\t\"longest\": " << longest << "," << endl;
+	out << "\t\"meanLength\": " << (numSolutions > 0 ? totalLength / numSolutions : 0.0) << "," << endl;
+	out << "\t\"lengthHistogram\": ";
+	WriteHistogram(out, lengthCounts);
+	out << "," << endl;
+	out << "\t\"fewestTurns\": " << fewestTurns << "," << endl;
+	out << "\t\"mostTurns\": " << mostTurns << "," << endl;
+	out << "\t\"meanTurns\": " << (numSolutions > 0 ? totalTurns / numSolutions : 0.0) << "," << endl;
+	out << "\t\"turnHistogram\": ";
+	WriteHistogram(out, turnCounts);
+	out << "," << endl;
+	out << "\t\"cellCounts\": {\"file\": \"" << cellFile << "\", \"type\": \"int64\", \"order\": \"row-major\", "
+		<< "\"rows\": " << height << ", \"cols\": " << length << "}" << endl;
+	out << "}" << endl;
+
+}//end WriteSummary
+
+
+/***************************************************************************************************/
+
+
+//pre: moves holds numMoves movements of a solution, whose first kept cells are the same as
+//		the last solution's
+//post: the solution has been counted, and the cells after the kept ones opened
+void PathStats::Record(	/*in*/const Direction moves[],		//movements from the entry point
+						/*in*/int numMoves,					//number of movements
+						/*in*/int kept)						//cells kept from the last solution
+{
+	int turns;
+
+	//Cells that left the path were on it for every solution counted since they joined
+	while (int(frameCells.size()) > kept)
+	{
+		cellCounts[frameCells.back()] += numSolutions - frameStarts.back();
+		frameCells.pop_back();
+		frameStarts.pop_back();
+		frameTurns.pop_back();
+	}
+
+	//Cells that joined the path, every cell of it but the exit point
+	for (int place = int(frameCells.size()); place < numMoves; place++)
+	{
+		size_t cell = entryCell;
+		int placeTurns = 0;
+
+		if (place > 0)
+		{
+			switch (moves[place - 1])
+			{
+				case SOUTH: cell = frameCells[place - 1] + length; break;
+				case EAST: cell = frameCells[place - 1] + 1; break;
+				case NORTH: cell = frameCells[place - 1] - length; break;
+				default: cell = frameCells[place - 1] - 1; break;
+			}
+			placeTurns = frameTurns[place - 1];
+			if (place > 1 && moves[place - 1] != moves[place - 2])
+				placeTurns++;
+
+		}//end step
+
+		frameCells.push_back(cell);
+		frameStarts.push_back(numSolutions);
+		frameTurns.push_back(placeTurns);
+
+	}//end for
+
+	turns = numMoves > 0 ? frameTurns[numMoves - 1] : 0;
+	if (numMoves > 1 && moves[numMoves - 1] != moves[numMoves - 2])
+		turns++;
+
+	if (int(lengthCounts.size()) <= numMoves)
+		lengthCounts.resize(numMoves + 1, 0);
+	if (int(turnCounts.size()) <= turns)
+		turnCounts.resize(turns + 1, 0);
+
+	lengthCounts[numMoves]++;
+	turnCounts[turns]++;
+	cellCounts[exitCell]++;
+	numSolutions++;
+
+}//end Record
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, entry and exit are open cells within its bounds, threads is
+//		greater than zero
+//post: every solution from entry to exit has been counted into stats, which has ended its
+//		search. Each thread counted its share of the search into statistics of its own, added
+//		together once every thread was done
+void CollectPathStats(	/*in*/Board &gb,			//board to search
+						/*in*/Location entry,		//starting location
+						/*in*/Location exit,		//location to reach
+						/*in*/int threads,			//number of threads
+						/*inout*/PathStats &stats)	//statistics to count into
+{
+	StatsWork work;
+	vector<thread> workers;
+
+	//A single thread searches the whole tree as one unit
+	if (threads > 1)
+		PlanShards(gb, entry, exit, threads, work.units);
+	else
+	{
+		work.units.resize(1);
+		work.units[0].solution = false;
+		work.units[0].weight = 1;
+		work.units[0].shard = 0;
+
+	}//end single unit
+
+	work.nextUnit = 0;
+
+	//Searches read the board as they are built, so they are built before any thread starts
+	for (int t = 0; t < threads; t++)
+	{
+		work.searches.push_back(new PathEnumerator(gb, entry, exit));
+		work.stats.push_back(t == 0 ? &stats : new PathStats(gb, entry, exit));
+	}
+
+	//This thread searches as thread 0
+	for (int t = 1; t < threads; t++)
+		workers.push_back(thread(StatsWorker, &work, t));
+	StatsWorker(&work, 0);
+
+	for (size_t t = 0; t < workers.size(); t++)
+		workers[t].join();
+
+	//Add every thread's statistics into the caller's
+	for (int t = 0; t < threads; t++)
+	{
+		if (t > 0)
+		{
+			stats.Merge(*work.stats[t]);
+			delete work.stats[t];
+		}
+		delete work.searches[t];
+
+	}//end for
+
+}//end CollectPathStats
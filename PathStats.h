@@ -0,0 +1,171 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: PathStats.h
+Purpose: Provides the specification for PathStats. Path statistics are the totals over every solution of a
+			maze: how many solutions pass through each cell, how many solutions there are of each length
+			and of each number of turns. They are kept as the search runs, without writing or keeping
+			any path. Each cell of the current path remembers how many solutions had been counted when
+			it joined the path, so when it leaves, every solution counted since passed through it. Only
+			the cells that changed since the last solution are looked at, so counting a solution costs
+			about as much as the search spent finding it.
+*/
+
+#ifndef PATHSTATS_H
+#define PATHSTATS_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include "PathEnumerator.h"		//Exhaustive search
+#include <ostream>				//Summary
+#include <string>				//File names
+#include <vector>				//Counts
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+PathStats(Board &gb, Location entry, Location exit);
+	Creates empty statistics for the paths from entry to exit on gb
+
+void AddSolution(const PathEnumerator &search);
+	Counts the solution the search has just found
+
+void AddPath(const Direction moves[], int numMoves);
+	Counts a solution given by its movements
+
+void EndSearch();
+	Finishes counting the cells of the last solution's path
+
+void Merge(const PathStats &other);
+	Adds the counts of other to these
+
+long long GetNumSolutions() const;
+	Returns the number of solutions counted
+
+const vector<long long>& GetCellCounts() const;
+	Returns the number of solutions through each cell
+
+bool WriteCellCounts(const string &fileName) const;
+	Writes the number of solutions through each cell to fileName as a dense array
+
+void WriteSummary(ostream &out, const string &cellFile) const;
+	Writes the totals to out as JSON
+
+void CollectPathStats(Board &gb, Location entry, Location exit, int threads, PathStats &stats);
+	Given: a board, an entry and exit point and a number of threads
+		-> counts every solution into stats, the search split across the threads
+*/
+
+class PathStats
+{
+
+	public:
+
+		//pre: gb is a valid gameboard, entry and exit are within its bounds
+		//post: Statistics of no solutions have been created
+		PathStats(	/*in*/Board &gb,			//board searched
+					/*in*/Location entry,		//starting location
+					/*in*/Location exit);		//location to reach
+
+		/***************************************************************************************************/
+
+		//pre: search just returned SEARCH_SOLUTION, and every solution it found before since its last
+		//		restart has been added to these statistics
+		//post: the solution has been counted
+		void AddSolution(/*in*/const PathEnumerator &search);	//search that found the solution
+
+		/***************************************************************************************************/
+
+		//pre: moves holds numMoves movements of a solution
+		//post: the solution has been counted
+		void AddPath(	/*in*/const Direction moves[],		//movements from the entry point
+						/*in*/int numMoves);				//number of movements
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the cells of the last solution's path have been counted. Must be called before the
+		//		counts are read or merged, and whenever the search is restarted
+		void EndSearch();
+
+		/***************************************************************************************************/
+
+		//pre: other is of the same board, both have ended their search
+		//post: the counts of other have been added to these
+		void Merge(/*in*/const PathStats &other);		//statistics to add
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the number of solutions counted has been returned to the caller
+		/*out*/long long GetNumSolutions() const;		//solutions counted
+
+		/***************************************************************************************************/
+
+		//pre: the search has ended
+		//post: the number of solutions through each cell, indexed by row * length + col, has been
+		//		returned to the caller
+		/*out*/const vector<long long>& GetCellCounts() const;	//solutions through each cell
+
+		/***************************************************************************************************/
+
+		//pre: the search has ended
+		//post: the number of solutions through each cell has been written to fileName as 64 bit
+		//		integers, row by row. Returns true to the caller if it could be written
+		/*out*/bool WriteCellCounts(						//boolean value returned to the caller
+						/*in*/const string &fileName) const;	//file to write
+
+		/***************************************************************************************************/
+
+		//pre: the search has ended
+		//post: the number of solutions, the shortest, longest and mean lengths, the length and turn
+		//		histograms and where the cell counts were written have been written to out as JSON
+		void WriteSummary(	/*inout*/ostream &out,					//stream to write to
+							/*in*/const string &cellFile) const;	//file holding the cell counts
+
+		/***************************************************************************************************/
+
+	private:
+
+		//pre: moves holds numMoves movements of a solution, whose first kept cells are the same as
+		//		the last solution's
+		//post: the solution has been counted, and the cells after the kept ones opened
+		void Record(	/*in*/const Direction moves[],		//movements from the entry point
+						/*in*/int numMoves,					//number of movements
+						/*in*/int kept);					//cells kept from the last solution
+
+		/***************************************************************************************************/
+
+		//Cells are numbered row * length + col
+
+		vector<long long> cellCounts;		//solutions through each cell
+		vector<long long> lengthCounts;		//solutions of each number of movements
+		vector<long long> turnCounts;		//solutions of each number of turns
+		vector<size_t> frameCells;			//cell of each place on the current path
+		vector<long long> frameStarts;		//solutions counted when each place joined the path
+		vector<int> frameTurns;				//turns on the path up to each place
+		long long numSolutions;				//solutions counted
+		size_t entryCell;					//cell of the entry point
+		size_t exitCell;					//cell of the exit point
+		int height;							//rows of the board
+		int length;							//cols of the board
+};
+
+
+//pre: gb is a valid gameboard, entry and exit are open cells within its bounds, threads is
+//		greater than zero
+//post: every solution from entry to exit has been counted into stats, which has ended its
+//		search. Each thread counted its share of the search into statistics of its own, added
+//		together once every thread was done
+void CollectPathStats(	/*in*/Board &gb,			//board to search
+						/*in*/Location entry,		//starting location
+						/*in*/Location exit,		//location to reach
+						/*in*/int threads,			//number of threads
+						/*inout*/PathStats &stats);	//statistics to count into
+
+#endif
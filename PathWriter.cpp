@@ -0,0 +1,172 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: PathWriter.cpp
+Purpose: Provides the implementation for writing a solution path to an output stream.
+*/
+
+#include "PathWriter.h"
+
+using namespace std;
+
+
+//pre: direction is a valid Direction
+//post: the string literal for the given direction has been returned to the caller
+/*out*/const string& DirectionString(	//string literal returned to the caller
+					/*in*/Direction direction)	//direction to look up
+{
+	switch (direction)
+	{
+	case NORTH:
+		return NORTH_STR;
+
+	case SOUTH:
+		return SOUTH_STR;
+
+	case EAST:
+		return EAST_STR;
+
+	default:
+		return WEST_STR;
+
+	}//end switch
+
+}//end DirectionString
+
+
+/***************************************************************************************************/
+
+
+//pre: outdat is a valid output stream
+//		moves contains numMoves valid movements, starting from the entry point
+//		solutionNum is the current number of solutions for the board
+//post: The solution has been written to outdat
+void WriteMovesToFile(	/*inout*/ostream &outdat,			//output stream to be written to
+						/*in*/const Direction moves[],		//movements taken from the entry point
+						/*in*/int numMoves,					//number of movements in moves
+						/*in*/int solutionNum)				//current solution number
+{
+	string buffer;
+
+	AppendMoves(buffer, moves, numMoves, solutionNum);
+	outdat.write(buffer.data(), buffer.size());
+
+}//end WriteMovesToFile
+
+
+/***************************************************************************************************/
+
+
+//pre: moves contains numMoves valid movements, starting from the entry point
+//		solutionNum is the current number of solutions for the board
+//post: The solution has been appended to buffer
+void AppendMoves(	/*inout*/string &buffer,			//buffer to append to
+					/*in*/const Direction moves[],		//movements taken from the entry point
+					/*in*/int numMoves,					//number of movements in moves
+					/*in*/int solutionNum)				//current solution number
+{
+	AppendMoves(buffer, moves, numMoves, solutionNum, START, END);
+
+}//end AppendMoves
+
+
+/***************************************************************************************************/
+
+
+//pre: moves contains numMoves valid movements, starting from the entry point
+//		solutionNum is the current number of solutions for the board, end ends with END_PATH
+//post: The solution has been appended to buffer, with start as its entry line and end as its exit line
+void AppendMoves(	/*inout*/string &buffer,			//buffer to append to
+					/*in*/const Direction moves[],		//movements taken from the entry point
+					/*in*/int numMoves,					//number of movements in moves
+					/*in*/int solutionNum,				//current solution number
+					/*in*/const string &start,			//entry line
+					/*in*/const string &end)			//exit line
+{
+	buffer += PATH_NUM;
+	buffer += to_string(solutionNum);
+	buffer += '\n';
+	buffer += start;
+	buffer += '\n';
+
+	for (int i = 0; i < numMoves; i++)
+	{
+		buffer += DirectionString(moves[i]);
+		buffer += '\n';
+	}
+
+	buffer += end;
+	buffer += "\n\n";
+
+}//end AppendMoves
+
+
+/***************************************************************************************************/
+
+
+//pre: moves contains numMoves movements, starting from the entry point, each an index into names
+//		solutionNum is the current number of solutions for the board
+//post: The solution has been appended to buffer, each movement written as its name
+void AppendMoves(	/*inout*/string &buffer,			//buffer to append to
+					/*in*/const int moves[],			//movements taken from the entry point
+					/*in*/int numMoves,					//number of movements in moves
+					/*in*/int solutionNum,				//current solution number
+					/*in*/const vector<string> &names)	//name of each movement
+{
+	buffer += PATH_NUM;
+	buffer += to_string(solutionNum);
+	buffer += '\n';
+	buffer += START;
+	buffer += '\n';
+
+	for (int i = 0; i < numMoves; i++)
+	{
+		buffer += names[moves[i]];
+		buffer += '\n';
+	}
+
+	buffer += END;
+	buffer += "\n\n";
+
+}//end AppendMoves
+
+
+/***************************************************************************************************/
+
+
+//pre: moves contains numMoves valid movements, starting from the entry point
+//		solutionNum is the current number of solutions for the board
+//post: the number of bytes AppendMoves would append for the solution has been returned to the caller
+/*out*/size_t MovesSize(						//bytes returned to the caller
+					/*in*/const Direction moves[],		//movements taken from the entry point
+					/*in*/int numMoves,					//number of movements in moves
+					/*in*/int solutionNum)				//current solution number
+{
+	return MovesSize(moves, numMoves, solutionNum, START, END);
+
+}//end MovesSize
+
+
+/***************************************************************************************************/
+
+
+//pre: moves contains numMoves valid movements, starting from the entry point
+//		solutionNum is the current number of solutions for the board
+//post: the number of bytes AppendMoves would append for the solution between start and end has
+//		been returned to the caller
+/*out*/size_t MovesSize(						//bytes returned to the caller
+					/*in*/const Direction moves[],		//movements taken from the entry point
+					/*in*/int numMoves,					//number of movements in moves
+					/*in*/int solutionNum,				//current solution number
+					/*in*/const string &start,			//entry line
+					/*in*/const string &end)			//exit line
+{
+	size_t size = PATH_NUM.size() + to_string(solutionNum).size() + start.size() + end.size() + 4;
+
+	for (int i = 0; i < numMoves; i++)
+		size += DirectionString(moves[i]).size() + 1;
+
+	return size;
+
+}//end MovesSize
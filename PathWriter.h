@@ -0,0 +1,136 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: PathWriter.h
+Purpose: Provides the specification for writing a solution path to an output stream. A path is given
+			as the list of movements taken from the entry point, and is written in the same format
+			as the solution file ("PATH NUMBER: n", the entry line, one direction per line, the exit line).
+			A maze with doors of its own writes the entry and exit lines of the doors a path joins
+			instead, and every exit line ends the same way so a path's end can always be found.
+*/
+
+#ifndef PATHWRITER_H
+#define PATHWRITER_H
+
+#include "Direction.h"			//Direction enum and string literals
+#include <ostream>				//Output stream
+#include <string>				//String literals
+#include <vector>				//Movement names
+
+using namespace std;
+
+//String constants
+const string START = "START. ENTER FROM NORTH.";					//Entry string literal
+const string PATH_NUM = "PATH NUMBER: ";							//Path number string literal
+const string END_PATH = "END PATH.";								//End of every path exit line
+const string END = "EXIT SOUTH. " + END_PATH;						//Path exit string literal
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+const string& DirectionString(Direction direction);
+	Given: a direction
+		-> returns the string literal for that direction
+
+void WriteMovesToFile(ostream &outdat, const Direction moves[], int numMoves, int solutionNum);
+	Given: an output stream, a list of movements from the entry point, and a solution number
+		-> writes the solution to the stream in the solution file format
+
+void AppendMoves(string &buffer, const Direction moves[], int numMoves, int solutionNum);
+	Given: a buffer, a list of movements from the entry point, and a solution number
+		-> appends the solution to the buffer in the solution file format
+
+void AppendMoves(string &buffer, const Direction moves[], int numMoves, int solutionNum, const string &start,
+				 const string &end);
+	Given: a buffer, a list of movements from the entry point, a solution number, and its entry and exit lines
+		-> appends the solution to the buffer in the solution file format, between those lines
+
+void AppendMoves(string &buffer, const int moves[], int numMoves, int solutionNum, const vector<string> &names);
+	Given: a buffer, a list of numbered movements from the entry point, a solution number, and their names
+		-> appends the solution to the buffer in the solution file format, each movement written by its name
+
+size_t MovesSize(const Direction moves[], int numMoves, int solutionNum);
+	Given: a list of movements from the entry point, and a solution number
+		-> returns the number of bytes AppendMoves would append
+
+size_t MovesSize(const Direction moves[], int numMoves, int solutionNum, const string &start, const string &end);
+	Given: a list of movements from the entry point, a solution number, and its entry and exit lines
+		-> returns the number of bytes AppendMoves would append between those lines
+*/
+
+
+//pre: direction is a valid Direction
+//post: the string literal for the given direction has been returned to the caller
+/*out*/const string& DirectionString(	//string literal returned to the caller
+					/*in*/Direction direction);	//direction to look up
+
+/***************************************************************************************************/
+
+//pre: outdat is a valid output stream
+//		moves contains numMoves valid movements, starting from the entry point
+//		solutionNum is the current number of solutions for the board
+//post: The solution has been written to outdat
+void WriteMovesToFile(	/*inout*/ostream &outdat,			//output stream to be written to
+						/*in*/const Direction moves[],		//movements taken from the entry point
+						/*in*/int numMoves,					//number of movements in moves
+						/*in*/int solutionNum);				//current solution number
+
+/***************************************************************************************************/
+
+//pre: moves contains numMoves valid movements, starting from the entry point
+//		solutionNum is the current number of solutions for the board
+//post: The solution has been appended to buffer
+void AppendMoves(	/*inout*/string &buffer,			//buffer to append to
+					/*in*/const Direction moves[],		//movements taken from the entry point
+					/*in*/int numMoves,					//number of movements in moves
+					/*in*/int solutionNum);				//current solution number
+
+/***************************************************************************************************/
+
+//pre: moves contains numMoves valid movements, starting from the entry point
+//		solutionNum is the current number of solutions for the board, end ends with END_PATH
+//post: The solution has been appended to buffer, with start as its entry line and end as its exit line
+void AppendMoves(	/*inout*/string &buffer,			//buffer to append to
+					/*in*/const Direction moves[],		//movements taken from the entry point
+					/*in*/int numMoves,					//number of movements in moves
+					/*in*/int solutionNum,				//current solution number
+					/*in*/const string &start,			//entry line
+					/*in*/const string &end);			//exit line
+
+/***************************************************************************************************/
+
+//pre: moves contains numMoves movements, starting from the entry point, each an index into names
+//		solutionNum is the current number of solutions for the board
+//post: The solution has been appended to buffer, each movement written as its name
+void AppendMoves(	/*inout*/string &buffer,			//buffer to append to
+					/*in*/const int moves[],			//movements taken from the entry point
+					/*in*/int numMoves,					//number of movements in moves
+					/*in*/int solutionNum,				//current solution number
+					/*in*/const vector<string> &names);	//name of each movement
+
+/***************************************************************************************************/
+
+//pre: moves contains numMoves valid movements, starting from the entry point
+//		solutionNum is the current number of solutions for the board
+//post: the number of bytes AppendMoves would append for the solution has been returned to the caller
+/*out*/size_t MovesSize(						//bytes returned to the caller
+					/*in*/const Direction moves[],		//movements taken from the entry point
+					/*in*/int numMoves,					//number of movements in moves
+					/*in*/int solutionNum);				//current solution number
+
+/***************************************************************************************************/
+
+//pre: moves contains numMoves valid movements, starting from the entry point
+//		solutionNum is the current number of solutions for the board
+//post: the number of bytes AppendMoves would append for the solution between start and end has
+//		been returned to the caller
+/*out*/size_t MovesSize(						//bytes returned to the caller
+					/*in*/const Direction moves[],		//movements taken from the entry point
+					/*in*/int numMoves,					//number of movements in moves
+					/*in*/int solutionNum,				//current solution number
+					/*in*/const string &start,			//entry line
+					/*in*/const string &end);			//exit line
+
+#endif
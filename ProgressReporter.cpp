@@ -0,0 +1,295 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: ProgressReporter.cpp
+Purpose: Provides the implementation of a progress reporter.
+*/
+
+#include "ProgressReporter.h"
+#include <cstdio>				//snprintf
+#include <iostream>				//cerr
+#include <sstream>				//Building a sample line
+
+using namespace std;
+
+//int constants
+const long long DONE_SCALE = 1000000;			//Millionths of the search in the whole of it
+const int PREFIX_COUNT_BITS = 8;				//Bits of the packed prefix holding its number of movements
+
+//String constants
+const string PROGRESS_STR = "Progress ";		//Start of a console sample
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+string FormatClock(double seconds);
+	Returns seconds as hours, minutes and seconds, hh:mm:ss
+*/
+
+
+//pre: seconds is not negative
+//post: seconds has been returned to the caller as hh:mm:ss, with as many digits of hours as needed
+static /*out*/string FormatClock(/*in*/double seconds)	//time to format
+{
+	long long whole = (long long)seconds;
+	char text[32];
+
+	snprintf(text, sizeof(text), "%02lld:%02lld:%02lld", whole / 3600, whole / 60 % 60, whole % 60);
+	return text;
+
+}//end FormatClock
+
+
+/***************************************************************************************************/
+
+
+//pre: intervalSecs is greater than zero
+//post: A reporter has been created. Nothing is sampled until Start is called
+ProgressReporter::ProgressReporter(	/*in*/int inIntervalSecs,			//seconds between samples
+									/*in*/const string &inJsonFile)		//file to append JSON lines to, empty for the console
+{
+	intervalSecs = inIntervalSecs;
+	jsonFile = inJsonFile;
+	stopping = false;
+	published = false;
+	lastSolutions = 0;
+	lastNodes = 0;
+	solutionCount.store(0);
+	nodeCount.store(0);
+	pathDepth.store(0);
+	prefix.store(0);
+	doneMillionths.store(0);
+	firstDone.store(0);
+	firstSolutions.store(0);
+	firstNodes.store(0);
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: ProgressReporter has been initialized
+//post: the sampling thread has been stopped
+ProgressReporter::~ProgressReporter()
+{
+	Stop();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: Start has not been called
+//post: if the JSON lines file, if any, could be opened, the sampling thread has been started and
+//		true is returned to the caller. Otherwise nothing is sampled and false is returned
+/*out*/bool ProgressReporter::Start()				//boolean value returned to the caller
+{
+	//Samples are added to the end, so a resumed run carries on the same file
+	if (!jsonFile.empty())
+	{
+		jsonOut.open(jsonFile.c_str(), ios::out | ios::app);
+		if (!jsonOut)
+			return false;
+
+	}//end JSON lines file
+
+	startTime = chrono::steady_clock::now();
+	lastTime = startTime;
+	sampler = thread(&ProgressReporter::SampleLoop, this);
+	return true;
+
+}//end Start
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: if the sampling thread was running, it has been stopped and a last sample written
+void ProgressReporter::Stop()
+{
+	if (!sampler.joinable())
+		return;
+
+	{
+		lock_guard<mutex> lock(stopLock);
+		stopping = true;
+	}
+	stopSignal.notify_one();
+	sampler.join();
+
+	//The last sample shows where the search ended, and how fast it went on the whole
+	WriteSample(true);
+
+	if (jsonOut.is_open())
+		jsonOut.close();
+
+}//end Stop
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the search thread, moves holds numMoves movements from the entry point,
+//		fraction is from 0 to 1
+//post: the next sample shows the expanded cells, the depth, the first movements of moves and the
+//		share of the search done. The first share stored is taken as done before this run
+void ProgressReporter::SetSearch(	/*in*/long long nodes,			//cells expanded so far
+									/*in*/int depth,				//cells on the current path
+									/*in*/const Direction moves[],	//movements of the current path
+									/*in*/int numMoves,				//number of movements in moves
+									/*in*/double fraction)			//estimated share of the search done
+{
+	unsigned long long packed;
+	int shown = numMoves < PROGRESS_PREFIX_MOVES ? numMoves : PROGRESS_PREFIX_MOVES;
+
+	//A search that has not started has no path
+	if (shown < 0)
+		shown = 0;
+
+	//Two bits a movement above the count, so the prefix is read whole or not at all
+	packed = (unsigned long long)shown;
+	for (int i = 0; i < shown; i++)
+		packed |= (unsigned long long)moves[i] << (PREFIX_COUNT_BITS + 2 * i);
+
+	//A resumed search starts partway, which the time left must not count as this run's work
+	if (!published)
+	{
+		published = true;
+		firstDone.store((long long)(fraction * DONE_SCALE), memory_order_relaxed);
+		firstSolutions.store(solutionCount.load(memory_order_relaxed), memory_order_relaxed);
+		firstNodes.store(nodes, memory_order_relaxed);
+
+	}//end first store
+
+	nodeCount.store(nodes, memory_order_relaxed);
+	pathDepth.store(depth, memory_order_relaxed);
+	prefix.store(packed, memory_order_relaxed);
+	doneMillionths.store((long long)(fraction * DONE_SCALE), memory_order_relaxed);
+
+}//end SetSearch
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the sampling thread
+//post: samples have been written every interval until Stop was called
+void ProgressReporter::SampleLoop()
+{
+	unique_lock<mutex> lock(stopLock);
+
+	while (!stopping)
+	{
+		//Stop wakes the thread at once rather than after the rest of the interval
+		if (stopSignal.wait_for(lock, chrono::seconds(intervalSecs)) == cv_status::timeout && !stopping)
+		{
+			lock.unlock();
+			WriteSample(false);
+			lock.lock();
+
+		}//end sample
+
+	}//end while
+
+}//end SampleLoop
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the sampling thread, or after it has stopped
+//post: a sample of the counters has been written to the console or the JSON lines file, with
+//		their rates over the last interval or, if whole, over the whole run
+void ProgressReporter::WriteSample(/*in*/bool whole)		//rates over the whole run
+{
+	chrono::steady_clock::time_point now = chrono::steady_clock::now();
+	long long solutions = solutionCount.load(memory_order_relaxed);
+	long long nodes = nodeCount.load(memory_order_relaxed);
+	int depth = pathDepth.load(memory_order_relaxed);
+	unsigned long long packed = prefix.load(memory_order_relaxed);
+	long long done = doneMillionths.load(memory_order_relaxed);
+	long long before = firstDone.load(memory_order_relaxed);
+	double elapsed = chrono::duration<double>(now - startTime).count();
+	double interval;
+	double eta = -1;												//seconds left, negative if unknown
+	string path;
+	ostringstream line;
+
+	if (whole)
+	{
+		lastTime = startTime;
+		lastSolutions = firstSolutions.load(memory_order_relaxed);
+		lastNodes = firstNodes.load(memory_order_relaxed);
+
+	}//end whole run
+
+	interval = chrono::duration<double>(now - lastTime).count();
+
+	//The rest of the search goes at the rate the share done has grown since the start
+	if (done > before && done < DONE_SCALE)
+		eta = elapsed * (DONE_SCALE - done) / (done - before);
+	else if (done >= DONE_SCALE)
+		eta = 0;
+
+	for (int i = 0; i < int(packed & ((1 << PREFIX_COUNT_BITS) - 1)); i++)
+	{
+		switch (Direction((packed >> (PREFIX_COUNT_BITS + 2 * i)) & 3))
+		{
+		case NORTH:
+			path += NORTH_STR[0];
+			break;
+		case SOUTH:
+			path += SOUTH_STR[0];
+			break;
+		case EAST:
+			path += EAST_STR[0];
+			break;
+		case WEST:
+			path += WEST_STR[0];
+			break;
+
+		}//end switch
+
+	}//end for
+
+	if (jsonOut.is_open())
+	{
+		line << "{\"seconds\": " << elapsed << ", \"done\": " << double(done) / DONE_SCALE << ", \"etaSeconds\": ";
+		if (eta < 0)
+			line << "null";
+		else
+			line << eta;
+
+		line << ", \"solutions\": " << solutions << ", \"solutionsPerSecond\": "
+			 << (interval > 0 ? (solutions - lastSolutions) / interval : 0.0)
+			 << ", \"nodes\": " << nodes << ", \"nodesPerSecond\": "
+			 << (interval > 0 ? (nodes - lastNodes) / interval : 0.0)
+			 << ", \"depth\": " << depth << ", \"prefix\": \"" << path << "\"}";
+
+		jsonOut << line.str() << endl;
+
+	}//end JSON line
+
+	else
+	{
+		line.setf(ios::fixed);
+		line.precision(2);
+		line << PROGRESS_STR << FormatClock(elapsed) << " " << double(done) * 100 / DONE_SCALE << "% done, ETA "
+			 << (eta < 0 ? string("unknown") : FormatClock(eta)) << ". Solutions: " << solutions;
+		line.precision(0);
+		line << " (" << (interval > 0 ? (solutions - lastSolutions) / interval : 0.0) << "/s) Cells: " << nodes
+			 << " (" << (interval > 0 ? (nodes - lastNodes) / interval : 0.0) << "/s) Depth: " << depth
+			 << " Path: " << path << (depth - 1 > PROGRESS_PREFIX_MOVES ? "..." : "");
+
+		cerr << line.str() << endl;
+
+	}//end console line
+
+	lastTime = now;
+	lastSolutions = solutions;
+	lastNodes = nodes;
+
+}//end WriteSample
@@ -0,0 +1,154 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: ProgressReporter.h
+Purpose: Provides the specification for a ProgressReporter. A progress reporter shows how a long
+			search is getting on while it runs. The search stores its solutions, expanded cells, depth
+			and the first movements of its current path in relaxed atomics whenever it already stops
+			to look at the clock, so it never waits on the reporter; a sampling thread of its own reads
+			them once an interval and writes a line of status to the console, or a line of JSON to a
+			file. The search also stores an estimate of the share of its tree it has got through, from
+			how many of the branches of each frame of its path it has finished, which gives the time
+			left at the rate that share has grown.
+*/
+
+#ifndef PROGRESSREPORTER_H
+#define PROGRESSREPORTER_H
+
+#include "Direction.h"			//Direction enum
+#include <atomic>				//Counters shared with the search
+#include <chrono>				//Sample times
+#include <condition_variable>	//Waking the sampling thread to stop
+#include <fstream>				//JSON lines file
+#include <mutex>				//Stop flag
+#include <string>				//File names
+#include <thread>				//Sampling thread
+
+using namespace std;
+
+//int constants
+const int DEFAULT_PROGRESS_SECS = 10;			//Default seconds between samples
+const int PROGRESS_PREFIX_MOVES = 24;			//Movements of the current path shown in a sample
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ProgressReporter(int intervalSecs, const string &jsonFile);
+	Creates a new ProgressReporter sampling every intervalSecs seconds, to jsonFile or the console
+
+~ProgressReporter();
+	Stops the sampling thread if Stop has not been called
+
+bool Start();
+	Starts the sampling thread, returns false if the JSON lines file could not be opened
+
+void Stop();
+	Stops the sampling thread and writes a last sample
+
+void SetSolutions(long long solutions);
+	Stores the number of solutions found so far
+
+void SetSearch(long long nodes, int depth, const Direction moves[], int numMoves, double fraction);
+	Stores the expanded cells, the current path and the share of the search done so far
+*/
+
+class ProgressReporter
+{
+
+	public:
+
+		//pre: intervalSecs is greater than zero
+		//post: A reporter has been created. Nothing is sampled until Start is called
+		ProgressReporter(	/*in*/int intervalSecs,				//seconds between samples
+							/*in*/const string &jsonFile);		//file to append JSON lines to, empty for the console
+
+		/***************************************************************************************************/
+
+		//pre: ProgressReporter has been initialized
+		//post: the sampling thread has been stopped
+		~ProgressReporter();
+
+		/***************************************************************************************************/
+
+		//pre: Start has not been called
+		//post: if the JSON lines file, if any, could be opened, the sampling thread has been started and
+		//		true is returned to the caller. Otherwise nothing is sampled and false is returned
+		/*out*/bool Start();						//boolean value returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: if the sampling thread was running, it has been stopped and a last sample written
+		void Stop();
+
+		/***************************************************************************************************/
+
+		//pre: called from the search thread
+		//post: the next sample shows solutions solutions
+		void SetSolutions(/*in*/long long solutions)	//solutions found so far
+		{
+			solutionCount.store(solutions, memory_order_relaxed);
+		}
+
+		/***************************************************************************************************/
+
+		//pre: called from the search thread, moves holds numMoves movements from the entry point,
+		//		fraction is from 0 to 1
+		//post: the next sample shows the expanded cells, the depth, the first movements of moves and the
+		//		share of the search done. The first share stored is taken as done before this run
+		void SetSearch(	/*in*/long long nodes,			//cells expanded so far
+						/*in*/int depth,				//cells on the current path
+						/*in*/const Direction moves[],	//movements of the current path
+						/*in*/int numMoves,				//number of movements in moves
+						/*in*/double fraction);			//estimated share of the search done
+
+		/***************************************************************************************************/
+
+	private:
+
+		ProgressReporter(const ProgressReporter &orig);		//not copyable
+		void operator=(const ProgressReporter &orig);		//not assignable
+
+		//pre: called from the sampling thread
+		//post: samples have been written every interval until Stop was called
+		void SampleLoop();
+
+		/***************************************************************************************************/
+
+		//pre: called from the sampling thread, or after it has stopped
+		//post: a sample of the counters has been written to the console or the JSON lines file, with
+		//		their rates over the last interval or, if whole, over the whole run
+		void WriteSample(/*in*/bool whole);			//rates over the whole run
+
+		/***************************************************************************************************/
+
+		//Counters written by the search
+
+		atomic<long long> solutionCount;	//solutions found
+		atomic<long long> nodeCount;		//cells expanded
+		atomic<int> pathDepth;				//cells on the current path
+		atomic<unsigned long long> prefix;	//first movements of the current path, two bits each above a count byte
+		atomic<long long> doneMillionths;	//millionths of the search done
+		atomic<long long> firstDone;		//millionths done when the search first stored them, by an earlier run
+		atomic<long long> firstSolutions;	//solutions then
+		atomic<long long> firstNodes;		//cells expanded then
+		bool published;						//the search has stored its progress
+
+		//Sampling thread
+
+		int intervalSecs;					//seconds between samples
+		string jsonFile;					//file to append JSON lines to, empty for the console
+		ofstream jsonOut;					//stream to the JSON lines file
+		thread sampler;						//sampling thread
+		mutex stopLock;						//guards stopping
+		condition_variable stopSignal;		//wakes the sampling thread to stop
+		bool stopping;						//Stop has been called
+		chrono::steady_clock::time_point startTime;	//time the reporter was started
+		chrono::steady_clock::time_point lastTime;	//time of the last sample
+		long long lastSolutions;			//solutions at the last sample
+		long long lastNodes;				//cells expanded at the last sample
+};
+
+#endif
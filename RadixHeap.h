@@ -0,0 +1,171 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: RadixHeap.h
+Purpose: Provides the specification and implementation for RadixHeap. A radix heap is a priority queue for
+			searches whose keys never go below the last key taken out, as in Dijkstra's algorithm with costs
+			that are not negative. Entries are kept in buckets by the highest bit in which their key differs
+			from the last key taken out. Taking out the smallest entry only has to look at the first bucket
+			that is not empty, and each entry is moved to a lower bucket at most once for each bit of its
+			key, so there is no sifting as in a binary heap. Keys are any unsigned integer type; the
+			narrower the key, the fewer buckets and the smaller each entry.
+*/
+
+#ifndef RADIXHEAP_H
+#define RADIXHEAP_H
+
+#include "BitBoard.h"			//HighestBit
+#include <vector>				//Buckets
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+RadixHeap();
+	Creates an empty heap
+
+void Push(Key key, unsigned int value);
+	Adds value with the given key, which must not be less than the last key taken out
+
+bool Pop(Key &key, unsigned int &value);
+	Takes out an entry with the smallest key, returns false if the heap is empty
+
+bool IsEmpty() const;
+	Returns true if the heap holds no entries
+
+void Clear();
+	Removes every entry and allows any key again
+*/
+
+template <class Key>
+class RadixHeap
+{
+
+	public:
+
+		//pre: none
+		//post: An empty heap has been created
+		RadixHeap()
+		{
+			last = 0;
+			size = 0;
+		}
+
+		/***************************************************************************************************/
+
+		//pre: key is not less than the key last taken out
+		//post: value has been added with the given key
+		void Push(	/*in*/Key key,					//priority of the entry, smallest first
+					/*in*/unsigned int value)		//entry to add
+		{
+			RadixEntry entry;
+
+			entry.key = key;
+			entry.value = value;
+			buckets[BucketOf(key)].push_back(entry);
+			size++;
+		}
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: if the heap held any entries, one with the smallest key has been taken out into key and
+		//		value and true returned to the caller. Otherwise false is returned
+		/*out*/bool Pop(							//boolean value returned to the caller
+					/*out*/Key &key,				//key of the entry taken out
+					/*out*/unsigned int &value)		//entry taken out
+		{
+			if (size == 0)
+				return false;
+
+			//Keys equal to the last are the smallest there can be. Otherwise the first bucket holding
+			//anything is spread over the buckets below it from its smallest key
+			if (buckets[0].empty())
+			{
+				int b = 1;
+				while (buckets[b].empty())
+					b++;
+
+				vector<RadixEntry> &bucket = buckets[b];
+				Key smallest = bucket[0].key;
+
+				for (size_t i = 1; i < bucket.size(); i++)
+				{
+					if (bucket[i].key < smallest)
+						smallest = bucket[i].key;
+				}
+
+				last = smallest;
+
+				//Every entry differs from the new last in a lower bit than before, so none stays in b
+				for (size_t i = 0; i < bucket.size(); i++)
+					buckets[BucketOf(bucket[i].key)].push_back(bucket[i]);
+				bucket.clear();
+
+			}//end redistribute
+
+			key = buckets[0].back().key;
+			value = buckets[0].back().value;
+			buckets[0].pop_back();
+			size--;
+			return true;
+		}
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: True is returned to the caller if the heap holds no entries, false otherwise
+		/*out*/bool IsEmpty() const					//boolean value returned to the caller
+		{
+			return size == 0;
+		}
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the heap is empty and any key may be pushed
+		void Clear()
+		{
+			for (int b = 0; b < NUM_BUCKETS; b++)
+				buckets[b].clear();
+
+			last = 0;
+			size = 0;
+		}
+
+		/***************************************************************************************************/
+
+	private:
+
+		//pre: none
+		//post: the bucket an entry with the given key belongs in has been returned to the caller. One
+		//		more than the index of the highest bit it differs from the last key in, zero if equal
+		/*out*/int BucketOf(/*in*/Key key) const	//bucket of the key
+		{
+			Key differ = key ^ last;
+
+			return differ == 0 ? 0 : HighestBit(differ) + 1;
+		}
+
+		/***************************************************************************************************/
+
+		//An entry of a bucket
+		struct RadixEntry
+		{
+			Key key;					//priority of the entry
+			unsigned int value;			//entry
+		};
+
+		static const int NUM_BUCKETS = int(sizeof(Key)) * 8 + 1;	//one for keys equal to the last, one for each bit
+
+		//PDM's
+
+		vector<RadixEntry> buckets[NUM_BUCKETS];	//entries by the highest bit their key differs from last in
+		Key last;									//key last taken out
+		size_t size;								//entries held
+};
+
+#endif
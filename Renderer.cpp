@@ -0,0 +1,532 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Renderer.cpp
+Purpose: Provides the implementation for Renderer.
+*/
+
+#include "Renderer.h"
+#include <algorithm>			//max, min, copy_n
+#include <cctype>				//tolower
+#include <cmath>				//logf
+#include <fstream>				//Image files
+
+using namespace std;
+
+//Kinds of cell
+const unsigned char KIND_OPEN = 0;
+const unsigned char KIND_WALL = 1;
+const unsigned char KIND_PATH = 2;
+
+//Colours, as red, green, blue
+const unsigned char OPEN_COLOUR[3] = {245, 245, 245};
+const unsigned char WALL_COLOUR[3] = {32, 32, 32};
+const unsigned char PATH_COLOUR[3] = {0, 170, 60};
+const unsigned char COOL_COLOUR[3] = {40, 80, 255};
+const unsigned char WARM_COLOUR[3] = {255, 220, 0};
+const unsigned char HOT_COLOUR[3] = {230, 20, 20};
+const int HEAT_LEVELS = 256;				//Colours between the coolest and hottest
+const int HEAT_TABLE_SIZE = 1 << 16;		//Counts whose colour is looked up
+
+//Text for a block of cells, from all open to all walls
+const char TEXT_RAMP[] = " .:=#";
+const int TEXT_LEVELS = 5;
+const char TEXT_PATH = '*';
+
+//PNG layout
+const int PNG_STORED_BLOCK = 65535;			//Largest block of uncompressed deflate data
+const unsigned int ADLER_BASE = 65521;		//Modulus of the Adler-32 checksum
+const int ADLER_RUN = 5552;					//Bytes that can be summed before the sums overflow
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void AppendWord(string &out, unsigned int word);
+	Appends word to out, most significant byte first
+
+unsigned int Crc32(const char *data, size_t size, unsigned int crc);
+	Carries the CRC-32 in crc on over size bytes of data
+
+unsigned int Adler32(const char *data, size_t size);
+	Returns the Adler-32 checksum of size bytes of data
+
+void AppendChunk(string &out, const char *type, const string &data);
+	Appends a PNG chunk of the given type holding data to out
+*/
+
+
+//pre: none
+//post: the four bytes of word have been appended to out, most significant first
+static void AppendWord(	/*inout*/string &out,			//bytes to append to
+						/*in*/unsigned int word)		//word to append
+{
+	out += char((word >> 24) & 0xFF);
+	out += char((word >> 16) & 0xFF);
+	out += char((word >> 8) & 0xFF);
+	out += char(word & 0xFF);
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: crc is 0 to start a checksum, or the result of the data before
+//post: returns the CRC-32 of the data so far
+static /*out*/unsigned int Crc32(					//checksum returned to the caller
+				/*in*/const char *data,			//bytes to add
+				/*in*/size_t size,				//number of bytes
+				/*in*/unsigned int crc)			//checksum of the bytes before
+{
+	static unsigned int table[4][256];
+	static bool tableReady = false;
+	const unsigned char *bytes = (const unsigned char *)data;
+
+	//table[k][i] is the CRC of byte i followed by k zero bytes, so four bytes are taken at once
+	if (!tableReady)
+	{
+		for (unsigned int i = 0; i < 256; i++)
+		{
+			unsigned int c = i;
+
+			for (int k = 0; k < 8; k++)
+				c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			table[0][i] = c;
+		}
+		for (unsigned int i = 0; i < 256; i++)
+		{
+			for (int k = 1; k < 4; k++)
+				table[k][i] = table[0][table[k - 1][i] & 0xFF] ^ (table[k - 1][i] >> 8);
+		}
+		tableReady = true;
+
+	}//end table
+
+	crc = ~crc;
+	for (; size >= 4; size -= 4, bytes += 4)
+	{
+		crc ^= (unsigned int)bytes[0] | ((unsigned int)bytes[1] << 8) |
+				((unsigned int)bytes[2] << 16) | ((unsigned int)bytes[3] << 24);
+		crc = table[3][crc & 0xFF] ^ table[2][(crc >> 8) & 0xFF] ^
+			  table[1][(crc >> 16) & 0xFF] ^ table[0][crc >> 24];
+	}
+	for (; size > 0; size--, bytes++)
+		crc = table[0][(crc ^ *bytes) & 0xFF] ^ (crc >> 8);
+
+	return ~crc;
+
+}//end Crc32
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the Adler-32 checksum of the data
+static /*out*/unsigned int Adler32(				//checksum returned to the caller
+				/*in*/const char *data,			//bytes to sum
+				/*in*/size_t size)				//number of bytes
+{
+	unsigned int a = 1, b = 0;
+
+	//The sums are only reduced once they could next overflow
+	while (size > 0)
+	{
+		size_t run = min(size, size_t(ADLER_RUN));
+
+		for (size_t i = 0; i < run; i++)
+		{
+			a += (unsigned char)data[i];
+			b += a;
+		}
+
+		a %= ADLER_BASE;
+		b %= ADLER_BASE;
+		data += run;
+		size -= run;
+
+	}//end while
+
+	return (b << 16) | a;
+
+}//end Adler32
+
+
+/***************************************************************************************************/
+
+
+//pre: type is four characters
+//post: a chunk of the given type holding data, with its length and CRC, has been appended to out
+static void AppendChunk(	/*inout*/string &out,			//image to append to
+							/*in*/const char *type,			//chunk type
+							/*in*/const string &data)		//chunk contents
+{
+	AppendWord(out, (unsigned int)data.size());
+	out.append(type, 4);
+	out += data;
+	AppendWord(out, Crc32(data.data(), data.size(), Crc32(type, 4, 0)));
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized, cellPixels is greater than zero
+//post: A frame of gb has been created, walls dark and open cells light
+Renderer::Renderer(	/*in*/Board &gb,				//board to draw
+					/*in*/int inCellPixels)			//pixels along each side of a cell in an image
+{
+	Location loc;
+
+	height = gb.GetHeight();
+	length = gb.GetLength();
+	cellPixels = inCellPixels;
+	colours.resize(size_t(height) * length * 3);
+	kinds.resize(size_t(height) * length);
+
+	//The only pass over the board, everything after draws from the frame
+	for (loc.row = 0; loc.row < height; loc.row++)
+	{
+		for (loc.col = 0; loc.col < length; loc.col++)
+		{
+			size_t cell = size_t(loc.row) * length + loc.col;
+			bool open = gb.IsOpen(loc);
+			const unsigned char *colour = open ? OPEN_COLOUR : WALL_COLOUR;
+
+			kinds[cell] = open ? KIND_OPEN : KIND_WALL;
+			colours[3 * cell] = colour[0];
+			colours[3 * cell + 1] = colour[1];
+			colours[3 * cell + 2] = colour[2];
+		}
+
+	}//end for
+
+}//end Renderer
+
+
+/***************************************************************************************************/
+
+
+//pre: counts holds a count for each cell, indexed by row * length + col
+//post: each open cell with a count has been coloured on a scale from the lowest count
+//		to the highest. Cells with a count of zero are left as they were
+void Renderer::DrawHeatmap(/*in*/const vector<long long> &counts)	//count of each cell
+{
+	long long highest = 0;
+
+	for (size_t cell = 0; cell < kinds.size() && cell < counts.size(); cell++)
+	{
+		if (kinds[cell] != KIND_WALL)
+			highest = max(highest, counts[cell]);
+	}
+
+	if (highest <= 0)
+		return;
+
+	//Counts of paths grow far faster than their spread, so they are scaled by their logarithm.
+	//The scale is cut into HEAT_LEVELS colours, worked out once
+	unsigned char palette[HEAT_LEVELS][3];
+	float scale = float(HEAT_LEVELS - 1) / logf(1.0f + float(highest));
+
+	for (int level = 0; level < HEAT_LEVELS; level++)
+	{
+		float heat = float(level) / (HEAT_LEVELS - 1);
+		const unsigned char *low = heat < 0.5f ? COOL_COLOUR : WARM_COLOUR;
+		const unsigned char *high = heat < 0.5f ? WARM_COLOUR : HOT_COLOUR;
+		float blend = heat < 0.5f ? 2.0f * heat : 2.0f * heat - 1.0f;
+
+		for (int c = 0; c < 3; c++)
+			palette[level][c] = (unsigned char)(low[c] + (high[c] - low[c]) * blend + 0.5f);
+	}
+
+	//Levels of the small counts most cells have are looked up rather than worked out
+	vector<unsigned char> smallLevels(size_t(min(highest + 1, (long long)HEAT_TABLE_SIZE)));
+
+	for (size_t count = 0; count < smallLevels.size(); count++)
+		smallLevels[count] = (unsigned char)min(int(logf(1.0f + float(count)) * scale + 0.5f), HEAT_LEVELS - 1);
+
+	for (size_t cell = 0; cell < kinds.size() && cell < counts.size(); cell++)
+	{
+		long long count = counts[cell];
+
+		if (kinds[cell] == KIND_WALL || count <= 0)
+			continue;
+
+		int level = count < (long long)smallLevels.size() ? smallLevels[size_t(count)] :
+					min(int(logf(1.0f + float(count)) * scale + 0.5f), HEAT_LEVELS - 1);
+		const unsigned char *colour = palette[level];
+
+		colours[3 * cell] = colour[0];
+		colours[3 * cell + 1] = colour[1];
+		colours[3 * cell + 2] = colour[2];
+
+	}//end for
+
+}//end DrawHeatmap
+
+
+/***************************************************************************************************/
+
+
+//pre: start is within the board
+//post: each cell the movements pass through from start has been marked as on the path.
+//		The path stops at the edge of the board
+void Renderer::DrawPath(	/*in*/Location start,					//starting location
+							/*in*/const vector<Direction> &moves)	//movements of the path
+{
+	Location loc = start;
+
+	for (size_t i = 0; i <= moves.size(); i++)
+	{
+		if (loc.row < 0 || loc.row >= height || loc.col < 0 || loc.col >= length)
+			break;
+
+		size_t cell = size_t(loc.row) * length + loc.col;
+
+		kinds[cell] = KIND_PATH;
+		colours[3 * cell] = PATH_COLOUR[0];
+		colours[3 * cell + 1] = PATH_COLOUR[1];
+		colours[3 * cell + 2] = PATH_COLOUR[2];
+
+		if (i == moves.size())
+			break;
+
+		switch (moves[i])
+		{
+			case NORTH: loc.row--; break;
+			case SOUTH: loc.row++; break;
+			case EAST: loc.col++; break;
+			case WEST: loc.col--; break;
+			default: break;
+		}
+
+	}//end for
+
+}//end DrawPath
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the frame has been written to fileName, as a PNG image if its name ends in .png
+//		and a PPM image otherwise. Returns true to the caller if it could be written
+/*out*/bool Renderer::WriteImage(							//boolean value returned to the caller
+						/*in*/const string &fileName) const	//image file
+{
+	string image;
+	bool png = fileName.size() >= PNG_EXTENSION.size();
+
+	for (size_t i = 0; png && i < PNG_EXTENSION.size(); i++)
+		png = tolower(fileName[fileName.size() - PNG_EXTENSION.size() + i]) == PNG_EXTENSION[i];
+
+	if (png)
+		EncodePng(image);
+	else
+		EncodePpm(image);
+
+	ofstream outdat(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+
+	outdat.write(image.data(), image.size());
+	outdat.close();
+	return !outdat.fail();
+
+}//end WriteImage
+
+
+/***************************************************************************************************/
+
+
+//pre: cols and rows are greater than zero
+//post: text holds the frame shrunk to at most cols x rows characters, one line per row.
+//		Each character is a block of cells: '*' if the path passes through it, otherwise
+//		' ', '.', ':', '=' or '#' as its cells are more and more walls
+void Renderer::RenderText(	/*in*/int cols,					//characters per line
+							/*in*/int rows,					//lines of text
+							/*out*/string &text) const		//shrunk frame
+{
+	int blockCols = max(1, (length + cols - 1) / cols);
+	int blockRows = max(1, (height + rows - 1) / rows);
+	int outCols = (length + blockCols - 1) / blockCols;
+	vector<int> walls(outCols);
+	vector<int> cells(outCols);
+	vector<char> path(outCols);
+
+	text.clear();
+	text.reserve(size_t((height + blockRows - 1) / blockRows) * (outCols + 1));
+
+	for (int top = 0; top < height; top += blockRows)
+	{
+		fill(walls.begin(), walls.end(), 0);
+		fill(cells.begin(), cells.end(), 0);
+		fill(path.begin(), path.end(), 0);
+
+		for (int row = top; row < min(height, top + blockRows); row++)
+		{
+			const unsigned char *kind = &kinds[size_t(row) * length];
+
+			for (int col = 0; col < length; col++)
+			{
+				int block = col / blockCols;
+
+				cells[block]++;
+				walls[block] += (kind[col] == KIND_WALL);
+				path[block] |= (kind[col] == KIND_PATH);
+			}
+
+		}//end for
+
+		for (int block = 0; block < outCols; block++)
+		{
+			if (path[block])
+				text += TEXT_PATH;
+			else
+				text += TEXT_RAMP[(walls[block] * (TEXT_LEVELS - 1) + cells[block] / 2) / cells[block]];
+		}
+		text += '\n';
+
+	}//end for
+
+}//end RenderText
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the frame has been written out as a PPM image into image
+void Renderer::EncodePpm(/*out*/string &image) const	//image file contents
+{
+	int width = length * cellPixels;
+	size_t rowBytes = size_t(width) * 3;
+	string header = "P6\n" + to_string(width) + " " + to_string(height * cellPixels) + "\n255\n";
+
+	image.assign(header.size() + rowBytes * height * cellPixels, '\0');
+	image.replace(0, header.size(), header);
+
+	unsigned char *out = (unsigned char *)&image[header.size()];
+
+	//A row of cells is scaled once and copied for each of its pixel rows
+	for (int row = 0; row < height; row++)
+	{
+		ScaleRow(row, out);
+		for (int copy = 1; copy < cellPixels; copy++)
+			copy_n(out, rowBytes, out + copy * rowBytes);
+		out += rowBytes * cellPixels;
+
+	}//end for
+
+}//end EncodePpm
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the frame has been written out as a PNG image into image
+void Renderer::EncodePng(/*out*/string &image) const	//image file contents
+{
+	static const char SIGNATURE[] = "\x89PNG\r\n\x1a\n";
+	int width = length * cellPixels;
+	int pixelRows = height * cellPixels;
+	size_t rowBytes = 1 + size_t(width) * 3;			//each row starts with its filter, none
+	string raw(rowBytes * pixelRows, '\0');
+	string header;
+	size_t idat;
+
+	for (int row = 0; row < height; row++)
+	{
+		char *out = &raw[rowBytes * row * cellPixels];
+
+		ScaleRow(row, (unsigned char *)out + 1);
+		for (int copy = 1; copy < cellPixels; copy++)
+			copy_n(out, rowBytes, out + copy * rowBytes);
+
+	}//end for
+
+	AppendWord(header, (unsigned int)width);
+	AppendWord(header, (unsigned int)pixelRows);
+	header += char(8);			//bits per channel
+	header += char(2);			//red, green, blue
+	header += char(0);			//deflate
+	header += char(0);			//adaptive filtering
+	header += char(0);			//not interlaced
+
+	//The pixels are stored without compression, so writing the image is a copy of the frame
+	size_t blocks = (raw.size() + PNG_STORED_BLOCK - 1) / PNG_STORED_BLOCK;
+	size_t dataBytes = 2 + raw.size() + 5 * blocks + 4;
+
+	image.reserve(8 + 25 + 12 + dataBytes + 12);
+	image.assign(SIGNATURE, 8);
+	AppendChunk(image, "IHDR", header);
+
+	//The image data is laid down in place, its CRC taken over it once it is there
+	AppendWord(image, (unsigned int)dataBytes);
+	idat = image.size();
+	image += "IDAT";
+	image += char(0x78);
+	image += char(0x01);
+
+	for (size_t start = 0; start < raw.size(); start += PNG_STORED_BLOCK)
+	{
+		size_t size = min(raw.size() - start, size_t(PNG_STORED_BLOCK));
+
+		image += char(start + size >= raw.size() ? 1 : 0);
+		image += char(size & 0xFF);
+		image += char((size >> 8) & 0xFF);
+		image += char(~size & 0xFF);
+		image += char((~size >> 8) & 0xFF);
+		image.append(raw, start, size);
+
+	}//end for
+
+	AppendWord(image, Adler32(raw.data(), raw.size()));
+	AppendWord(image, Crc32(image.data() + idat, image.size() - idat, 0));
+	AppendChunk(image, "IEND", string());
+
+}//end EncodePng
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: row holds the pixels of a row of cells, cellPixels pixels for each cell
+void Renderer::ScaleRow(	/*in*/int cellRow,					//row of cells
+							/*out*/unsigned char *row) const	//a row of pixels
+{
+	const unsigned char *colour = &colours[size_t(cellRow) * length * 3];
+
+	if (cellPixels == 1)
+	{
+		copy_n(colour, size_t(length) * 3, row);
+		return;
+	}
+
+	for (int col = 0; col < length; col++)
+	{
+		for (int p = 0; p < cellPixels; p++)
+		{
+			*row++ = colour[3 * col];
+			*row++ = colour[3 * col + 1];
+			*row++ = colour[3 * col + 2];
+		}
+
+	}//end for
+
+}//end ScaleRow
+
+
+/***************************************************************************************************/
+
+
+//pre: gb has been initialized
+//post: returns the pixels for each side of a cell that scale gb up to about RENDER_MIN_SIDE
+//		pixels along its longer side, and at least one
+/*out*/int GetCellPixels(/*in*/Board &gb)		//board to be drawn
+{
+	int side = max(gb.GetHeight(), gb.GetLength());
+
+	return max(1, RENDER_MIN_SIDE / max(side, 1));
+}
@@ -0,0 +1,138 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Renderer.h
+Purpose: Provides the specification for Renderer. A renderer reads a board once into a frame of a colour
+			per cell, draws paths and heatmaps over it, and writes it out in a single write, either
+			as a PPM or PNG image or as text shrunk to fit a terminal.
+*/
+
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include <string>				//File names and text
+#include <vector>				//Frame and heatmap
+
+using namespace std;
+
+//int constants
+const int PRINT_LIMIT = 100;			//Largest height or length printed cell by cell
+const int TEXT_COLS = 120;				//Columns of text a large board is shrunk to
+const int TEXT_ROWS = 60;				//Rows of text a large board is shrunk to
+const int RENDER_MIN_SIDE = 512;		//Pixels a small board is scaled up to, along its longer side
+
+//String constants
+const string PNG_EXTENSION = ".png";	//Image files with this extension are written as PNG, others as PPM
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+Renderer(Board &gb, int cellPixels);
+	Creates a frame of gb with each cell drawn cellPixels x cellPixels pixels
+
+void DrawHeatmap(const vector<long long> &counts);
+	Colours each open cell by its count, from cool for the lowest to hot for the highest
+
+void DrawPath(Location start, const vector<Direction> &moves);
+	Marks each cell on the path
+
+bool WriteImage(const string &fileName) const;
+	Writes the frame as a PNG image if fileName ends in .png, a PPM image otherwise
+
+void RenderText(int cols, int rows, string &text) const;
+	Shrinks the frame to fit in cols x rows characters of text
+
+int GetCellPixels(Board &gb);
+	Returns the cell size that scales gb up to about RENDER_MIN_SIDE pixels
+*/
+
+class Renderer
+{
+
+	public:
+
+		//pre: gb has been initialized, cellPixels is greater than zero
+		//post: A frame of gb has been created, walls dark and open cells light
+		Renderer(	/*in*/Board &gb,			//board to draw
+					/*in*/int cellPixels);		//pixels along each side of a cell in an image
+
+		/***************************************************************************************************/
+
+		//pre: counts holds a count for each cell, indexed by row * length + col
+		//post: each open cell with a count has been coloured on a scale from the lowest count
+		//		to the highest. Cells with a count of zero are left as they were
+		void DrawHeatmap(/*in*/const vector<long long> &counts);	//count of each cell
+
+		/***************************************************************************************************/
+
+		//pre: start is within the board
+		//post: each cell the movements pass through from start has been marked as on the path.
+		//		The path stops at the edge of the board
+		void DrawPath(	/*in*/Location start,					//starting location
+						/*in*/const vector<Direction> &moves);	//movements of the path
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the frame has been written to fileName, as a PNG image if its name ends in .png
+		//		and a PPM image otherwise. Returns true to the caller if it could be written
+		/*out*/bool WriteImage(								//boolean value returned to the caller
+						/*in*/const string &fileName) const;	//image file
+
+		/***************************************************************************************************/
+
+		//pre: cols and rows are greater than zero
+		//post: text holds the frame shrunk to at most cols x rows characters, one line per row.
+		//		Each character is a block of cells: '*' if the path passes through it, otherwise
+		//		' ', '.', ':', '=' or '#' as its cells are more and more walls
+		void RenderText(	/*in*/int cols,					//characters per line
+							/*in*/int rows,					//lines of text
+							/*out*/string &text) const;		//shrunk frame
+
+		/***************************************************************************************************/
+
+	private:
+
+		//pre: none
+		//post: the frame has been written out as a PPM image into image
+		void EncodePpm(/*out*/string &image) const;		//image file contents
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the frame has been written out as a PNG image into image
+		void EncodePng(/*out*/string &image) const;		//image file contents
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: row holds the pixels of a row of cells, cellPixels pixels for each cell
+		void ScaleRow(	/*in*/int cellRow,					//row of cells
+						/*out*/unsigned char *row) const;	//a row of pixels
+
+		/***************************************************************************************************/
+
+		Renderer(/*in*/const Renderer &orig);				//not copyable
+		Renderer &operator=(/*in*/const Renderer &orig);	//not assignable
+
+		//PDM's
+
+		vector<unsigned char> colours;	//red, green and blue of each cell, row by row
+		vector<unsigned char> kinds;	//whether each cell is open, a wall or on the path
+		int height;						//rows of cells
+		int length;						//cols of cells
+		int cellPixels;					//pixels along each side of a cell in an image
+};
+
+
+//pre: gb has been initialized
+//post: returns the pixels for each side of a cell that scale gb up to about RENDER_MIN_SIDE
+//		pixels along its longer side, and at least one
+/*out*/int GetCellPixels(/*in*/Board &gb);		//board to be drawn
+
+#endif
@@ -0,0 +1,522 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: ResultCache.cpp
+Purpose: Provides the implementation of a ResultCache.
+*/
+
+#include "ResultCache.h"
+#include <cstdio>				//rename, remove, snprintf
+#include <fstream>				//Index and result files
+#include <sys/stat.h>			//Cache directory
+
+#if defined(_WIN32)
+#include <direct.h>				//_mkdir
+#include <windows.h>			//CreateFile, LockFileEx
+#else
+#include <errno.h>				//EINTR
+#include <fcntl.h>				//open
+#include <sys/file.h>			//flock
+#include <unistd.h>				//close
+#endif
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void MakeDirectory(const string &dir);
+	Creates dir if it does not exist
+
+long long FileSize(const string &fileName);
+	Returns the size of a file, or -1 if it cannot be opened
+
+bool ReplaceFile(const string &tempName, const string &fileName);
+	Renames tempName over fileName
+
+bool CopyContents(const string &from, const string &to);
+	Copies a file through a temporary file renamed into place
+*/
+
+
+//pre: none
+//post: dir exists, unless it could not be created
+static void MakeDirectory(/*in*/const string &dir)		//directory to create
+{
+#if defined(_WIN32)
+	_mkdir(dir.c_str());
+#else
+	mkdir(dir.c_str(), 0777);
+#endif
+
+}//end MakeDirectory
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the size of fileName in bytes has been returned to the caller, -1 if it cannot be opened
+static /*out*/long long FileSize(/*in*/const string &fileName)	//file to measure
+{
+	ifstream indat(fileName.c_str(), ios::in | ios::binary | ios::ate);
+
+	if (!indat.good())
+		return -1;
+
+	return (long long)indat.tellg();
+
+}//end FileSize
+
+
+/***************************************************************************************************/
+
+
+//pre: tempName has been written and closed
+//post: tempName has been renamed to fileName, replacing it. Returns true to the caller if it was
+//		renamed, otherwise tempName has been removed and false is returned
+static /*out*/bool ReplaceFile(							//boolean value returned to the caller
+					/*in*/const string &tempName,		//file written
+					/*in*/const string &fileName)		//file to replace
+{
+	//rename replaces the old file in one step where the system allows it, Windows will not
+	//rename over an existing file so the old one has to go first there
+	if (rename(tempName.c_str(), fileName.c_str()) != 0)
+	{
+		remove(fileName.c_str());
+
+		if (rename(tempName.c_str(), fileName.c_str()) != 0)
+		{
+			remove(tempName.c_str());
+			return false;
+		}
+
+	}//end rename
+
+	return true;
+
+}//end ReplaceFile
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the contents of from have replaced to, through a temporary file renamed into place. Returns
+//		true to the caller if they were copied, otherwise to is unchanged and false is returned
+static /*out*/bool CopyContents(						//boolean value returned to the caller
+					/*in*/const string &from,			//file to copy
+					/*in*/const string &to)				//file to replace
+{
+	string tempName = to + CACHE_TEMP_SUFFIX;
+	ifstream indat(from.c_str(), ios::in | ios::binary);
+	ofstream outdat;
+
+	if (!indat.good())
+		return false;
+
+	outdat.open(tempName.c_str(), ios::out | ios::binary | ios::trunc);
+
+	//An empty file has nothing for the stream to copy, and copying nothing sets failbit
+	if (indat.peek() != ifstream::traits_type::eof())
+		outdat << indat.rdbuf();
+	outdat.close();
+
+	if (outdat.fail())
+	{
+		remove(tempName.c_str());
+		return false;
+
+	}//end write error
+
+	return ReplaceFile(tempName, to);
+
+}//end CopyContents
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: a cache of the results kept in dir, holding at most maxBytes of output files, has
+//		been created. Nothing is read or written until the first Fetch or Store
+ResultCache::ResultCache(	/*in*/const string &inDir,			//directory of the cache
+							/*in*/long long inMaxBytes)			//most bytes of output files to keep
+{
+	dir = inDir;
+	maxBytes = inMaxBytes;
+	clock = 0;
+	lockFile = -1;
+	lockHandle = nullptr;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard
+//post: the key of the result of solving gb with the solver named by mode has been returned to
+//		the caller, as 16 hex digits. Costs are not part of the key
+/*out*/string ResultCache::MakeKey(				//key returned to the caller
+					/*in*/Board &gb,				//board solved
+					/*in*/const string &mode)		//solver and the options that change its output
+{
+	const unsigned long long FNV_OFFSET = 14695981039346656037ULL;
+	const unsigned long long FNV_PRIME = 1099511628211ULL;
+	unsigned long long hash = FNV_OFFSET;
+	unsigned long long boardHash = gb.Hash();
+	char hex[17];
+
+	//The board is hashed from its cells, which is what makes the key the same however the file listed its walls
+	for (int i = 0; i < 8; i++)
+		hash = (hash ^ ((boardHash >> (8 * i)) & 0xFF)) * FNV_PRIME;
+
+	hash = (hash ^ (unsigned long long)CACHE_VERSION) * FNV_PRIME;
+
+	for (size_t i = 0; i < mode.size(); i++)
+		hash = (hash ^ (unsigned char)mode[i]) * FNV_PRIME;
+
+	snprintf(hex, sizeof(hex), "%016llx", hash);
+	return hex;
+
+}//end MakeKey
+
+
+/***************************************************************************************************/
+
+
+//pre: files holds the names of the output files, in the order they were stored
+//post: if the cache holds the result of key with as many files, each of them has been copied
+//		to its name in files, count holds its number of solutions, the result has been marked
+//		as the most recently used, and true is returned. Otherwise false is returned
+/*out*/bool ResultCache::Fetch(					//boolean value returned to the caller
+					/*in*/const string &key,			//key of the result
+					/*in*/const vector<string> &files,	//output files to copy the result to
+					/*out*/long long &count)			//number of solutions
+{
+	bool found;
+
+	//A cache that was never stored to has no directory to lock, and nothing to fetch
+	if (!Lock())
+		return false;
+
+	found = FetchEntry(key, files, count);
+	Unlock();
+	return found;
+
+}//end Fetch
+
+
+/***************************************************************************************************/
+
+
+//pre: the cache directory is locked
+//post: the same as Fetch
+/*out*/bool ResultCache::FetchEntry(				//boolean value returned to the caller
+					/*in*/const string &key,			//key of the result
+					/*in*/const vector<string> &files,	//output files to copy the result to
+					/*out*/long long &count)			//number of solutions
+{
+	LoadIndex();
+
+	for (size_t e = 0; e < entries.size(); e++)
+	{
+		if (entries[e].key != key)
+			continue;
+
+		if (entries[e].numFiles != int(files.size()))
+			return false;
+
+		for (int i = 0; i < entries[e].numFiles; i++)
+		{
+			if (!CopyContents(EntryFile(key, i), files[i]))
+				return false;
+		}
+
+		count = entries[e].count;
+
+		//A result that is used stays, a failed index write only costs its place in line
+		entries[e].lastUsed = ++clock;
+		SaveIndex();
+		return true;
+
+	}//end for
+
+	return false;
+
+}//end FetchEntry
+
+
+/***************************************************************************************************/
+
+
+//pre: files names output files that have been written and closed
+//post: a copy of files and count has replaced any result of key, the least recently used
+//		results have been removed until the cache fits in its size limit, and true is returned.
+//		False is returned if the files are larger than the whole cache or could not be copied
+/*out*/bool ResultCache::Store(					//boolean value returned to the caller
+					/*in*/const string &key,			//key of the result
+					/*in*/const vector<string> &files,	//output files of the result
+					/*in*/long long count)				//number of solutions
+{
+	CacheEntry entry;
+	bool stored;
+
+	entry.key = key;
+	entry.count = count;
+	entry.numFiles = int(files.size());
+	entry.bytes = 0;
+
+	//Measure first, a result too large to keep is not worth copying
+	for (size_t i = 0; i < files.size(); i++)
+	{
+		long long size = FileSize(files[i]);
+
+		if (size < 0)
+			return false;
+		entry.bytes += size;
+	}
+
+	if (entry.bytes > maxBytes)
+		return false;
+
+	MakeDirectory(dir);
+
+	//Another run may be storing or fetching in the same directory, its index must not be lost
+	if (!Lock())
+		return false;
+
+	stored = StoreEntry(entry, files);
+	Unlock();
+	return stored;
+
+}//end Store
+
+
+/***************************************************************************************************/
+
+
+//pre: the cache directory is locked, entry holds the key, count, number of files and bytes
+//		of files, which fit in the cache
+//post: the same as Store
+/*out*/bool ResultCache::StoreEntry(				//boolean value returned to the caller
+					/*in*/CacheEntry entry,				//result to keep
+					/*in*/const vector<string> &files)	//output files of the result
+{
+	const string &key = entry.key;
+	long long totalBytes = 0;
+
+	LoadIndex();
+
+	for (size_t e = 0; e < entries.size(); e++)
+	{
+		if (entries[e].key == key)
+		{
+			RemoveEntry(e);
+			break;
+		}
+	}
+
+	for (int i = 0; i < entry.numFiles; i++)
+	{
+		if (!CopyContents(files[i], EntryFile(key, i)))
+		{
+			for (int j = 0; j < i; j++)
+				remove(EntryFile(key, j).c_str());
+			return false;
+		}
+	}
+
+	//The least recently used results go until the new one fits
+	for (size_t e = 0; e < entries.size(); e++)
+		totalBytes += entries[e].bytes;
+
+	while (!entries.empty() && totalBytes + entry.bytes > maxBytes)
+	{
+		size_t oldest = 0;
+
+		for (size_t e = 1; e < entries.size(); e++)
+		{
+			if (entries[e].lastUsed < entries[oldest].lastUsed)
+				oldest = e;
+		}
+
+		totalBytes -= entries[oldest].bytes;
+		RemoveEntry(oldest);
+
+	}//end evict
+
+	entry.lastUsed = ++clock;
+	entries.push_back(entry);
+
+	return SaveIndex();
+
+}//end StoreEntry
+
+
+/***************************************************************************************************/
+
+
+//pre: the cache directory is not locked by this cache
+//post: this cache holds the lock file of the directory, waiting while another run holds it,
+//		and true is returned to the caller. False is returned if it could not be opened
+/*out*/bool ResultCache::Lock()					//boolean value returned to the caller
+{
+	string fileName = dir + "/" + CACHE_LOCK_FILE;
+
+	//The system lets go of the lock when the run ends, so a run that was killed leaves none behind
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+							  NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	OVERLAPPED whole = {};
+
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	if (!LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &whole))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	lockHandle = file;
+#else
+	int file = open(fileName.c_str(), O_RDWR | O_CREAT, 0666);
+
+	if (file < 0)
+		return false;
+
+	//A signal arriving while waiting is not a reason to give up on the cache
+	while (flock(file, LOCK_EX) != 0)
+	{
+		if (errno != EINTR)
+		{
+			close(file);
+			return false;
+		}
+	}
+
+	lockFile = file;
+#endif
+
+	return true;
+
+}//end Lock
+
+
+/***************************************************************************************************/
+
+
+//pre: Lock returned true
+//post: the lock file of the directory has been let go
+void ResultCache::Unlock()
+{
+#if defined(_WIN32)
+	OVERLAPPED whole = {};
+
+	UnlockFileEx(lockHandle, 0, MAXDWORD, MAXDWORD, &whole);
+	CloseHandle(lockHandle);
+	lockHandle = nullptr;
+#else
+	flock(lockFile, LOCK_UN);
+	close(lockFile);
+	lockFile = -1;
+#endif
+
+}//end Unlock
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: entries and clock hold the index of the cache directory, or nothing if it has none
+void ResultCache::LoadIndex()
+{
+	ifstream indat((dir + "/" + CACHE_INDEX_FILE).c_str());
+	string magic;
+	int version = 0;
+	CacheEntry entry;
+
+	entries.clear();
+	clock = 0;
+
+	//An index of another version describes results this one cannot use
+	if (!(indat >> magic >> version >> clock) || magic != CACHE_MAGIC || version != CACHE_VERSION)
+	{
+		clock = 0;
+		return;
+	}
+
+	while (indat >> entry.key >> entry.count >> entry.numFiles >> entry.bytes >> entry.lastUsed)
+		entries.push_back(entry);
+
+}//end LoadIndex
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the index of the cache directory has been replaced by entries and clock. Returns
+//		true to the caller if it could be written
+/*out*/bool ResultCache::SaveIndex() const			//boolean value returned to the caller
+{
+	string fileName = dir + "/" + CACHE_INDEX_FILE;
+	string tempName = fileName + CACHE_TEMP_SUFFIX;
+	ofstream outdat(tempName.c_str(), ios::out | ios::trunc);
+
+	if (!outdat.good())
+		return false;
+
+	outdat << CACHE_MAGIC << " " << CACHE_VERSION << " " << clock << endl;
+	for (size_t e = 0; e < entries.size(); e++)
+	{
+		outdat << entries[e].key << " " << entries[e].count << " " << entries[e].numFiles << " "
+			   << entries[e].bytes << " " << entries[e].lastUsed << endl;
+	}
+
+	outdat.close();
+
+	if (outdat.fail())
+	{
+		remove(tempName.c_str());
+		return false;
+
+	}//end write error
+
+	return ReplaceFile(tempName, fileName);
+
+}//end SaveIndex
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the name of the file keeping output file number of the result of key has been
+//		returned to the caller
+/*out*/string ResultCache::EntryFile(				//file name returned to the caller
+					/*in*/const string &key,		//key of the result
+					/*in*/int number) const			//output file of the result
+{
+	return dir + "/" + key + "." + to_string(number);
+
+}//end EntryFile
+
+
+/***************************************************************************************************/
+
+
+//pre: index is within entries
+//post: the files of entries[index] have been removed, and so has the entry
+void ResultCache::RemoveEntry(/*in*/size_t index)		//entry to remove
+{
+	for (int i = 0; i < entries[index].numFiles; i++)
+		remove(EntryFile(entries[index].key, i).c_str());
+
+	entries.erase(entries.begin() + index);
+
+}//end RemoveEntry
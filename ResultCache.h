@@ -0,0 +1,181 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: ResultCache.h
+Purpose: Provides the specification for a ResultCache, a directory of the results of mazes already
+			solved. A result is keyed by the hash of the board as it was read (so the order of the
+			walls in the maze file, and walls listed twice, make no difference) together with the
+			solver that made it. Its value is a copy of each output file and the number of solutions,
+			so a maze solved before is answered with a file copy instead of a search. An index file
+			in the directory keeps every result's size and when it was last used, and the least
+			recently used results are removed once the directory grows past its size limit. Every
+			file is written under a temporary name and renamed into place, so a run killed while
+			storing never leaves a half written result or index behind, and a lock file in the
+			directory lets only one run at a time read and change the index and the results.
+*/
+
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include "Board.h"				//For use of a board
+#include <string>				//File names and keys
+#include <vector>				//Entries and output files
+
+using namespace std;
+
+//int constants
+const int DEFAULT_CACHE_MB = 1024;				//Default megabytes of results a cache keeps
+const int CACHE_VERSION = 1;					//Changes whenever the format of a result does
+
+//String constants
+const string CACHE_INDEX_FILE = "cache.idx";	//Index of the results in a cache directory
+const string CACHE_MAGIC = "MAZECACHE";			//First word of an index file
+const string CACHE_TEMP_SUFFIX = ".tmp";		//Suffix of a cache file being written
+const string CACHE_LOCK_FILE = "cache.lock";	//Locked by the run using a cache directory
+
+
+//A result kept in the cache
+struct CacheEntry
+{
+	string key;					//key of the result, in hex
+	long long count;			//number of solutions
+	int numFiles;				//number of output files kept
+	long long bytes;			//bytes of the output files
+	long long lastUsed;			//index clock when the result was last stored or fetched
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+ResultCache(const string &dir, long long maxBytes);
+	Creates a cache of the results kept in dir, holding at most maxBytes of output files
+
+static string MakeKey(Board &gb, const string &mode);
+	Returns the key of the result of solving gb with the solver named by mode
+
+bool Fetch(const string &key, const vector<string> &files, long long &count);
+	Copies the output files of the result of key into files, returns false if there is none
+
+bool Store(const string &key, const vector<string> &files, long long count);
+	Keeps a copy of files as the result of key, returns false if it could not be kept
+*/
+
+class ResultCache
+{
+
+	public:
+
+		//pre: none
+		//post: a cache of the results kept in dir, holding at most maxBytes of output files, has
+		//		been created. Nothing is read or written until the first Fetch or Store
+		ResultCache(	/*in*/const string &dir,		//directory of the cache
+						/*in*/long long maxBytes);		//most bytes of output files to keep
+
+		/***************************************************************************************************/
+
+		//pre: gb is a valid gameboard
+		//post: the key of the result of solving gb with the solver named by mode has been returned to
+		//		the caller, as 16 hex digits. Costs are not part of the key
+		static /*out*/string MakeKey(				//key returned to the caller
+					/*in*/Board &gb,				//board solved
+					/*in*/const string &mode);		//solver and the options that change its output
+
+		/***************************************************************************************************/
+
+		//pre: files holds the names of the output files, in the order they were stored
+		//post: if the cache holds the result of key with as many files, each of them has been copied
+		//		to its name in files, count holds its number of solutions, the result has been marked
+		//		as the most recently used, and true is returned. Otherwise false is returned
+		/*out*/bool Fetch(							//boolean value returned to the caller
+					/*in*/const string &key,			//key of the result
+					/*in*/const vector<string> &files,	//output files to copy the result to
+					/*out*/long long &count);			//number of solutions
+
+		/***************************************************************************************************/
+
+		//pre: files names output files that have been written and closed
+		//post: a copy of files and count has replaced any result of key, the least recently used
+		//		results have been removed until the cache fits in its size limit, and true is returned.
+		//		False is returned if the files are larger than the whole cache or could not be copied
+		/*out*/bool Store(							//boolean value returned to the caller
+					/*in*/const string &key,			//key of the result
+					/*in*/const vector<string> &files,	//output files of the result
+					/*in*/long long count);				//number of solutions
+
+		/***************************************************************************************************/
+
+	private:
+
+		//pre: the cache directory is locked
+		//post: the same as Fetch
+		/*out*/bool FetchEntry(						//boolean value returned to the caller
+					/*in*/const string &key,			//key of the result
+					/*in*/const vector<string> &files,	//output files to copy the result to
+					/*out*/long long &count);			//number of solutions
+
+		/***************************************************************************************************/
+
+		//pre: the cache directory is locked, entry holds the key, count, number of files and bytes
+		//		of files, which fit in the cache
+		//post: the same as Store
+		/*out*/bool StoreEntry(						//boolean value returned to the caller
+					/*in*/CacheEntry entry,				//result to keep
+					/*in*/const vector<string> &files);	//output files of the result
+
+		/***************************************************************************************************/
+
+		//pre: the cache directory is not locked by this cache
+		//post: this cache holds the lock file of the directory, waiting while another run holds it,
+		//		and true is returned to the caller. False is returned if it could not be opened
+		/*out*/bool Lock();							//boolean value returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: Lock returned true
+		//post: the lock file of the directory has been let go
+		void Unlock();
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: entries and clock hold the index of the cache directory, or nothing if it has none
+		void LoadIndex();
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the index of the cache directory has been replaced by entries and clock. Returns
+		//		true to the caller if it could be written
+		/*out*/bool SaveIndex() const;				//boolean value returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the name of the file keeping output file number of the result of key has been
+		//		returned to the caller
+		/*out*/string EntryFile(					//file name returned to the caller
+					/*in*/const string &key,		//key of the result
+					/*in*/int number) const;		//output file of the result
+
+		/***************************************************************************************************/
+
+		//pre: index is within entries
+		//post: the files of entries[index] have been removed, and so has the entry
+		void RemoveEntry(/*in*/size_t index);		//entry to remove
+
+		/***************************************************************************************************/
+
+		string dir;						//directory of the cache
+		long long maxBytes;				//most bytes of output files to keep
+		vector<CacheEntry> entries;		//results in the cache
+		long long clock;				//counts stores and fetches, to order results by their last use
+		int lockFile;					//descriptor of the held lock file, -1 for none, POSIX only
+		void *lockHandle;				//handle of the held lock file, Windows only
+
+		ResultCache(const ResultCache &);				//not copyable
+		ResultCache &operator=(const ResultCache &);	//not assignable
+};
+
+#endif
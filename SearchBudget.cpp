@@ -0,0 +1,165 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: SearchBudget.cpp
+Purpose: Provides the implementation of run budgets and the cancel token.
+*/
+
+#include "SearchBudget.h"
+#include <csignal>				//signal
+
+using namespace std;
+
+//Names of the stop reasons, as written to the output file
+const char *const STOP_NAMES[NUM_STOP_REASONS] = {"complete", "time limit", "node limit", "solution limit",
+												  "output limit", "cancelled"};
+
+static CancelToken *signalToken = nullptr;		//token the signal handlers cancel
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void CancelSignal(int signalNumber);
+	Signal handler that cancels the token given to CancelOnSignal
+*/
+
+
+//pre: CancelOnSignal has been given a token
+//post: the token has been cancelled with STOP_CANCELLED
+static void CancelSignal(/*in*/int signalNumber)		//signal received
+{
+	//SIGINT and SIGTERM stop the search the same way
+	(void)signalNumber;
+
+	if (signalToken != nullptr)
+		signalToken->Cancel(STOP_CANCELLED);
+
+}//end CancelSignal
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: CancelToken has been created, and has not been cancelled
+CancelToken::CancelToken()
+{
+	reason.store(STOP_NONE);
+
+}//end CancelToken
+
+
+/***************************************************************************************************/
+
+
+//pre: reason is not STOP_NONE
+//post: the token has been cancelled for reason, unless it already was. Safe to call from a
+//		signal handler or any thread
+void CancelToken::Cancel(/*in*/StopReason inReason)		//why the search should stop
+{
+	int expected = STOP_NONE;
+
+	reason.compare_exchange_strong(expected, int(inReason));
+
+}//end Cancel
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: why the token was cancelled, or STOP_NONE, has been returned to the caller
+/*out*/StopReason CancelToken::GetReason() const		//reason returned to the caller
+{
+	return StopReason(reason.load());
+
+}//end GetReason
+
+
+/***************************************************************************************************/
+
+
+//pre: token lives until the program ends
+//post: SIGINT and SIGTERM cancel token with STOP_CANCELLED rather than ending the program
+void CancelOnSignal(/*inout*/CancelToken &token)		//token to cancel
+{
+	signalToken = &token;
+	signal(SIGINT, CancelSignal);
+	signal(SIGTERM, CancelSignal);
+
+}//end CancelOnSignal
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: true has been returned to the caller if budget limits anything
+/*out*/bool HasBudget(/*in*/const SearchBudget &budget)	//boolean value returned to the caller
+{
+	return budget.seconds > 0 || budget.nodes > 0 || budget.solutions > 0 || budget.bytes > 0;
+
+}//end HasBudget
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the first limit of budget that seconds, nodes, solutions or bytes has reached, in the order
+//		of StopReason, has been returned to the caller. STOP_NONE if none has been reached
+/*out*/StopReason CheckBudget(							//reason returned to the caller
+				/*in*/const SearchBudget &budget,		//limits of the run
+				/*in*/double seconds,					//seconds the search has run for
+				/*in*/long long nodes,					//cells expanded
+				/*in*/long long solutions,				//solutions found
+				/*in*/long long bytes)					//bytes written
+{
+	if (budget.seconds > 0 && seconds >= budget.seconds)
+		return STOP_TIME;
+
+	if (budget.nodes > 0 && nodes >= budget.nodes)
+		return STOP_NODES;
+
+	if (budget.solutions > 0 && solutions >= budget.solutions)
+		return STOP_SOLUTIONS;
+
+	if (budget.bytes > 0 && bytes >= budget.bytes)
+		return STOP_BYTES;
+
+	return STOP_NONE;
+
+}//end CheckBudget
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the name of reason has been returned to the caller
+/*out*/string StopReasonName(/*in*/StopReason reason)	//reason to name
+{
+	if (reason < STOP_NONE || reason >= NUM_STOP_REASONS)
+		return "";
+
+	return STOP_NAMES[reason];
+
+}//end StopReasonName
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: EXIT_OK if reason is STOP_NONE, otherwise EXIT_STOPPED_BASE plus reason, has been returned
+//		to the caller
+/*out*/int StopExitStatus(/*in*/StopReason reason)		//why the run stopped
+{
+	if (reason == STOP_NONE)
+		return EXIT_OK;
+
+	return EXIT_STOPPED_BASE + int(reason);
+
+}//end StopExitStatus
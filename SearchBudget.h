@@ -0,0 +1,141 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: SearchBudget.h
+Purpose: Provides the specification for the limits of a single run, and for stopping a run early. A
+			budget limits the wall clock time, the expanded cells, the solutions found and the bytes
+			written of an exhaustive search, any of which may be left unlimited. A cancel token is a
+			single flag the search looks at between pauses, set by the signal handlers when the
+			program is interrupted or terminated, so a run stopped by its scheduler still keeps the
+			solutions it found. Each reason for stopping has an exit status of its own.
+*/
+
+#ifndef SEARCHBUDGET_H
+#define SEARCHBUDGET_H
+
+#include <atomic>				//Flag set by the signal handlers
+#include <string>				//Stop reason names
+
+using namespace std;
+
+//int constants
+const int EXIT_OK = 0;							//Exit status of a complete run
+const int EXIT_FAILED = 1;						//Exit status of a bad command line or maze file
+const int EXIT_STOPPED_BASE = 10;				//Exit status of a stopped run, plus its StopReason
+
+//Why a search stopped before finding every path. Exit statuses follow this order
+enum StopReason {STOP_NONE, STOP_TIME, STOP_NODES, STOP_SOLUTIONS, STOP_BYTES, STOP_CANCELLED,
+				 NUM_STOP_REASONS};
+
+//Limits of a single run, zero for none
+struct SearchBudget
+{
+	int seconds;				//wall clock seconds of the search
+	long long nodes;			//expanded cells
+	long long solutions;		//solutions found
+	long long bytes;			//bytes of solutions written
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+CancelToken();
+	Creates a token that has not been cancelled
+
+void Cancel(StopReason reason);
+	Asks every search looking at the token to stop, for reason
+
+bool IsCancelled() const;
+	Returns true if the token has been cancelled
+
+StopReason GetReason() const;
+	Returns why the token was cancelled, STOP_NONE if it was not
+*/
+
+class CancelToken
+{
+public:
+
+	//pre: none
+	//post: CancelToken has been created, and has not been cancelled
+	CancelToken();
+
+	//pre: reason is not STOP_NONE
+	//post: the token has been cancelled for reason, unless it already was. Safe to call from a
+	//		signal handler or any thread
+	void Cancel(/*in*/StopReason reason);			//why the search should stop
+
+	//pre: none
+	//post: true has been returned to the caller if the token has been cancelled
+	/*out*/bool IsCancelled() const					//boolean value returned to the caller
+	{
+		return reason.load(memory_order_relaxed) != STOP_NONE;
+	}
+
+	//pre: none
+	//post: why the token was cancelled, or STOP_NONE, has been returned to the caller
+	/*out*/StopReason GetReason() const;			//reason returned to the caller
+
+private:
+
+	atomic<int> reason;								//StopReason the token was cancelled for
+
+	CancelToken(const CancelToken &);				//not copyable
+	CancelToken &operator=(const CancelToken &);	//not assignable
+
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void CancelOnSignal(CancelToken &token);
+	Given: a token
+		-> cancels it when the program is interrupted or terminated
+
+bool HasBudget(const SearchBudget &budget);
+	Returns true if budget limits anything
+
+StopReason CheckBudget(const SearchBudget &budget, double seconds, long long nodes, long long solutions,
+					   long long bytes);
+	Given: a budget and what a search has used so far
+		-> returns the first limit reached, STOP_NONE if none has been
+
+string StopReasonName(StopReason reason);
+	Returns the name of reason, as written to the output file
+
+int StopExitStatus(StopReason reason);
+	Returns the exit status of a run stopped for reason
+*/
+
+
+//pre: token lives until the program ends
+//post: SIGINT and SIGTERM cancel token with STOP_CANCELLED rather than ending the program
+void CancelOnSignal(/*inout*/CancelToken &token);		//token to cancel
+
+//pre: none
+//post: true has been returned to the caller if budget limits anything
+/*out*/bool HasBudget(/*in*/const SearchBudget &budget);	//boolean value returned to the caller
+
+//pre: none
+//post: the first limit of budget that seconds, nodes, solutions or bytes has reached, in the order
+//		of StopReason, has been returned to the caller. STOP_NONE if none has been reached
+/*out*/StopReason CheckBudget(							//reason returned to the caller
+				/*in*/const SearchBudget &budget,		//limits of the run
+				/*in*/double seconds,					//seconds the search has run for
+				/*in*/long long nodes,					//cells expanded
+				/*in*/long long solutions,				//solutions found
+				/*in*/long long bytes);					//bytes written
+
+//pre: none
+//post: the name of reason has been returned to the caller
+/*out*/string StopReasonName(/*in*/StopReason reason);	//reason to name
+
+//pre: none
+//post: EXIT_OK if reason is STOP_NONE, otherwise EXIT_STOPPED_BASE plus reason, has been returned
+//		to the caller
+/*out*/int StopExitStatus(/*in*/StopReason reason);		//why the run stopped
+
+#endif
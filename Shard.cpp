@@ -0,0 +1,278 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Shard.cpp
+Purpose: Provides the implementation for splitting an exhaustive search into shards and merging their
+			output.
+*/
+
+#include "Shard.h"
+#include "PathEnumerator.h"		//Listing and estimating prefixes
+#include "PathWriter.h"			//Path number literal
+#include <cstdio>				//rename, remove
+#include <fstream>				//Shard output files
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool ReadLastLine(const string &fileName, string &last);
+	Given: a file name
+		-> reads only the end of the file for its last line, returns false if it could not be read
+*/
+
+
+//pre: none
+//post: if fileName could be read, last holds its last line as getline would read it and true is
+//		returned to the caller. Otherwise false is returned
+static /*out*/bool ReadLastLine(					//boolean value returned to the caller
+				/*in*/const string &fileName,		//file to read
+				/*out*/string &last)				//last line of the file
+{
+	ifstream indat(fileName.c_str(), ios::in | ios::binary);
+	string tail;									//end of the file read so far
+	size_t start;									//start of the last line within tail
+	long long pos;									//offset of tail within the file
+
+	last.clear();
+	if (!indat.good())
+		return false;
+
+	indat.seekg(0, ios::end);
+	pos = (long long)indat.tellg();
+	if (pos < 0)
+		return false;
+
+	//Step back a block at a time until the line break before the last line has been read
+	do
+	{
+		long long size = pos < SHARD_TAIL_BYTES ? pos : SHARD_TAIL_BYTES;
+		string block(size_t(size), '\0');
+
+		pos -= size;
+		indat.seekg(pos);
+		if (size > 0 && !indat.read(&block[0], size))
+			return false;
+
+		tail = block + tail;
+
+		//A final line break ends the last line rather than starting an empty one
+		start = tail.size();
+		if (start > 0 && tail[start - 1] == '\n')
+			start--;
+		start = start > 0 ? tail.rfind('\n', start - 1) : string::npos;
+
+	} while (start == string::npos && pos > 0);
+
+	start = (start == string::npos) ? 0 : start + 1;
+	last = tail.substr(start);
+
+	if (!last.empty() && last[last.size() - 1] == '\n')
+		last.erase(last.size() - 1);
+	if (!last.empty() && last[last.size() - 1] == '\r')
+		last.erase(last.size() - 1);
+
+	return true;
+
+}//end ReadLastLine
+
+
+/***************************************************************************************************/
+
+
+
+//pre: gb is a valid gameboard, entry and exit are open cells within its bounds, numShards is
+//		greater than zero
+//post: units holds every unit of the search from entry to exit in the order the serial search
+//		reaches them, each with the shard it belongs to. Shards are runs of consecutive units,
+//		balanced by their estimated size. The number of movements in a prefix is returned
+/*out*/int PlanShards(								//movements in a prefix
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*in*/int numShards,				//number of shards
+				/*out*/vector<ShardUnit> &units)	//units of the search
+{
+	PathEnumerator search(gb, entry, exit);
+	SearchStatus status;
+	ShardUnit unit;
+	int prefixMoves = 0;
+	long long total = 0;
+	long long before = 0;
+
+	//Cut the tree deeper until there are enough prefixes to balance, or nothing left to cut
+	for (int limit = 1; limit <= MAX_PREFIX_MOVES; limit++)
+	{
+		int prefixes = 0;
+
+		units.clear();
+		search.SetPrefix(nullptr, 0);
+		search.SetDepthLimit(limit);
+
+		while ((status = search.Next()) != SEARCH_DONE)
+		{
+			unit.moves.assign(search.GetMoves(), search.GetMoves() + search.GetNumMoves());
+			unit.solution = (status == SEARCH_SOLUTION);
+			unit.weight = 1;
+			unit.shard = 0;
+			units.push_back(unit);
+
+			if (!unit.solution)
+				prefixes++;
+
+		}//end while
+
+		prefixMoves = limit;
+		if (prefixes == 0 || prefixes >= numShards * UNITS_PER_SHARD)
+			break;
+
+	}//end for
+
+	//Estimate each prefix by the cells a short search below it expands. A prefix that has cut
+	//the exit point off expands next to nothing however much room it has
+	search.SetPauseInterval(ESTIMATE_NODES);
+	search.SetDepthLimit(prefixMoves + ESTIMATE_LOOKAHEAD);
+
+	for (size_t i = 0; i < units.size(); i++)
+	{
+		if (units[i].solution || !search.SetPrefix(&units[i].moves[0], int(units[i].moves.size())))
+			continue;
+
+		if (search.CanReachExit())
+		{
+			while ((status = search.Next()) != SEARCH_DONE && status != SEARCH_PAUSED)
+				;
+			units[i].weight += search.GetNodes();
+		}
+
+	}//end for
+
+	for (size_t i = 0; i < units.size(); i++)
+		total += units[i].weight;
+
+	//Each unit goes to the shard its middle falls in
+	for (size_t i = 0; i < units.size(); i++)
+	{
+		long long shard = (2 * before + units[i].weight) * numShards / (2 * total);
+
+		units[i].shard = int(shard < numShards ? shard : numShards - 1);
+		before += units[i].weight;
+
+	}//end for
+
+	return prefixMoves;
+
+}//end PlanShards
+
+
+/***************************************************************************************************/
+
+
+//pre: shard is not negative
+//post: the name of the shard's copy of fileName has been returned to the caller
+/*out*/string ShardFileName(						//file name returned to the caller
+				/*in*/const string &fileName,		//file name of a serial run
+				/*in*/int shard)					//shard index
+{
+	return fileName + "." + to_string(shard);
+
+}//end ShardFileName
+
+
+/***************************************************************************************************/
+
+
+//pre: the shard copies of fileName were written by the shards 0 to numShards - 1 of a single run
+//post: if every shard's output could be read and ends with SHARD_DONE_STR, fileName holds the
+//		solutions of every shard in order, numbered as the serial run numbers them, numSolutions
+//		their number and true is returned to the caller. Otherwise false is returned and fileName
+//		is unchanged
+/*out*/bool MergeShards(							//boolean value returned to the caller
+				/*in*/const string &fileName,		//file name of a serial run
+				/*in*/int numShards,				//number of shards
+				/*out*/int &numSolutions)			//solutions written
+{
+	string tempName = fileName + MERGE_TEMP_SUFFIX;
+	ofstream outdat;
+	string line;
+
+	numSolutions = 0;
+
+	//Every shard must be there and finished before the merged file replaces anything. A shard that
+	//was stopped ends with why instead, and one that was killed with whatever it had written
+	for (int shard = 0; shard < numShards; shard++)
+	{
+		string last;
+
+		if (!ReadLastLine(ShardFileName(fileName, shard), last) || last != SHARD_DONE_STR)
+			return false;
+
+	}//end for
+
+	//The merged file is written beside fileName, which is only replaced once it is complete
+	outdat.open(tempName.c_str());
+
+	for (int shard = 0; shard < numShards; shard++)
+	{
+		ifstream indat(ShardFileName(fileName, shard).c_str());
+		bool inPaths = false;
+
+		//A shard without solutions holds only its message, which is left out
+		while (getline(indat, line))
+		{
+			if (line.compare(0, PATH_NUM.length(), PATH_NUM) == 0)
+			{
+				inPaths = true;
+				numSolutions++;
+				outdat << PATH_NUM << numSolutions << '\n';
+			}
+			else if (inPaths && line != SHARD_DONE_STR)
+				outdat << line << '\n';
+
+		}//end while
+
+	}//end for
+
+	//No shard found a solution, they all say so the same way
+	if (numSolutions == 0)
+	{
+		ifstream indat(ShardFileName(fileName, 0).c_str());
+
+		while (getline(indat, line))
+		{
+			if (line != SHARD_DONE_STR)
+				outdat << line << '\n';
+		}
+
+	}//end no solutions
+
+	outdat.close();
+
+	if (outdat.fail())
+	{
+		remove(tempName.c_str());
+		numSolutions = 0;
+		return false;
+
+	}//end write error
+
+	//rename replaces the old file in one step where the system allows it, Windows will not
+	//rename over an existing file so the old one has to go first there
+	if (rename(tempName.c_str(), fileName.c_str()) != 0)
+	{
+		remove(fileName.c_str());
+
+		if (rename(tempName.c_str(), fileName.c_str()) != 0)
+		{
+			numSolutions = 0;
+			return false;
+		}
+
+	}//end rename
+
+	return true;
+
+}//end MergeShards
@@ -0,0 +1,94 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: Shard.h
+Purpose: Provides the specification for splitting an exhaustive search into shards. The search tree is
+			cut at a fixed number of movements from the entry point, and the prefixes found there, in
+			the order the serial search reaches them, are the units of work. Each shard is a run of
+			consecutive units, chosen so every shard has about the same estimated number of cells to
+			expand. Every process plans the same shards from the same board, so a shard needs only its
+			index to know its work. Because shards are consecutive, writing their solutions one after
+			another and numbering them again gives exactly the output of the serial search.
+*/
+
+#ifndef SHARD_H
+#define SHARD_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include <string>				//File names
+#include <vector>				//Units
+
+using namespace std;
+
+//int constants
+const int UNITS_PER_SHARD = 32;				//Units planned for each shard, so they can be balanced
+const int MAX_PREFIX_MOVES = 48;			//Deepest the tree is cut
+const int ESTIMATE_LOOKAHEAD = 10;			//Movements below a prefix searched to estimate its size
+const long long ESTIMATE_NODES = 1 << 14;	//Most cells expanded estimating a single prefix
+const int SHARD_TAIL_BYTES = 256;			//Bytes read at a time looking back for a shard's last line
+
+//String constants
+const string SHARD_DONE_STR = "SHARD COMPLETE";	//Last line of a shard that searched all of its units
+const string MERGE_TEMP_SUFFIX = ".tmp";			//Suffix of a merged file being written
+
+
+//A single unit of work: a prefix of the search, or a solution shorter than the prefixes
+struct ShardUnit
+{
+	vector<Direction> moves;	//movements from the entry point
+	bool solution;				//moves reach the exit point
+	long long weight;			//estimated cells to expand below the prefix
+	int shard;					//shard the unit belongs to
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+int PlanShards(Board &gb, Location entry, Location exit, int numShards, vector<ShardUnit> &units);
+	Given: a board, an entry and exit point and a number of shards
+		-> fills units with every unit of the search in serial order, each given a shard, returns the prefix length
+
+string ShardFileName(const string &fileName, int shard);
+	Given: a file name and a shard index
+		-> returns the name of that shard's copy of the file
+
+bool MergeShards(const string &fileName, int numShards, int &numSolutions);
+	Given: an output file name and a number of shards
+		-> writes every shard's output to fileName numbered as a single run, returns false if a shard is
+			missing or did not finish
+*/
+
+
+//pre: gb is a valid gameboard, entry and exit are open cells within its bounds, numShards is
+//		greater than zero
+//post: units holds every unit of the search from entry to exit in the order the serial search
+//		reaches them, each with the shard it belongs to. Shards are runs of consecutive units,
+//		balanced by their estimated size. The number of movements in a prefix is returned
+/*out*/int PlanShards(								//movements in a prefix
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*in*/int numShards,				//number of shards
+				/*out*/vector<ShardUnit> &units);	//units of the search
+
+//pre: shard is not negative
+//post: the name of the shard's copy of fileName has been returned to the caller
+/*out*/string ShardFileName(						//file name returned to the caller
+				/*in*/const string &fileName,		//file name of a serial run
+				/*in*/int shard);					//shard index
+
+//pre: the shard copies of fileName were written by the shards 0 to numShards - 1 of a single run
+//post: if every shard's output could be read and ends with SHARD_DONE_STR, fileName holds the
+//		solutions of every shard in order, numbered as the serial run numbers them, numSolutions
+//		their number and true is returned to the caller. Otherwise false is returned and fileName
+//		is unchanged
+/*out*/bool MergeShards(							//boolean value returned to the caller
+				/*in*/const string &fileName,		//file name of a serial run
+				/*in*/int numShards,				//number of shards
+				/*out*/int &numSolutions);			//solutions written
+
+#endif
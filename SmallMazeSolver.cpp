@@ -0,0 +1,77 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: SmallMazeSolver.cpp
+Purpose: Provides the runtime selection of a SmallMaze instantiation for a given board.
+*/
+
+#include "SmallMazeSolver.h"
+
+using namespace std;
+
+//Solve function of a single SmallMaze instantiation
+typedef int (*SmallMazeSolveFn)(unsigned long long open, PathCallback callback, void *context,
+								 const CancelToken *token);
+
+//One row of the dispatch table, every length for a given height
+#define SMALL_MAZE_ROW(h)	{	&SmallMaze<h, 1>::Solve, &SmallMaze<h, 2>::Solve,		\
+								&SmallMaze<h, 3>::Solve, &SmallMaze<h, 4>::Solve,		\
+								&SmallMaze<h, 5>::Solve, &SmallMaze<h, 6>::Solve,		\
+								&SmallMaze<h, 7>::Solve, &SmallMaze<h, 8>::Solve }
+
+//Instantiation for every height x length up to SMALL_MAZE_MAX, indexed [height-1][length-1]
+static const SmallMazeSolveFn SMALL_MAZE_SOLVERS[SMALL_MAZE_MAX][SMALL_MAZE_MAX] =
+{
+	SMALL_MAZE_ROW(1), SMALL_MAZE_ROW(2), SMALL_MAZE_ROW(3), SMALL_MAZE_ROW(4),
+	SMALL_MAZE_ROW(5), SMALL_MAZE_ROW(6), SMALL_MAZE_ROW(7), SMALL_MAZE_ROW(8)
+};
+
+#undef SMALL_MAZE_ROW
+
+
+/***************************************************************************************************/
+
+
+//pre: Board has been initialized
+//post: returns true if the board is small enough to be solved by a SmallMaze
+/*out*/bool IsSmallMaze(				//boolean value returned to the caller
+				/*in*/Board &gb)		//board to check
+{
+	return (gb.GetHeight() >= 1 && gb.GetHeight() <= SMALL_MAZE_MAX &&
+			gb.GetLength() >= 1 && gb.GetLength() <= SMALL_MAZE_MAX);
+
+}//end IsSmallMaze
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard for which IsSmallMaze is true, token is null or lives as long as the search
+//post: every path from the top left to the bottom right cell has been passed to callback
+//		(if not null) in the same order as PathEnumerator. If token was cancelled, the search
+//		stopped after the last solution passed on. The number of solutions is returned
+/*out*/int SolveSmallMaze(						//number of solutions
+				/*in*/Board &gb,				//board to solve
+				/*in*/PathCallback callback,	//called with each solution, may be null
+				/*in*/void *context,			//handed through to callback
+				/*in*/const CancelToken *token)	//stops the search when cancelled, may be null
+{
+	unsigned long long open = 0;		//open cells of the board
+	int height = gb.GetHeight();		//height of the board
+	int length = gb.GetLength();		//length of the board
+	Location loc;						//current cell
+
+	//Pack the board into a bitboard, bit row*length+col
+	for (loc.row = 0; loc.row < height; loc.row++)
+	{
+		for (loc.col = 0; loc.col < length; loc.col++)
+		{
+			if (gb.IsOpen(loc))
+				open |= 1ULL << (loc.row * length + loc.col);
+		}
+	}
+
+	return SMALL_MAZE_SOLVERS[height - 1][length - 1](open, callback, context, token);
+
+}//end SolveSmallMaze
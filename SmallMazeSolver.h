@@ -0,0 +1,208 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: SmallMazeSolver.h
+Purpose: Provides the specification for a SmallMaze. A small maze is a board of at most 64 cells whose
+			dimensions are known at compile time. The open and visited cells are each kept in a single
+			64 bit word (bit row*length+col), so every movement is a shift and a mask and the search
+			needs no heap memory. The runtime picks the instantiation matching the board dimensions.
+*/
+
+#ifndef SMALLMAZESOLVER_H
+#define SMALLMAZESOLVER_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "SearchBudget.h"		//Stopping the search early
+
+using namespace std;
+
+//Largest height and length handled by a SmallMaze
+const int SMALL_MAZE_MAX = 8;
+
+//Backtracks between looks at the cancel token, for a maze whose solutions are far apart
+const int SMALL_MAZE_CANCEL_CHECK = 1 << 20;
+
+//Called with every solution found. moves are the movements taken from the entry point and are only
+//valid for the duration of the call. context is handed through unchanged from the caller
+typedef void (*PathCallback)(const Direction moves[], int numMoves, void *context);
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool IsSmallMaze(Board &gb);
+	Returns true if the board is small enough to be solved by a SmallMaze
+
+int SolveSmallMaze(Board &gb, PathCallback callback, void *context, const CancelToken *token);
+	Finds all paths from the top left to the bottom right of the board, in the same order as PathEnumerator,
+	calling callback (if not null) with each one, until token (if not null) is cancelled. Returns the
+	number of solutions
+
+int SmallMaze<H, L>::Solve(unsigned long long open, PathCallback callback, void *context,
+						   const CancelToken *token);
+	Same as SolveSmallMaze, given the open cells of an HxL board as a bitboard
+*/
+
+
+//Mask of every bit in a given column of a height x length bitboard
+constexpr unsigned long long ColumnMask(int height, int length, int col)
+{
+	return (height == 0) ? 0ULL :
+		(ColumnMask(height - 1, length, col) | (1ULL << ((height - 1) * length + col)));
+}
+
+
+template <int H, int L>
+class SmallMaze
+{
+
+	public:
+
+		//pre: open has bit row*L+col set for every open cell of an HxL board, token is null or lives
+		//		as long as the search
+		//post: every path from the top left to the bottom right cell has been passed to callback
+		//		(if not null) in the same order as PathEnumerator. If token was cancelled, the search
+		//		stopped after the last solution passed on. The number of solutions is returned
+		static /*out*/int Solve(							//number of solutions
+						/*in*/unsigned long long open,		//open cells of the board
+						/*in*/PathCallback callback,		//called with each solution, may be null
+						/*in*/void *context,				//handed through to callback
+						/*in*/const CancelToken *token)		//stops the search when cancelled, may be null
+		{
+			Direction moves[H * L];					//movements taken from the entry point
+			unsigned long long cell[H * L];			//cell at each depth of the current path
+			int nextDir[H * L];						//next movement to try at each depth
+			unsigned long long visited = ENTRY;		//cells on the current path
+			unsigned long long next;				//cell being moved to
+			int depth = 0;							//index of the current cell on the path
+			int counter = 0;						//number of solutions
+			int untilCheck = SMALL_MAZE_CANCEL_CHECK;	//backtracks left before the token is looked at
+			int dir;								//movement being tried
+
+			//Entry point is the exit point
+			if (ENTRY == EXIT)
+			{
+				if (callback != nullptr)
+					callback(nullptr, 0, context);
+				return 1;
+
+			}//end single cell board
+
+			//Entry point is not available
+			if ((open & ENTRY) == 0)
+				return 0;
+
+			cell[0] = ENTRY;
+			nextDir[0] = 0;
+
+			while (depth >= 0)
+			{
+				//No possible movements, set the space as open, backtrack
+				if (nextDir[depth] == NUM_DIRECTIONS)
+				{
+					visited &= ~cell[depth];
+					depth--;
+
+					if (--untilCheck == 0)
+					{
+						if (token != nullptr && token->IsCancelled())
+							return counter;
+						untilCheck = SMALL_MAZE_CANCEL_CHECK;
+					}
+					continue;
+
+				}//end backtrack
+
+				dir = nextDir[depth]++;
+				next = Step(cell[depth], dir) & (open | EXIT) & ~visited;
+
+				if (next == 0)
+					continue;
+
+				moves[depth] = ORDER[dir];
+
+				//If we are at an exit point, we have a solution
+				if (next == EXIT)
+				{
+					counter++;
+					if (callback != nullptr)
+						callback(moves, depth + 1, context);
+
+					if (token != nullptr && token->IsCancelled())
+						return counter;
+
+				}//end solution
+
+				else
+				{
+					depth++;
+					cell[depth] = next;
+					nextDir[depth] = 0;
+					visited |= next;
+
+				}//end move
+
+			}//end while
+
+			return counter;
+		}
+
+	private:
+
+		static_assert(H >= 1 && L >= 1 && H * L <= 64, "SmallMaze must fit in a 64 bit word");
+
+		//pre: bit is a single cell of the bitboard, dir is an index into ORDER
+		//post: the neighboring cell in the given direction is returned, or 0 if it is off the board
+		static /*out*/unsigned long long Step(		//neighboring cell
+						/*in*/unsigned long long bit,	//current cell
+						/*in*/int dir)					//index into ORDER
+		{
+			switch (dir)
+			{
+			case 0:
+				return (bit << L) & ALL;		//South
+			case 1:
+				return (bit << 1) & ~COL_FIRST & ALL;	//East
+			case 2:
+				return bit >> L;				//North
+			default:
+				return (bit >> 1) & ~COL_LAST;	//West
+			}
+		}
+
+		static const unsigned long long ALL = ~0ULL >> (64 - H * L);			//every cell
+		static const unsigned long long ENTRY = 1ULL;							//top left cell
+		static const unsigned long long EXIT = 1ULL << (H * L - 1);				//bottom right cell
+		static const unsigned long long COL_FIRST = ColumnMask(H, L, 0);		//leftmost column
+		static const unsigned long long COL_LAST = ColumnMask(H, L, L - 1);	//rightmost column
+		static const Direction ORDER[NUM_DIRECTIONS];							//movement order
+};
+
+//Movements are attempted south, east, north, west, respectively, to match PathEnumerator
+template <int H, int L>
+const Direction SmallMaze<H, L>::ORDER[NUM_DIRECTIONS] = {SOUTH, EAST, NORTH, WEST};
+
+
+/***************************************************************************************************/
+
+
+//pre: Board has been initialized
+//post: returns true if the board is small enough to be solved by a SmallMaze
+/*out*/bool IsSmallMaze(				//boolean value returned to the caller
+				/*in*/Board &gb);		//board to check
+
+/***************************************************************************************************/
+
+//pre: gb is a valid gameboard for which IsSmallMaze is true, token is null or lives as long as the search
+//post: every path from the top left to the bottom right cell has been passed to callback
+//		(if not null) in the same order as PathEnumerator. If token was cancelled, the search
+//		stopped after the last solution passed on. The number of solutions is returned
+/*out*/int SolveSmallMaze(						//number of solutions
+				/*in*/Board &gb,				//board to solve
+				/*in*/PathCallback callback,	//called with each solution, may be null
+				/*in*/void *context,			//handed through to callback
+				/*in*/const CancelToken *token);	//stops the search when cancelled, may be null
+
+#endif
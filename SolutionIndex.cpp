@@ -0,0 +1,391 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: SolutionIndex.cpp
+Purpose: Provides the implementation of the index kept beside a solution file.
+*/
+
+#include "SolutionIndex.h"
+#include "PathWriter.h"			//Text solution format
+#include <algorithm>			//search, upper_bound
+#include <cstdlib>				//strtoll
+#include <cstring>				//memcpy
+
+using namespace std;
+
+//String constants
+const string TEXT_PATH_END = END_PATH + "\n\n";			//Last bytes of a path in the text format
+
+//int constants
+const int MAX_NUMBER_DIGITS = 20;					//Digits of the largest path number
+const size_t NO_PATH_END = size_t(-1);				//Offset of the end of a path cut short
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+size_t TextPathEnd(const char *data, size_t size, size_t offset);
+	Returns the offset past the text path starting at offset, or NO_PATH_END if it does not end
+
+bool ReadTextNumber(const char *data, size_t size, size_t offset, long long &number);
+	Reads the number of the text path starting at offset
+
+bool CompareNumber(long long number, const IndexEntry &entry);
+	Orders path numbers against index entries
+*/
+
+
+//pre: data holds size bytes, offset is the first byte of a text path
+//post: the offset just past the end of the path has been returned to the caller, or NO_PATH_END
+//		if the path has no end
+static /*out*/size_t TextPathEnd(				//offset returned to the caller
+				/*in*/const char *data,			//bytes of the file
+				/*in*/size_t size,				//number of bytes
+				/*in*/size_t offset)			//first byte of the path
+{
+	const char *found = search(data + offset, data + size, TEXT_PATH_END.begin(), TEXT_PATH_END.end());
+
+	if (found == data + size)
+		return NO_PATH_END;
+
+	return size_t(found - data) + TEXT_PATH_END.size();
+
+}//end TextPathEnd
+
+
+/***************************************************************************************************/
+
+
+//pre: data holds size bytes
+//post: if a text path starts at offset, number holds its number and true has been returned to the
+//		caller. Otherwise false is returned
+static /*out*/bool ReadTextNumber(				//boolean value returned to the caller
+				/*in*/const char *data,			//bytes of the file
+				/*in*/size_t size,				//number of bytes
+				/*in*/size_t offset,			//first byte of the path
+				/*out*/long long &number)		//number of the path
+{
+	char digits[MAX_NUMBER_DIGITS + 1];
+	size_t count;
+
+	if (offset + PATH_NUM.size() > size || PATH_NUM.compare(0, PATH_NUM.size(), data + offset, PATH_NUM.size()) != 0)
+		return false;
+
+	//The mapped bytes do not end in a null, the digits are copied out first
+	offset += PATH_NUM.size();
+	count = min(size - offset, size_t(MAX_NUMBER_DIGITS));
+	memcpy(digits, data + offset, count);
+	digits[count] = '\0';
+
+	number = strtoll(digits, nullptr, 10);
+	return number > 0;
+
+}//end ReadTextNumber
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: true has been returned to the caller if number comes before entry's path
+static /*out*/bool CompareNumber(				//boolean value returned to the caller
+				/*in*/long long number,			//path number
+				/*in*/const IndexEntry &entry)	//entry to compare to
+{
+	return number < entry.number;
+
+}//end CompareNumber
+
+
+/***************************************************************************************************/
+
+
+//pre: stride is greater than zero
+//post: an index writer for paths written in format has been created. No file is written
+//		until Open
+SolutionIndexWriter::SolutionIndexWriter(	/*in*/int stride,				//paths between entries
+											/*in*/OutputFormat format)		//format of the solution file
+{
+	footer.magic = INDEX_MAGIC;
+	footer.version = INDEX_VERSION;
+	footer.format = (unsigned int)format;
+	footer.stride = (unsigned int)stride;
+	footer.numEntries = 0;
+	footer.numPaths = 0;
+	footer.endOffset = 0;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: no file has been opened yet
+//post: the index file fileName has been created. Returns true to the caller if it could be
+/*out*/bool SolutionIndexWriter::Open(/*in*/const string &fileName)	//index file to write
+{
+	outdat.open(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+	return outdat.good();
+
+}//end Open
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: true has been returned to the caller if the index file is open
+/*out*/bool SolutionIndexWriter::IsOpen() const		//boolean value returned to the caller
+{
+	return outdat.is_open();
+
+}//end IsOpen
+
+
+/***************************************************************************************************/
+
+
+//pre: Open returned true, paths are added in order of their number, offset counts from the
+//		start of the file
+//post: path number has been noted as starting at offset, and kept as an entry if its number
+//		is one more than a multiple of the stride
+void SolutionIndexWriter::Add(	/*in*/long long number,			//path number
+								/*in*/long long offset)			//byte offset of the path
+{
+	footer.numPaths = number;
+
+	if ((number - 1) % footer.stride != 0)
+		return;
+
+	IndexEntry entry;
+
+	entry.number = number;
+	entry.offset = offset;
+	outdat.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+	footer.numEntries++;
+
+}//end Add
+
+
+/***************************************************************************************************/
+
+
+//pre: Open returned true, every path has been added, endOffset is just past the last of them
+//post: the footer has been written and the index closed. Returns true to the caller if the
+//		whole index could be written
+/*out*/bool SolutionIndexWriter::Finish(/*in*/long long endOffset)	//byte offset past the last path
+{
+	if (!outdat.is_open())
+		return false;
+
+	footer.endOffset = endOffset;
+	outdat.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+	outdat.close();
+
+	return !outdat.fail();
+
+}//end Finish
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: a SolutionIndex with nothing open has been created
+SolutionIndex::SolutionIndex()
+{
+	entries = nullptr;
+	memset(&footer, 0, sizeof(footer));
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: solutionFile and the index beside it have been mapped and true returned to the
+//		caller, if the index is whole and its last entry points at the path it names.
+//		Otherwise false is returned
+/*out*/bool SolutionIndex::Open(/*in*/const string &solutionFile)	//solution file to query
+{
+	long long number;
+
+	entries = nullptr;
+
+	if (!solutions.Open(solutionFile) || !index.Open(IndexFileName(solutionFile)) ||
+		index.GetSize() < sizeof(IndexFooter))
+		return false;
+
+	memcpy(&footer, index.GetData() + index.GetSize() - sizeof(IndexFooter), sizeof(IndexFooter));
+
+	if (footer.magic != INDEX_MAGIC || footer.version != INDEX_VERSION || footer.format != FORMAT_TEXT ||
+		footer.stride == 0 || footer.numEntries < 0 || footer.endOffset < 0 ||
+		index.GetSize() != footer.numEntries * sizeof(IndexEntry) + sizeof(IndexFooter) ||
+		size_t(footer.endOffset) > solutions.GetSize())
+		return false;
+
+	entries = reinterpret_cast<const IndexEntry*>(index.GetData());
+
+	//An index left from an earlier run would point into the middle of other paths
+	if (footer.numEntries > 0)
+	{
+		const IndexEntry &lastEntry = entries[footer.numEntries - 1];
+
+		if (lastEntry.offset < 0 || lastEntry.offset >= footer.endOffset ||
+			!ReadTextNumber(solutions.GetData(), size_t(footer.endOffset), size_t(lastEntry.offset), number) ||
+			number != lastEntry.number)
+		{
+			entries = nullptr;
+			return false;
+		}
+
+	}//end stale index
+
+	//Nor may the file hold a path past the last one the index knows of
+	if (ReadTextNumber(solutions.GetData(), solutions.GetSize(), size_t(footer.endOffset), number))
+	{
+		entries = nullptr;
+		return false;
+
+	}//end longer file
+
+	return true;
+
+}//end Open
+
+
+/***************************************************************************************************/
+
+
+//pre: Open returned true
+//post: if the file holds paths first to last, text points at the first byte of path first
+//		in the mapped file, length holds the bytes up to the end of path last, and true is
+//		returned to the caller. Otherwise false is returned
+/*out*/bool SolutionIndex::FindPaths(					//boolean value returned to the caller
+					/*in*/long long first,			//number of the first path
+					/*in*/long long last,			//number of the last path
+					/*out*/const char *&text,		//first byte of the paths
+					/*out*/size_t &length) const	//bytes of the paths
+{
+	const IndexEntry *nearest;
+	size_t start, end;
+	long long number;
+
+	if (entries == nullptr || first < 1 || last < first || last > footer.numPaths || footer.numEntries == 0)
+		return false;
+
+	//The last entry at or before the first path
+	nearest = upper_bound(entries, entries + footer.numEntries, first, CompareNumber) - 1;
+	if (nearest < entries)
+		return false;
+
+	start = size_t(nearest->offset);
+	for (number = nearest->number; number < first && start != NO_PATH_END; number++)
+		start = PathEnd(start);
+
+	end = start;
+	for (; number <= last && end != NO_PATH_END; number++)
+		end = PathEnd(end);
+
+	//The path found must be the one asked for, and each path must have ended
+	if (start == NO_PATH_END || end == NO_PATH_END || !ReadTextNumber(solutions.GetData(), size_t(footer.endOffset), start, number) || number != first)
+		return false;
+
+	text = solutions.GetData() + start;
+	length = end - start;
+	return true;
+
+}//end FindPaths
+
+
+/***************************************************************************************************/
+
+
+//pre: Open returned true
+//post: the number of the last path in the file has been returned to the caller
+/*out*/long long SolutionIndex::GetNumPaths() const		//number of paths
+{
+	return footer.numPaths;
+
+}//end GetNumPaths
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the solution file and index have been unmapped
+void SolutionIndex::Close()
+{
+	entries = nullptr;
+	solutions.Close();
+	index.Close();
+
+}//end Close
+
+
+/***************************************************************************************************/
+
+
+//pre: offset is the first byte of a path
+//post: the offset just past the path has been returned to the caller, or NO_PATH_END if it does
+//		not end
+/*out*/size_t SolutionIndex::PathEnd(/*in*/size_t offset) const	//first byte of the path
+{
+	//Each format finds the end of its paths its own way, the text format is the only one so far
+	return TextPathEnd(solutions.GetData(), size_t(footer.endOffset), offset);
+
+}//end PathEnd
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the name of the index beside solutionFile has been returned to the caller
+/*out*/string IndexFileName(/*in*/const string &solutionFile)	//solution file
+{
+	return solutionFile + INDEX_SUFFIX;
+
+}//end IndexFileName
+
+
+/***************************************************************************************************/
+
+
+//pre: stride is greater than zero
+//post: the index of the text solution file solutionFile has been written beside it, with an
+//		entry every stride paths. Returns true to the caller if it could be written
+/*out*/bool BuildSolutionIndex(					//boolean value returned to the caller
+				/*in*/const string &solutionFile,	//solution file to index
+				/*in*/int stride)					//paths between entries
+{
+	MappedFile file;
+	size_t offset = 0;
+	long long number;
+
+	if (!file.Open(solutionFile))
+		return false;
+
+	SolutionIndexWriter writer(stride, FORMAT_TEXT);
+
+	if (!writer.Open(IndexFileName(solutionFile)))
+		return false;
+
+	//Paths follow one another from the start, anything after them is not a path
+	while (ReadTextNumber(file.GetData(), file.GetSize(), offset, number))
+	{
+		size_t end = TextPathEnd(file.GetData(), file.GetSize(), offset);
+
+		//A path cut short by a run that was killed
+		if (end == NO_PATH_END)
+			break;
+
+		writer.Add(number, (long long)offset);
+		offset = end;
+
+	}//end while
+
+	return writer.Finish((long long)offset);
+
+}//end BuildSolutionIndex
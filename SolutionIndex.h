@@ -0,0 +1,227 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: SolutionIndex.h
+Purpose: Provides the specification for the index kept beside a solution file, so any path of a file of
+			many gigabytes can be found without reading it from the start. The index is a sparse table
+			of the byte offset of every stride'th path, in order of path number, followed by a footer
+			giving the stride, the number of paths, where the last of them ends and the format the
+			paths were written in. The writer thread adds an entry as it formats each path, so the
+			index costs nothing more than a small write every stride paths. A query maps both files,
+			finds the nearest entry at or before the path by binary search, and steps over at most
+			stride - 1 paths from there. Only stepping from one path to the next depends on the format,
+			so another output format needs only its own way of finding where a path ends.
+*/
+
+#ifndef SOLUTIONINDEX_H
+#define SOLUTIONINDEX_H
+
+#include "MappedFile.h"			//Mapped solution and index files
+#include <fstream>				//Index file being written
+#include <string>				//File names
+
+using namespace std;
+
+//int constants
+const int DEFAULT_INDEX_STRIDE = 1024;					//Default paths between index entries
+const unsigned int INDEX_MAGIC = 0x58444E49;			//"INDX"
+const unsigned int INDEX_VERSION = 1;
+
+//String constants
+const string INDEX_SUFFIX = ".idx";						//Suffix of the index beside a solution file
+
+//Formats a solution file may be written in
+enum OutputFormat {FORMAT_TEXT};
+
+//Where a path starts in the solution file
+struct IndexEntry
+{
+	long long number;			//path number
+	long long offset;			//byte offset of its first byte
+};
+
+//The last bytes of an index file
+struct IndexFooter
+{
+	unsigned int magic;			//INDEX_MAGIC
+	unsigned int version;		//INDEX_VERSION
+	unsigned int format;		//OutputFormat of the solution file
+	unsigned int stride;		//paths between entries
+	long long numEntries;		//entries before the footer
+	long long numPaths;			//number of the last path in the file
+	long long endOffset;		//byte offset just past the last path
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+SolutionIndexWriter(int stride, OutputFormat format);
+	Creates an index writer for paths written in format, with an entry every stride paths
+
+bool Open(const string &fileName);
+	Creates the index file fileName, returns false if it could not be created
+
+bool IsOpen() const;
+	Returns true if the index file has been created and not yet finished
+
+void Add(long long number, long long offset);
+	Gives the offset of the next path, keeping an entry if it is a stride'th path
+
+bool Finish(long long endOffset);
+	Writes the footer, returns false if the index could not be written
+*/
+
+class SolutionIndexWriter
+{
+
+	public:
+
+		//pre: stride is greater than zero
+		//post: an index writer for paths written in format has been created. No file is written
+		//		until Open
+		SolutionIndexWriter(	/*in*/int stride,				//paths between entries
+								/*in*/OutputFormat format);		//format of the solution file
+
+		/***************************************************************************************************/
+
+		//pre: no file has been opened yet
+		//post: the index file fileName has been created. Returns true to the caller if it could be
+		/*out*/bool Open(/*in*/const string &fileName);	//index file to write
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: true has been returned to the caller if the index file is open
+		/*out*/bool IsOpen() const;					//boolean value returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: Open returned true, paths are added in order of their number, offset counts from the
+		//		start of the file
+		//post: path number has been noted as starting at offset, and kept as an entry if its number
+		//		is one more than a multiple of the stride
+		void Add(	/*in*/long long number,			//path number
+					/*in*/long long offset);		//byte offset of the path
+
+		/***************************************************************************************************/
+
+		//pre: Open returned true, every path has been added, endOffset is just past the last of them
+		//post: the footer has been written and the index closed. Returns true to the caller if the
+		//		whole index could be written
+		/*out*/bool Finish(/*in*/long long endOffset);	//byte offset past the last path
+
+		/***************************************************************************************************/
+
+	private:
+
+		ofstream outdat;				//index file
+		IndexFooter footer;				//footer, filled in as paths are added
+
+		SolutionIndexWriter(const SolutionIndexWriter &);				//not copyable
+		SolutionIndexWriter &operator=(const SolutionIndexWriter &);	//not assignable
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+SolutionIndex();
+	Creates a SolutionIndex with nothing open
+
+bool Open(const string &solutionFile);
+	Maps solutionFile and its index, returns false if there is no index that fits the file
+
+bool FindPaths(long long first, long long last, const char *&text, size_t &length) const;
+	Finds the bytes of paths first to last, returns false if the file does not have them
+
+long long GetNumPaths() const;
+	Returns the number of the last path in the file
+
+void Close();
+	Unmaps both files
+*/
+
+class SolutionIndex
+{
+
+	public:
+
+		//pre: none
+		//post: a SolutionIndex with nothing open has been created
+		SolutionIndex();
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: solutionFile and the index beside it have been mapped and true returned to the
+		//		caller, if the index is whole and its last entry points at the path it names.
+		//		Otherwise false is returned
+		/*out*/bool Open(/*in*/const string &solutionFile);	//solution file to query
+
+		/***************************************************************************************************/
+
+		//pre: Open returned true
+		//post: if the file holds paths first to last, text points at the first byte of path first
+		//		in the mapped file, length holds the bytes up to the end of path last, and true is
+		//		returned to the caller. Otherwise false is returned
+		/*out*/bool FindPaths(						//boolean value returned to the caller
+					/*in*/long long first,			//number of the first path
+					/*in*/long long last,			//number of the last path
+					/*out*/const char *&text,		//first byte of the paths
+					/*out*/size_t &length) const;	//bytes of the paths
+
+		/***************************************************************************************************/
+
+		//pre: Open returned true
+		//post: the number of the last path in the file has been returned to the caller
+		/*out*/long long GetNumPaths() const;		//number of paths
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the solution file and index have been unmapped
+		void Close();
+
+		/***************************************************************************************************/
+
+	private:
+
+		//pre: offset is the first byte of a path
+		//post: the offset just past the path has been returned to the caller, or a value past the
+		//		end of the file if it does not end
+		/*out*/size_t PathEnd(/*in*/size_t offset) const;	//first byte of the path
+
+		/***************************************************************************************************/
+
+		MappedFile solutions;			//solution file
+		MappedFile index;				//index file
+		const IndexEntry *entries;		//entries of the index, in order of path number
+		IndexFooter footer;				//footer of the index
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+string IndexFileName(const string &solutionFile);
+	Returns the name of the index kept beside solutionFile
+
+bool BuildSolutionIndex(const string &solutionFile, int stride);
+	Reads solutionFile from the start and writes its index, returns false if it could not
+*/
+
+
+//pre: none
+//post: the name of the index beside solutionFile has been returned to the caller
+/*out*/string IndexFileName(/*in*/const string &solutionFile);	//solution file
+
+//pre: stride is greater than zero
+//post: the index of the text solution file solutionFile has been written beside it, with an
+//		entry every stride paths. Returns true to the caller if it could be written
+/*out*/bool BuildSolutionIndex(					//boolean value returned to the caller
+				/*in*/const string &solutionFile,	//solution file to index
+				/*in*/int stride);					//paths between entries
+
+#endif
@@ -0,0 +1,104 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: SolutionRing.cpp
+Purpose: Provides the implementation of a solution ring.
+*/
+
+#include "SolutionRing.h"
+#include "MemoryProfile.h"		//Counting slots that grow
+
+using namespace std;
+
+
+//pre: capacity is greater than zero
+//post: An empty ring holding at least capacity records has been created
+SolutionRing::SolutionRing(/*in*/int capacity)		//number of records the ring must hold
+{
+	size_t size = 1;
+
+	while (size < size_t(capacity))
+		size *= 2;
+
+	slots.resize(size);
+	mask = size - 1;
+	head.store(0);
+	tail.store(0);
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the producer thread, moves holds numMoves movements
+//post: if the ring had room the solution has been added and true is returned to the caller,
+//		otherwise the ring is unchanged and false is returned
+/*out*/bool SolutionRing::TryPush(					//boolean value returned to the caller
+				/*in*/const Direction moves[],		//movements taken from the entry point
+				/*in*/int numMoves,					//number of movements in moves
+				/*in*/int number,					//solution number
+				/*in*/int label)					//entry and exit lines of the solution
+{
+	size_t pos = tail.load(memory_order_relaxed);
+
+	//Full when the producer is a whole ring ahead of the consumer
+	if (pos - head.load(memory_order_acquire) > mask)
+		return false;
+
+	SolutionRecord &record = slots[pos & mask];
+	size_t capacity = record.moves.capacity();
+
+	record.number = number;
+	record.label = label;
+	record.moves.assign(moves, moves + numMoves);
+
+	//A slot only allocates when a solution is longer than any it held before
+	if (record.moves.capacity() != capacity)
+		CountAllocation(HOOK_SOLUTION_COPY, record.moves.capacity() * sizeof(Direction));
+
+	tail.store(pos + 1, memory_order_release);
+	return true;
+
+}//end TryPush
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the consumer thread
+//post: the oldest record has been returned to the caller, or null if the ring is empty
+/*out*/SolutionRecord* SolutionRing::Front()			//oldest record
+{
+	size_t pos = head.load(memory_order_relaxed);
+
+	if (pos == tail.load(memory_order_acquire))
+		return nullptr;
+
+	return &slots[pos & mask];
+
+}//end Front
+
+
+/***************************************************************************************************/
+
+
+//pre: called from the consumer thread, Front returned a record
+//post: that record's slot has been handed back to the producer
+void SolutionRing::Pop()
+{
+	head.store(head.load(memory_order_relaxed) + 1, memory_order_release);
+
+}//end Pop
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns true to the caller if the ring holds no records, false otherwise
+/*out*/bool SolutionRing::IsEmpty() const			//boolean value returned to the caller
+{
+	return head.load(memory_order_acquire) == tail.load(memory_order_acquire);
+
+}//end IsEmpty
@@ -0,0 +1,109 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: SolutionRing.h
+Purpose: Provides the specification for a SolutionRing. A solution ring is a bounded queue of solution
+			records between exactly one producer thread (the search) and one consumer thread (the
+			writer). Neither side takes a lock; each only advances its own index. Slots keep their
+			storage between uses, so once the ring is warm a push does not allocate.
+*/
+
+#ifndef SOLUTIONRING_H
+#define SOLUTIONRING_H
+
+#include "Direction.h"			//Direction enum
+#include <atomic>				//Ring indexes
+#include <vector>				//Slots
+
+using namespace std;
+
+//Size of a cache line, the two indexes are kept on separate lines
+const int CACHE_LINE = 64;
+
+//Label of a record written with the usual entry and exit lines
+const int NO_LABEL = -1;
+
+//A single solution waiting to be written
+struct SolutionRecord
+{
+	int number;					//solution number
+	int label;					//entry and exit lines to write it between, NO_LABEL for the usual ones
+	vector<Direction> moves;	//movements taken from the entry point
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+SolutionRing(int capacity);
+	Creates a new, empty ring holding at least capacity records
+
+bool TryPush(const Direction moves[], int numMoves, int number, int label);
+	Producer only. Copies a solution into the ring, returns false if the ring is full
+
+SolutionRecord* Front();
+	Consumer only. Returns the oldest record, or null if the ring is empty
+
+void Pop();
+	Consumer only. Releases the record returned by Front
+
+bool IsEmpty() const;
+	Returns true if the ring holds no records
+*/
+
+class SolutionRing
+{
+
+	public:
+
+		//pre: capacity is greater than zero
+		//post: An empty ring holding at least capacity records has been created
+		SolutionRing(/*in*/int capacity);		//number of records the ring must hold
+
+		/***************************************************************************************************/
+
+		//pre: called from the producer thread, moves holds numMoves movements
+		//post: if the ring had room the solution has been added and true is returned to the caller,
+		//		otherwise the ring is unchanged and false is returned
+		/*out*/bool TryPush(						//boolean value returned to the caller
+					/*in*/const Direction moves[],	//movements taken from the entry point
+					/*in*/int numMoves,				//number of movements in moves
+					/*in*/int number,				//solution number
+					/*in*/int label);				//entry and exit lines of the solution
+
+		/***************************************************************************************************/
+
+		//pre: called from the consumer thread
+		//post: the oldest record has been returned to the caller, or null if the ring is empty
+		/*out*/SolutionRecord* Front();			//oldest record
+
+		/***************************************************************************************************/
+
+		//pre: called from the consumer thread, Front returned a record
+		//post: that record's slot has been handed back to the producer
+		void Pop();
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns true to the caller if the ring holds no records, false otherwise
+		/*out*/bool IsEmpty() const;			//boolean value returned to the caller
+
+		/***************************************************************************************************/
+
+	private:
+
+		SolutionRing(const SolutionRing &orig);		//not copyable
+		void operator=(const SolutionRing &orig);	//not assignable
+
+		//PDM's
+
+		vector<SolutionRecord> slots;	//storage for the records, a power of two in size
+		size_t mask;					//slots.size() - 1
+
+		alignas(CACHE_LINE) atomic<size_t> head;	//next record to consume, written by the consumer
+		alignas(CACHE_LINE) atomic<size_t> tail;	//next slot to fill, written by the producer
+};
+
+#endif
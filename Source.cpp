@@ -8,7 +8,7 @@ Assumptions: Maze entry point will always be top left coordinate, and exit point
 PURPOSE: Given:
 			A gameboard
 			A starting location
-			A stack data structure to track each path
+			A list of movements to track each path
 			A starting number of maze paths
 			and an output stream to write the solution to,
 		this program finds all possible paths through a maze using recursion. The function continues to find
@@ -28,43 +28,162 @@ PURPOSE: Given:
 		its original location, it will return false, reaching a base case. 
 
 		If the function reaches the exit point,
-		it will write its current path to the given output file, and move backwards a space. 
+		it will hand its current path to the writer thread, and move backwards a space. The writer thread
+		formats solutions and writes them to the output file in large blocks, so the search never waits
+		on the disk (see --ring and --backpressure). 
+
+		The search keeps its path on an explicit stack (see PathEnumerator) rather than the call stack,
+		so a long run can save checkpoints as it goes (see --checkpoint, --checkpoint-secs and
+		--checkpoint-nodes) and --resume carries on from the last one after a restart. 
 		
-INPUT:	Program reads in a file from the console and validates it. Must contain only letters and three letters after the period.
+INPUT:	Program reads in a file from the console, or from the command line, and validates it. Must contain only letters and three letters after the period.
 		First line of file is the size of the board, all following coordinates
-		are within the bounds of the size of the board, and represent walls
+		are within the bounds of the size of the board, and represent walls. The walls may be followed
+		by a line reading COST and then lines of row, col and the cost of moving into that cell,
+		from 1 to 65535. Cells not listed cost 1. A line reading ENTRY or EXIT, followed by lines of
+		row, col and the side of the maze it opens onto (NORTH, SOUTH, EAST or WEST), gives the maze
+		doors of its own instead of the top left entry and bottom right exit; such a maze may have
+		any number of each, every one on the edge its side opens onto.
+		A grid file, given with --grid file, holds a maze of any number of dimensions instead: a line
+		reading GRID and the length, height, number of levels and the size along any further
+		dimension, then the walls as lines of row, col, level and any further coordinates. The walls
+		may be followed by a line reading PORTAL and lines of the coordinates of two cells joined
+		both ways, such as stairs or a lift between floors.
 OUTPUT: Program writes all solutions to "solution.out". If there was at least one solution, the program
 		writes all possible paths (1-n) and lists directions needed to travel to reach the exit
+		Running with --shortest writes a single shortest path instead, found with --threads n threads.
+		If the maze has costs, the path written is the cheapest one instead and its cost is printed.
+		Running with --bench [size] times the solvers on a random size x size board instead.
+		Running with --resume keeps the solutions written before the last checkpoint, drops whatever
+		was written after it, and writes the rest after them. The checkpoint file is removed once every path has been found.
+		Running with --tiled file finds a shortest path on a tiled board kept in that file, for
+		mazes too large to hold in memory, and reports how often its tiles were found in memory.
+		Given a maze file as well, the maze is first written to the tiled board file.
+		Running with --hpa writes a single path found through a graph of the entrances between
+		--cluster n sized clusters. The graph is saved next to the maze file and used again while
+		the maze is unchanged. The path is close to, but not always, a shortest one.
+		Running with --render file also draws the maze, and the single path found if there is one,
+		to a PNG image if the file ends in .png and a PPM image otherwise. --heatmap colours each
+		cell by its distance from the entry. Boards larger than 100 x 100 are printed shrunk to fit.
+		Running with --meet writes every path joined from halves searched from the entry and from the
+		exit to a cut across the middle of the maze, in a different order. With --count the paths
+		are only counted, which can finish on mazes the other searches cannot.
+		Running with --estimate estimates the number of paths from random probes on --threads n threads,
+		for mazes with too many to find. It stops once the 95% interval is within 1% of the estimate or
+		after --estimate-secs s seconds. Probes choose only moves the exit can still be reached from,
+		or with --estimate knuth any open move.
+		Running with --stats counts the solutions instead of writing them, with --threads n threads.
+		"solution.json" gets the number of solutions, their lengths and turns, and "solution.cells"
+		the number of solutions through each cell, row by row as 64 bit integers. With --heatmap the
+		image is coloured by those counts.
+		Running with --shard i/n searches only the i'th of n shards of the paths and writes them to
+		"solution.out.i", ending with a line saying the shard is complete once it has searched all of
+		them. Running with --merge n then joins the shards into "solution.out", numbered as a single
+		run would number them, and merges nothing if a shard is missing or was stopped.
+		Running with --max-secs s, --max-nodes n, --max-solutions n or --max-bytes n stops the search
+		once it has run for s seconds, expanded n cells, found n solutions or written n bytes. An
+		interrupt (SIGINT) or terminate (SIGTERM) signal stops it the same way. A stopped run keeps
+		the solutions found so far, ends "solution.out" with a line saying why it stopped, saves a
+		checkpoint to resume from if checkpoints were asked for, and exits with status 10 plus the
+		reason (11 time, 12 nodes, 13 solutions, 14 bytes, 15 signal). A bad command line or maze
+		file exits with status 1, anything else with 0.
+		Running with --cache dir keeps the output of every complete run in dir, keyed by the walls
+		of the maze and the solver, and a later run of the same maze with the same solver copies
+		the output from there instead of searching. The least recently used results are removed
+		once they take up more than --cache-mb n megabytes.
+		Running with --longest writes a single path with the most moves instead, found by a search
+		on --threads n threads that cuts every partial path that cannot beat the longest so far, and
+		prints how the search went. --max-secs and --max-nodes stop it with the longest found by then.
+		Running with --k-shortest k writes the k cheapest paths that visit no cell twice instead,
+		cheapest first, so path 1 of "solution.out" is a shortest path. --max-secs and --max-nodes
+		stop it with the paths found by then.
+		Running with --max-moves n writes only the paths of at most n moves, in the usual order, and
+		--max-moves p% those of at most p percent of the shortest path's moves. The search gives up on
+		a path as soon as it is too far from the exit to make it, so it takes time in proportion to
+		the paths written rather than to every path.
+		Running with --batch file finds the fewest moves through every maze of a batch file instead,
+		all of them the same size: a line "length height", then each maze as a line reading MAZE
+		followed by its walls. Up to 32 mazes are searched at once, one to each bit of a word, and
+		"solution.out" gets a line for each maze in the order of the file.
+		Running with --progress s prints a line of the search's progress to stderr every s seconds while
+		it finds every path: the solutions and cells so far and their rates, the depth and start of
+		the current path, a rough share of the search done from the branches of the path it has
+		finished, and the time left at that rate. --progress-file file appends the same as a line
+		of JSON to file instead, every 10 seconds unless --progress says otherwise.
+		A run that writes its paths fresh also writes "solution.out.idx", giving where every
+		--index-stride n'th path starts (1024 by default, 0 for none). Running with --path n or
+		--path n-m prints those paths from "solution.out" without reading the file up to them. A
+		file without a current index, after --resume, --merge or a cache copy, is indexed first.
+		A maze with doors writes every path from every entry to every exit, each starting and ending
+		with the doors it joins, and prints the number of paths between each pair. Each entry is
+		searched once with every exit as a target. With --shortest "solution.out" gets a line for
+		every pair with the fewest moves between them instead, from one breadth first search that
+		spreads 64 entries at once.
+		Running with --grid file writes every path from the first cell of the grid to the last,
+		or with --shortest a shortest one, in the usual format. A step between levels is written UP or
+		DOWN, and a step through a portal PORTAL TO and the coordinates it leads to. --max-secs,
+		--max-nodes, --max-solutions and --max-bytes stop the search as they do on a board. The paths
+		are written straight to the file, so --ring, --backpressure, --index-stride and --checkpoint
+		are refused with --grid, and "solution.out" is only indexed when --path first reads it.
+		Built with MAZE_MEMORY_PROFILE defined, the program also reports the allocations, bytes and
+		peak resident set size of loading, searching and writing, and writes them to "memory.json".
 Error checking: Program checks for a valid file, checks to make sure size of board is greater than zero
 				(row>0, col>0)
 */
 
-#include "Stack.h"				//For use of stack
 #include "Exceptions.h"			//Exceptions
 #include "Location.h"			//Location struct
 #include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "PathWriter.h"			//Writing solution paths
+#include "SmallMazeSolver.h"		//Bitboard solver for small boards
+#include "BitBoard.h"			//Bit-packed board
+#include "FrontierBfs.h"		//Exit reachability
+#include "Options.h"			//Command line options
+#include "Benchmark.h"			//Benchmarks
+#include "ParallelBfs.h"		//Multi-threaded shortest path
+#include "AsyncWriter.h"		//Writing solutions off the search thread
+#include "PathEnumerator.h"		//Exhaustive search
+#include "Checkpoint.h"			//Saving and resuming the search
+#include "Shard.h"				//Splitting the search across processes
+#include "TiledBoard.h"			//Boards kept in a file
+#include "TiledSolver.h"		//Solvers of boards kept in a file
+#include "HpaGraph.h"			//Hierarchical pathfinding
+#include "Renderer.h"			//Drawing the maze
+#include "PathStats.h"			//Path statistics
+#include "WeightedSolver.h"		//Cheapest paths of boards with costs
+#include "MeetInMiddle.h"		//Paths joined from both ends
+#include "PathEstimator.h"		//Path count estimates
+#include "MemoryProfile.h"		//Memory profiling builds
+#include "SearchBudget.h"		//Run limits and cancellation
+#include "ResultCache.h"		//Results of mazes solved before
+#include "SolutionIndex.h"		//Finding paths in the solution file
+#include "LongestPath.h"		//Longest paths
+#include "KShortestPaths.h"		//K shortest paths
+#include "MazeBatch.h"			//Many small mazes at once
+#include "ProgressReporter.h"	//Progress of long searches
+#include "Doors.h"				//Entry and exit doors
+#include "GridSolver.h"			//Mazes of any dimensions
+#include <algorithm>			//max
+#include <chrono>				//Checkpoint intervals
+#include <climits>				//INT_MAX
+#include <cmath>				//log10
+#include <cstdio>				//remove
+#include <vector>				//Path movements
 #include <iostream>				//cout
 #include <fstream>				//File vars
 #include <string>				//Writing strings to file
 
 using namespace std;
 
-//At a given location, possible movements are up(NORTH), down(SOUTH), right(EAST), left(WEST)
-enum Direction {NORTH, SOUTH, EAST, WEST};
-
 //int constants
 const int UPPER_ASCII_LIMIT = 90;									//ascii value of Z
 const int LOWER_ASCII_LIMIT = 65;									//ascii value of A
+const long long CLOCK_CHECK_NODES = 1 << 20;						//Expanded cells between looks at the clock
+const size_t GRID_BLOCK_BYTES = 1 << 20;							//Bytes of grid paths written to the file at once
 
 //String constants 
 const string FILE_OUT = "solution.out";								//Output file to write solutions to
-const string NORTH_STR = "NORTH";									//North string literal
-const string SOUTH_STR = "SOUTH";									//South string literal
-const string EAST_STR = "EAST";										//East  string literal
-const string WEST_STR = "WEST";										//West string literal
-const string START = "START. ENTER FROM NORTH.";					//Entry string literal
-const string PATH_NUM = "PATH NUMBER: ";							//Path number string literal
-const string END = "EXIT SOUTH. END PATH.";							//Path exit string literal	
 const string NO_SOLUTIONS = "No solutions";							//No solutions literal
 	
 const string ENTER_FILE = "Enter name of maze file...";				//User prompt
@@ -73,35 +192,123 @@ const string EXIT_BLOCKED = "Exit is blocked. No solutions.";		//Exit blocked er
 const string ENTRY_BLOCKED = "Entry point blocked. No solutions.";	//Entry point blocked error
 const string FILE_READ_ERR = "Error reading file.";					//File read error
 const string FILE_FORMAT_ERR = "Bad file format.";					//Entry format error
+const string CHECKPOINT_ERR = "Could not save checkpoint.";			//Checkpoint write error
+const string RESUME_ERR = "No checkpoint of this maze to resume from.";	//Checkpoint read error
+const string MERGE_STR = "Merged shards into 'solution.out'. Solutions: ";	//Merge summary
+const string MERGE_ERR = "Missing or unfinished shard output. Nothing merged.";	//Merge error
+const string TILED_READ_ERR = "Error reading tiled board.";			//Tiled board file error
+const string TILED_STATE_SUFFIX = ".state";							//Suffix of a tiled solver's state file
+const string HPA_LOADED_STR = "Loaded cluster graph. Nodes: ";		//Cached graph summary
+const string HPA_BUILT_STR = "Built cluster graph. Nodes: ";		//New graph summary
+const string HPA_EDGES_STR = " Edges: ";							//Graph summary edge count
+const string RENDER_ERR = "Could not write image.";					//Image write error
+const string STATS_OUT = "solution.json";							//Summary of the path statistics
+const string CELLS_OUT = "solution.cells";							//Solutions through each cell
+const string STATS_STR = "Counted solutions into 'solution.json'. Solutions: ";	//Statistics summary
+const string STATS_ERR = "Could not write path statistics.";		//Statistics write error
+const string COST_HEADER = "COST";									//Starts the cost layer of a maze file
+const string ENTRY_HEADER = "ENTRY";								//Starts the entry doors of a maze file
+const string EXIT_HEADER = "EXIT";									//Starts the exit doors of a maze file
+const string COST_STR = "Cheapest path cost: ";						//Weighted path summary
+const string MAX_MOVES_STR = "Most moves in a path: ";				//Length limit summary
+const string MEET_STR = "Paths joined at the middle: ";				//Meet in the middle summary
+const string MEMORY_ERR = "Could not write memory profile.";			//Memory report write error
+const string ESTIMATE_STR = "Estimated paths: ";					//Path count estimate
+const string INTERVAL_STR = " 95% interval: ";						//Estimate confidence interval
+const string PROBES_STR = "Probes: ";								//Estimate probe count
+const string RATE_STR = " Probes per second: ";						//Estimate probe rate
+const string STOPPED_STR = "SEARCH STOPPED: ";						//Footer of a stopped search
+const string WRITTEN_STR = ". Solutions written: ";					//Footer solution count
+const string CACHE_HIT_STR = "Copied result from the cache. Solutions: ";	//Cache hit summary
+const string CACHE_ERR = "Could not store result in the cache.";		//Cache write error
+const string INDEX_ERR = "Could not write solution index.";			//Index write error
+const string INDEX_READ_ERR = "Could not index solution file.";		//Query without a readable file
+const string PATH_RANGE_ERR = "No such path. Paths in the file: ";	//Query past the last path
+const string LONGEST_STR = "Longest path moves: ";					//Longest path summary
+const string KSHORTEST_STR = "Shortest paths found: ";				//K shortest paths summary
+const string BATCH_READ_ERR = "Error reading batch file.";			//Batch file error
+const string BATCH_MAZE_STR = "Maze ";								//Batch result line
+const string BATCH_STR = "Mazes solved: ";							//Batch summary
+const string BATCH_REACHABLE_STR = ". Exit reachable: ";			//Batch summary
+const string PROGRESS_ERR = "Could not open progress file.";			//Progress file error
+const string DOORS_ERR = "A maze with doors only has every path and the shortest distances found.";	//Doors mode error
+const string DOOR_ENTRY_STR = "ENTRY ";								//Door pair line
+const string DOOR_EXIT_STR = " EXIT ";								//Door pair line
+const string DOOR_PAIRS_STR = "Door pairs: ";						//Door distances summary
+const string DOOR_JOINED_STR = ". Joined by a path: ";				//Door distances summary
+const string GRID_READ_ERR = "Error reading grid file.";			//Grid file error
+const string GRID_STR = "Paths through the grid: ";				//Grid summary
+
+//Handed to the small maze solver so each solution is written to the file as it is found
+struct SolutionFile
+{
+	AsyncWriter *writer;	//writer to hand solutions to
+	int counter;			//current solution number
+};
 
 
 /*
 ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 
-Location ModifyLocation(Location loc, Direction direction);
-	Given: a location, and a direction
-		-> modifies that location appropriately
-			If moving north, row is decremented
-			If moving south, row is incremented
-			If moving east, col is incremented
-			If moving west, col is decremented
-
-void WriteSolutionToFile(ofstream &outdat, StackClass solution, int &solutionNum);
-	Given: a output file stream, a StackClass, and a solution number
-		-> writes the current solution stack to the file stream
-
-Board CreateBoardFromFile(string fileIn, bool &error);
+StopReason EnumeratePaths(PathEnumerator &search, const vector<ShardUnit> &units, CheckpointInfo &progress,
+						  bool resumed, AsyncWriter &writer, ostream &outdat, const RunOptions &options,
+						  const CancelToken &token, ProgressReporter *reporter);
+	Given: a search, the units to search, how far the run has got, a writer, its stream, the checkpoint
+		   settings and budget, a cancel token and a progress reporter
+		-> hands every remaining path of the units to the writer, saving checkpoints and showing its
+			progress on the way, until the budget runs out or the token is cancelled. Returns why it stopped
+
+StopReason EnumerateDoorPaths(Board &gb, const vector<Door> &entries, const vector<Door> &exits, AsyncWriter &writer,
+							  const RunOptions &options, const CancelToken &token, vector<long long> &pairPaths,
+							  int &counter);
+	Given: a board, its entry and exit doors, a writer, the budget and a cancel token
+		-> hands every path from every entry to every exit to the writer, labelled with its doors, counting
+			the paths of each pair, until the budget runs out or the token is cancelled. Returns why it stopped
+
+bool SolveTiledBoard(const RunOptions &options);
+	Given: the command line options
+		-> writes a shortest path through the tiled board to the output file and reports its tile traffic,
+			returns false if the board could not be read
+
+bool SolveMazeBatch(const RunOptions &options);
+	Given: the command line options
+		-> writes the fewest moves through every maze of the batch file to the output file, returns false
+			if the batch file could not be read
+
+int SolveGrid(const RunOptions &options);
+	Given: the command line options
+		-> writes a shortest path, or every path, through the grid file's maze to the output file, returns
+			the exit status of the run
+
+bool PrintPaths(const string &solutionFile, const RunOptions &options);
+	Given: a solution file and the command line options
+		-> prints the paths asked for from the file, indexing it first if its index is missing or
+			out of date, returns false if the file does not hold them
+
+Board CreateBoardFromFile(string fileIn, bool &error, vector<Door> &entries, vector<Door> &exits);
 	Given: a properly formatted file, boolean value 
-		-> returns a new Board to the caller with proper dimensions and walls
+		-> returns a new Board to the caller with proper dimensions and walls, and the doors it declares
 			returns a boolean value representing a good file read or not
+
+void WriteSmallMazeSolution(const Direction moves[], int numMoves, void *context);
+	Given: a list of movements from the entry point, and a SolutionFile
+		-> hands the solution to the SolutionFile's writer under the next solution number
 */
 
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~Method Prototypes~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-Location ModifyLocation(Location loc, Direction direction);
-void WriteSolutionToFile(ofstream &outdat, StackClass solution, int solutionNum);
-Board CreateBoardFromFile(string fileIn, bool &error);
-bool FindPaths(Board &gb, Location loc, StackClass &path, int &counter, ofstream &outdat, ItemType curentItem);
+Board CreateBoardFromFile(string fileIn, bool &error, vector<Door> &entries, vector<Door> &exits);
+bool SolveTiledBoard(const RunOptions &options);
+bool SolveMazeBatch(const RunOptions &options);
+int SolveGrid(const RunOptions &options);
+bool PrintPaths(const string &solutionFile, const RunOptions &options);
+StopReason EnumeratePaths(PathEnumerator &search, const vector<ShardUnit> &units, CheckpointInfo &progress,
+						  bool resumed, AsyncWriter &writer, ostream &outdat, const RunOptions &options,
+						  const CancelToken &token, ProgressReporter *reporter);
+StopReason EnumerateDoorPaths(Board &gb, const vector<Door> &entries, const vector<Door> &exits, AsyncWriter &writer,
+							  const RunOptions &options, const CancelToken &token, vector<long long> &pairPaths,
+							  int &counter);
+void WriteSmallMazeSolution(const Direction moves[], int numMoves, void *context);
 
 
 
@@ -109,24 +316,117 @@ bool FindPaths(Board &gb, Location loc, StackClass &path, int &counter, ofstream
 /***************************************************************************************************/
 
 
-void main()
+int main(int argc, char *argv[])
 {
 	int counter = 0;										//Current number of solutions
 	int ascii = 0;											//var to hold ascii value of each character in the filename
 	bool valid = true;										//Flag to make sure file has a valid format
 	bool hasDot = false;									//Flag to make sure file contains a period
 	bool goodFile = true;									//Flag to make sure file was read properly
-	StackClass path;										//Stack to store paths
-	ItemType currentItem;									//Current ItemLocation of the stack
+	bool reachable = true;									//Flag to make sure the exit can be reached
+	string outName = FILE_OUT;								//File this run writes solutions to
+	vector<ShardUnit> units;								//Units of the exhaustive search
+	CheckpointInfo progress;								//How far the exhaustive search has got
+	vector<Direction> moves;								//Movements of the current path
+	vector<long long> solutionCounts;						//Solutions through each cell, when counted
 	Location start;											//Entry point of maze
-	ofstream outdat(FILE_OUT);								//Stream to write solutions to
+	Location exit;											//Exit point of maze
+	ofstream outdat;										//Stream to write solutions to
 	string filename;										//File name to read from
+	RunOptions options;										//Command line options
+	CancelToken token;										//Stops the search when signalled
+	StopReason stopReason = STOP_NONE;						//Why the search stopped early
+	int status = EXIT_OK;									//Exit status of the run
+	bool cached = false;									//Flag for a result copied from the cache
+	string cacheKey;										//Key of this run's result in the cache
+	vector<string> cacheFiles;								//Output files kept in the cache
+	vector<Door> entries;									//Entry doors the maze file declares
+	vector<Door> exits;										//Exit doors the maze file declares
+	vector<long long> doorPaths;							//Paths between each pair of doors
+	bool doors = false;										//Flag for a maze with doors of its own
 	
 	
 
-	//Prompt the user for the file name and store it
-	cout << ENTER_FILE << endl;
-	cin >> filename;
+	//Read the command line
+	if (!ParseOptions(argc, argv, options))
+	{
+		cout << USAGE << endl;
+		return EXIT_FAILED;
+
+	}//end bad command line
+
+	//Benchmarks replace solving a maze
+	if (options.benchmark)
+	{
+		RunBenchmarks(options.benchSize, options.threads, cout);
+		return EXIT_OK;
+
+	}//end benchmark
+
+	//Shards are written to files of their own, merged into one once every shard is done
+	if (options.merge)
+	{
+		remove(IndexFileName(FILE_OUT).c_str());
+		if (!MergeShards(FILE_OUT, options.numShards, counter))
+		{
+			cout << MERGE_ERR << endl;
+			return EXIT_FAILED;
+		}
+
+		cout << MERGE_STR << counter << endl;
+		return EXIT_OK;
+
+	}//end merge
+
+	//Boards too large to hold are solved from their file
+	if (!options.tiledFile.empty())
+	{
+		return SolveTiledBoard(options) ? EXIT_OK : EXIT_FAILED;
+
+	}//end tiled board
+
+	//Many mazes of a size are searched together from a single file
+	if (!options.batchFile.empty())
+	{
+		return SolveMazeBatch(options) ? EXIT_OK : EXIT_FAILED;
+
+	}//end maze batch
+
+	//A maze of any dimensions is solved from a grid file of its own
+	if (!options.gridFile.empty())
+	{
+		return SolveGrid(options);
+
+	}//end grid
+
+	if (options.numShards > 0)
+	{
+		outName = ShardFileName(FILE_OUT, options.shard);
+		options.checkpointFile = ShardFileName(options.checkpointFile, options.shard);
+
+	}//end shard
+
+	//Paths are printed from the file of an earlier run, nothing is solved
+	if (options.pathFirst > 0)
+	{
+		return PrintPaths(outName, options) ? EXIT_OK : EXIT_FAILED;
+
+	}//end path query
+
+	//A resumed run keeps what the last one wrote, so the file is only opened once the checkpoint is read.
+	//Either way the index of the last run's file no longer fits it
+	remove(IndexFileName(outName).c_str());
+	if (!options.resume)
+		outdat.open(outName.c_str());
+
+	//Prompt the user for the file name and store it, unless it was given on the command line
+	if (options.mazeFile.empty())
+	{
+		cout << ENTER_FILE << endl;
+		cin >> filename;
+	}
+	else
+		filename = options.mazeFile;
 
 	//File validation:
 
@@ -164,7 +464,7 @@ void main()
 	if (valid && hasDot)
 	{
 		//Create a board from the file
-		Board myboard = CreateBoardFromFile(filename, goodFile);
+		Board myboard = CreateBoardFromFile(filename, goodFile, entries, exits);
 		
 		//If file was read properly
 		if (goodFile)
@@ -172,49 +472,515 @@ void main()
 
 			//Prompt user of successful file read
 			cout << SUCCESS_STR << endl;
-			myboard.Print();
 
-			start.row = myboard.GetHeight() - 1; start.col = myboard.GetLength() - 1;
+			//A large board is shrunk to fit the console rather than printed a cell at a time
+			if (myboard.GetHeight() <= PRINT_LIMIT && myboard.GetLength() <= PRINT_LIMIT)
+				myboard.Print();
+			else
+			{
+				string text;
+				Renderer(myboard, 1).RenderText(TEXT_COLS, TEXT_ROWS, text);
+				cout << text << endl;
+
+			}//end large board
 
-			//Exit point is blocked
-			if (!myboard.IsOpen(start))
+			exit.row = myboard.GetHeight() - 1; exit.col = myboard.GetLength() - 1;
+			start.row = 0; start.col = 0;
+
+			//A maze with doors of its own enters and leaves through them, and the usual entry or exit
+			//stands in for the side it declares none of
+			if (!entries.empty() || !exits.empty())
+			{
+				Door door;
+
+				doors = true;
+				if (entries.empty())
+				{
+					door.cell = start;
+					door.side = NORTH;
+					entries.push_back(door);
+				}
+				if (exits.empty())
+				{
+					door.cell = exit;
+					door.side = SOUTH;
+					exits.push_back(door);
+				}
+
+				start = entries[0].cell;
+				exit = exits[0].cell;
+
+				//Every pair is searched in a single pass, which only these searches have
+				if (options.checkpoint || options.numShards > 0 || options.hpa || options.stats || options.meet ||
+					options.estimate || options.longest || options.kShortest > 0 || options.maxMoves > 0 ||
+					options.maxMovesPercent > 0 || !options.cacheDir.empty() || options.progressSecs > 0)
+				{
+					cout << DOORS_ERR << endl;
+					status = EXIT_FAILED;
+					valid = false;
+				}
+
+			}//end doors
+
+			//Exit point is blocked. A door that is blocked just has no paths
+			if (!doors && !myboard.IsOpen(exit))
 			{
 				outdat << EXIT_BLOCKED << endl;
 				valid = false;
 
 			}//end exit point check
 
-			start.row = 0; start.col = 0;
-
 			//Entry point is blocked
-			if (!myboard.IsOpen(start))
+			if (!doors && !myboard.IsOpen(start))
 			{
 				outdat << ENTRY_BLOCKED << endl;
 				valid = false;
 
 			}//end entry point check
 
-			//If the board is still valid, find all paths
-			if (valid)
+			//A maze solved before with the same solver is copied from the cache rather than searched
+			if (valid && !options.cacheDir.empty())
+			{
+				ResultCache cache(options.cacheDir, (long long)options.cacheMb << 20);
+				long long cachedCount = 0;
+
+				cacheKey = ResultCache::MakeKey(myboard, options.stats ? "stats" : options.meetCount ? "meet count" :
+																options.meet ? "meet" :
+																options.maxMoves > 0 ? "paths up to " + to_string(options.maxMoves) :
+																options.maxMovesPercent > 0 ? "paths up to " + to_string(options.maxMovesPercent) + "%" :
+																"paths");
+				cacheFiles.push_back(outName);
+				if (options.stats)
+				{
+					cacheFiles.push_back(STATS_OUT);
+					cacheFiles.push_back(CELLS_OUT);
+				}
+
+				//The output file is replaced by the copy, and opened again if there is none
+				outdat.close();
+				cached = cache.Fetch(cacheKey, cacheFiles, cachedCount);
+				if (!cached)
+					outdat.open(outName.c_str());
+
+				counter = int(min(cachedCount, (long long)INT_MAX));
+
+			}//end cache lookup
+
+			//Exit cannot be reached from the entry point, there is nothing to search
+			if (valid && !cached && !doors && !IsExitReachable(BitBoard(myboard), start, exit, SelectFrontierKernel()))
+				reachable = false;
+
+			PathEnumerator search(myboard, start, exit);
+
+			progress.shard = options.shard;
+			progress.numShards = options.numShards;
+			progress.unit = 0;
+			progress.counter = 0;
+			progress.outputOffset = 0;
+
+			//A shard searches its own run of units, anything else searches the whole tree
+			if (valid && reachable && options.numShards > 0)
+			{
+				vector<ShardUnit> plan;
+
+				PlanShards(myboard, start, exit, options.numShards, plan);
+				for (size_t i = 0; i < plan.size(); i++)
+				{
+					if (plan[i].shard == options.shard)
+						units.push_back(plan[i]);
+				}
+
+			}//end shard units
+
+			else
+			{
+				units.resize(1);
+				units[0].solution = false;
+				units[0].weight = 1;
+				units[0].shard = 0;
+
+			}//end whole search
+
+			//Carry on from the last checkpoint, after the solutions it had written. Whatever the last run
+			//wrote after it, such as the footer of a stopped search, is cut off first
+			if (options.resume)
+			{
+				if (valid && reachable && LoadCheckpoint(options.checkpointFile, search, progress) &&
+					progress.shard == options.shard && progress.numShards == options.numShards &&
+					progress.unit < int(units.size()) && TruncateOutput(outName, progress.outputOffset))
+				{
+					outdat.open(outName.c_str(), ios::in | ios::out);
+					outdat.seekp(progress.outputOffset);
+				}
+
+				if (!outdat.is_open() || !outdat.good())
+				{
+					cout << RESUME_ERR << endl;
+					valid = false;
+				}
+
+			}//end resume
+
+			//The board is loaded, what follows is counted as the search
+			SetMemoryPhase(PHASE_SEARCH);
+
+			//The index is written by the writer thread as it writes the paths, so it must outlive it. A
+			//resumed file, or one copied from the cache, is indexed when it is first queried instead
+			SolutionIndexWriter index(options.indexStride > 0 ? options.indexStride : DEFAULT_INDEX_STRIDE, FORMAT_TEXT);
+
+			//Solutions are written by their own thread while the search runs
+			AsyncWriter writer(outdat, options.ringSize, options.backpressure);
+
+			//The shortest distances between doors are lines of their own, not paths
+			if (valid && !cached && !options.resume && options.indexStride > 0 && !(doors && options.shortest) &&
+				index.Open(IndexFileName(outName)))
+				writer.SetIndex(&index);
+
+			//The result was copied from the cache, there is nothing left to do
+			if (cached)
+			{
+				cout << CACHE_HIT_STR << counter << endl;
+
+			}//end cached result
+
+			//The fewest moves between every entry and every exit, from a single search
+			else if (valid && doors && options.shortest)
+			{
+				vector<int> distance;
+
+				DoorDistances(myboard, entries, exits, distance);
+				for (size_t e = 0; e < entries.size(); e++)
+				{
+					for (size_t x = 0; x < exits.size(); x++)
+					{
+						outdat << DOOR_ENTRY_STR << DoorName(entries[e]) << DOOR_EXIT_STR << DoorName(exits[x]) << ": ";
+						if (distance[e * exits.size() + x] == UNREACHABLE)
+							outdat << NO_SOLUTIONS << endl;
+						else
+						{
+							outdat << distance[e * exits.size() + x] << endl;
+							counter++;
+						}
+
+					}//end for
+
+				}//end for
+
+				cout << DOOR_PAIRS_STR << entries.size() * exits.size() << DOOR_JOINED_STR << counter << endl;
+
+			}//end door distances
+
+			//Every path from every entry to every exit, a single search from each entry
+			else if (valid && doors)
+			{
+				//A scheduler stopping the run gets the solutions found so far rather than nothing
+				CancelOnSignal(token);
+
+				stopReason = EnumerateDoorPaths(myboard, entries, exits, writer, options, token, doorPaths, counter);
+
+				for (size_t e = 0; e < entries.size(); e++)
+				{
+					for (size_t x = 0; x < exits.size(); x++)
+						cout << DOOR_ENTRY_STR << DoorName(entries[e]) << DOOR_EXIT_STR << DoorName(exits[x]) << ": "
+							 << doorPaths[e * exits.size() + x] << endl;
+				}
+
+			}//end door paths
+
+			//Only a shortest path was asked for
+			else if (valid && reachable && options.shortest)
+			{
+				BfsStats stats;
+				long long cost;
+
+				//A board with a cost layer wants the cheapest path rather than the fewest moves
+				if (myboard.HasCosts())
+				{
+					if (CheapestPath(myboard, start, exit, moves, cost))
+					{
+						counter = 1;
+						writer.Submit(moves.empty() ? nullptr : &moves[0], int(moves.size()), counter);
+						cout << COST_STR << cost << endl;
+					}
+				}
+				else if (ParallelShortestPath(BitBoard(myboard), start, exit, options.threads, moves, stats))
+				{
+					counter = 1;
+					writer.Submit(moves.empty() ? nullptr : &moves[0], int(moves.size()), counter);
+				}
+
+			}//end find a shortest path
+
+			//Only a longest path was asked for
+			else if (valid && reachable && options.longest)
+			{
+				LongestStats stats;
+
+				CancelOnSignal(token);
+				if (LongestPath(myboard, start, exit, options.threads, options.budget, &token, moves, stats, stopReason))
+				{
+					counter = 1;
+					writer.Submit(moves.empty() ? nullptr : &moves[0], int(moves.size()), counter);
+					cout << LONGEST_STR << moves.size() << endl;
+				}
+
+				WriteLongestStats(stats, cout);
+
+			}//end find a longest path
+
+			//Only the k cheapest paths were asked for
+			else if (valid && reachable && options.kShortest > 0)
 			{
-				currentItem.loc = start;
-				FindPaths(myboard, start, path, counter, outdat, currentItem);
+				KShortestStats stats;
+				SolutionFile solutionFile;
+				solutionFile.writer = &writer;
+				solutionFile.counter = 0;
+
+				CancelOnSignal(token);
+				counter = int(KShortestPaths(myboard, start, exit, options.kShortest, options.threads, options.budget,
+											 &token, WriteSmallMazeSolution, &solutionFile, stats, stopReason));
+				cout << KSHORTEST_STR << counter << endl;
+
+				WriteKShortestStats(stats, cout);
+
+			}//end find the k shortest paths
+
+			//A single path through the cluster graph, kept next to the maze file between runs
+			else if (valid && reachable && options.hpa)
+			{
+				HpaGraph graph(options.clusterSize);
+				string graphFile = filename + HPA_CACHE_SUFFIX;
+				bool loaded = graph.Load(graphFile, myboard);
+
+				if (!loaded)
+				{
+					graph.Build(myboard);
+					graph.Save(graphFile, myboard);
+				}
+
+				cout << (loaded ? HPA_LOADED_STR : HPA_BUILT_STR) << graph.GetNumNodes()
+					 << HPA_EDGES_STR << graph.GetNumEdges() << endl;
+
+				if (graph.FindPath(myboard, start, exit, moves))
+				{
+					counter = 1;
+					writer.Submit(moves.empty() ? nullptr : &moves[0], int(moves.size()), counter);
+				}
+
+			}//end find a hierarchical path
+
+			//Only the totals over every path were asked for, they are written even if there are none
+			else if (valid && options.stats)
+			{
+				PathStats stats(myboard, start, exit);
+				ofstream summary(STATS_OUT.c_str());
+
+				if (reachable)
+					CollectPathStats(myboard, start, exit, options.threads, stats);
+				stats.WriteSummary(summary, CELLS_OUT);
+				summary.close();
+
+				if (summary.fail() || !stats.WriteCellCounts(CELLS_OUT))
+					cout << STATS_ERR << endl;
+
+				cout << STATS_STR << stats.GetNumSolutions() << endl;
+				counter = int(min(stats.GetNumSolutions(), (long long)INT_MAX));
+				solutionCounts = stats.GetCellCounts();
+
+			}//end count solutions
+
+			//Only an estimate of the number of paths, for mazes with too many to find
+			else if (valid && options.estimate)
+			{
+				PathEstimate estimate;
+
+				estimate.found = false;
+				estimate.probes = 0;
+				estimate.seconds = 0;
+
+				if (reachable)
+					EstimatePaths(myboard, start, exit, options.estimateMethod, options.threads,
+								  options.estimateSecs, estimate);
+
+				if (estimate.found)
+				{
+					double low = 1 - estimate.relativeError;
+
+					cout << ESTIMATE_STR << FormatLog10(estimate.log10Paths) << INTERVAL_STR
+						 << (low > 0 ? FormatLog10(estimate.log10Paths + log10(low)) : "0") << " - "
+						 << FormatLog10(estimate.log10Paths + log10(1 + estimate.relativeError)) << endl;
+				}
+				else
+					cout << ESTIMATE_STR << 0 << endl;
+
+				cout << PROBES_STR << estimate.probes << RATE_STR
+					 << (estimate.seconds > 0 ? (long long)(estimate.probes / estimate.seconds) : 0) << endl;
+
+				//Nothing was written, only a maze without paths gets its message
+				counter = estimate.found ? 1 : 0;
+
+			}//end estimate
+
+			//Every path joined from halves searched from the entry and the exit. A board of a single
+			//row has no cut, and is searched as usual
+			else if (valid && options.meet && CanMeetInMiddle(myboard, start, exit))
+			{
+				unsigned long long paths = 0;
+
+				if (reachable && options.meetCount)
+					paths = MeetCountPaths(myboard, start, exit);
+
+				else if (reachable)
+				{
+					SolutionFile solutionFile;
+					solutionFile.writer = &writer;
+					solutionFile.counter = 0;
+
+					paths = (unsigned long long)MeetStreamPaths(myboard, start, exit, WriteSmallMazeSolution, &solutionFile);
+
+				}//end write paths
+
+				cout << MEET_STR << paths << endl;
+				counter = int(min(paths, (unsigned long long)INT_MAX));
+
+			}//end meet in the middle
+
+			//If the board is still valid, find all paths. The small maze solver can only be cancelled, not limited
+			//in length or sampled, so a run with a budget, a length limit or progress is left to the search that can
+			else if (valid && reachable && !options.checkpoint && options.numShards == 0 && !HasBudget(options.budget) &&
+					 options.maxMoves == 0 && options.maxMovesPercent == 0 && options.progressSecs == 0 &&
+					 IsSmallMaze(myboard))
+			{
+				SolutionFile solutionFile;
+				solutionFile.writer = &writer;
+				solutionFile.counter = 0;
+
+				//A scheduler stopping the run gets the solutions found so far rather than nothing
+				CancelOnSignal(token);
+				counter = SolveSmallMaze(myboard, WriteSmallMazeSolution, &solutionFile, &token);
+				stopReason = token.GetReason();
+
+			}//end find all solutions on a small board
+
+			else if (valid && reachable)
+			{
+				//A scheduler stopping the run gets the solutions found so far rather than nothing
+				CancelOnSignal(token);
+				search.SetCancelToken(&token);
+
+				//The distance from every cell to the exit is found once, and cuts every path too long to make it
+				if (options.maxMoves > 0 || options.maxMovesPercent > 0)
+				{
+					vector<int> toExit;
+					int maxMoves = options.maxMoves;
+
+					ComputeDistanceLayers(BitBoard(myboard), exit, toExit, SelectFrontierKernel());
+					if (options.maxMovesPercent > 0)
+						maxMoves = int((long long)toExit[start.row * myboard.GetLength() + start.col] *
+									   options.maxMovesPercent / 100);
+
+					cout << MAX_MOVES_STR << search.SetLengthLimit(toExit, maxMoves) << endl;
+
+				}//end length limit
+
+				//A thread of its own samples the search's progress, which the search only stores as it pauses
+				ProgressReporter reporter(max(options.progressSecs, 1), options.progressFile);
+				ProgressReporter *live = nullptr;
+
+				if (options.progressSecs > 0 && reporter.Start())
+					live = &reporter;
+				else if (options.progressSecs > 0)
+					cout << PROGRESS_ERR << endl;
+
+				stopReason = EnumeratePaths(search, units, progress, options.resume, writer, outdat, options, token, live);
+				reporter.Stop();
+				counter = progress.counter;
 
 			}//end find all solutions
 
-			//If no paths were found, there are no solutions
-			if (counter == 0 && valid)
+			//Writing out the last of the solutions, the image and the statistics
+			SetMemoryPhase(PHASE_WRITE);
+			writer.Finish();
+
+			//The index ends where the paths do, before any footer
+			if (index.IsOpen() && !index.Finish(writer.GetBytesWritten()))
+				cout << INDEX_ERR << endl;
+
+			//Draw the maze, with the single path found and the heat of each cell
+			if (!options.renderFile.empty())
+			{
+				Renderer renderer(myboard, GetCellPixels(myboard));
+
+				if (options.heatmap && !solutionCounts.empty())
+					renderer.DrawHeatmap(solutionCounts);
+
+				else if (options.heatmap && myboard.IsOpen(start))
+				{
+					vector<int> distance;
+					vector<long long> heat;
+
+					FloodFillDistances(myboard, start, distance);
+					heat.resize(distance.size());
+					for (size_t i = 0; i < distance.size(); i++)
+						heat[i] = distance[i] == UNREACHABLE ? 0 : distance[i] + 1;
+					renderer.DrawHeatmap(heat);
+
+				}//end heatmap
+
+				if ((options.shortest || options.hpa || options.longest) && !doors && counter == 1)
+					renderer.DrawPath(start, moves);
+
+				if (!renderer.WriteImage(options.renderFile))
+					cout << RENDER_ERR << endl;
+
+			}//end render
+
+			//The search stopped early, the file ends with why, and the checkpoint is kept to resume from
+			if (stopReason != STOP_NONE)
+			{
+				outdat << STOPPED_STR << StopReasonName(stopReason) << WRITTEN_STR << counter << endl;
+				cout << STOPPED_STR << StopReasonName(stopReason) << WRITTEN_STR << counter << endl;
+				status = StopExitStatus(stopReason);
+
+			}//end stopped search
+
+			//The run is complete, its checkpoint is no longer needed
+			else if (options.checkpoint && valid)
+				remove(options.checkpointFile.c_str());
+
+			//If no paths were found, there are no solutions. The shortest distances between doors already
+			//say so for each pair that is not joined
+			if (counter == 0 && valid && stopReason == STOP_NONE && !cached && !(doors && options.shortest))
 			{
 				outdat << NO_SOLUTIONS << endl;
 
 			}//end no solutions
 
+			//A shard that has searched all of its units says so last, the merge takes no other
+			if (options.numShards > 0 && stopReason == STOP_NONE && status == EXIT_OK)
+			{
+				outdat << SHARD_DONE_STR << endl;
+
+			}//end shard complete
+
+			//Keep the complete output for the next run of the same maze
+			if (!cacheKey.empty() && !cached && stopReason == STOP_NONE)
+			{
+				ResultCache cache(options.cacheDir, (long long)options.cacheMb << 20);
+
+				outdat.close();
+				if (!cache.Store(cacheKey, cacheFiles, counter))
+					cout << CACHE_ERR << endl;
+
+			}//end cache store
+
 		}
 
 		//File was not read properly
 		else
 		{
 			cout << FILE_READ_ERR << endl;
+			status = EXIT_FAILED;
 
 		}//end file read error
 
@@ -225,9 +991,20 @@ void main()
 	else
 	{
 		cout << FILE_FORMAT_ERR << endl;
+		status = EXIT_FAILED;
 
 	}//end invalid file
 
+	//Built to profile memory, report where it went
+	if (IsMemoryProfiled())
+	{
+		WriteMemoryReport(cout);
+		if (!WriteMemoryJson(MEMORY_OUT))
+			cout << MEMORY_ERR << endl;
+
+	}//end memory report
+
+	return status;
 	
 }//end main
 
@@ -235,167 +1012,619 @@ void main()
 /***************************************************************************************************/
 
 
-//pre:  gb is a valid gameboard
-//		loc is the a valid starting point w/in gb
-//		outdat is a valid output stream
-//post:	recursively finds all possible paths for a given board and writes each solution to a given file
-//		provided a solution stack
-bool FindPaths(	/*inout*/Board &gb,				//board that will track movements
-				/*in*/Location loc,				//current location that we are checking
-				/*inout*/StackClass &path,		//current solution path stores as a stack
-				/*inout*/int &counter,			//current solution number
-				/*inout*/ofstream &outdat,		//file stream to write solutions to
-				/*inout*/ItemType currentItem)	//current item in the stack
+//pre: search is ready to carry on, units hold the units of the search in order. progress.counter
+//		solutions have been written to outdat through writer. If resumed, search has been loaded
+//		partway through units[progress.unit]
+//post: every remaining path of the units has been handed to the writer and progress.counter holds
+//		their number, unless a limit of options.budget was reached or token was cancelled first, in
+//		which case progress.counter holds the number handed over before it stopped. If options ask
+//		for checkpoints, one has been saved to the checkpoint file whenever their interval passed,
+//		and where the search stopped. If reporter is not null, the search has stored its progress in
+//		it every CLOCK_CHECK_NODES expanded cells or sooner, and its solutions as they were found.
+//		Why the search stopped, or STOP_NONE, is returned to the caller
+/*out*/StopReason EnumeratePaths(						//reason returned to the caller
+						/*inout*/PathEnumerator &search,		//search to carry on
+						/*in*/const vector<ShardUnit> &units,	//units of the search
+						/*inout*/CheckpointInfo &progress,	//how far the search has got
+						/*in*/bool resumed,					//search was loaded from a checkpoint
+						/*inout*/AsyncWriter &writer,		//writer to hand solutions to
+						/*in*/ostream &outdat,				//stream the writer writes to
+						/*in*/const RunOptions &options,	//checkpoint settings and budget
+						/*in*/const CancelToken &token,		//token that stops the search
+						/*inout*/ProgressReporter *reporter)	//reporter to store progress in, null for none
 {
+	SearchStatus status;
+	StopReason reason = STOP_NONE;									//why the search stopped early
+	long long pauseNodes = 0;										//expanded cells between pauses
+	long long doneNodes = 0;										//expanded cells of finished units
+	long long startNodes = search.GetNodes();						//expanded cells before this run
+	long long savedNodes = startNodes;								//expanded cells at the last checkpoint
+	int startCounter = progress.counter;							//solutions written before this run
+	long long bytes = 0;											//bytes of solutions handed over by this run
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();	//time this run started
+	chrono::steady_clock::time_point savedTime = startTime;			//time of the last checkpoint
+
+	//Pause often enough to look at the clock, or exactly on the node intervals
+	if (options.checkpointSecs > 0 || options.budget.seconds > 0 || reporter != nullptr)
+		pauseNodes = CLOCK_CHECK_NODES;
+
+	if (options.checkpointNodes > 0 && (pauseNodes == 0 || options.checkpointNodes < pauseNodes))
+		pauseNodes = options.checkpointNodes;
+
+	if (options.budget.nodes > 0 && (pauseNodes == 0 || options.budget.nodes < pauseNodes))
+		pauseNodes = options.budget.nodes;
+
+	search.SetPauseInterval(pauseNodes);
+
+	//Where a resumed search starts from
+	if (reporter != nullptr)
+	{
+		reporter->SetSolutions(progress.counter);
+		reporter->SetSearch(search.GetNodes(), 0, nullptr, 0,
+							(progress.unit + (resumed ? search.EstimateDone() : 0.0)) / units.size());
 
-	//Current item is the current location, add it to solition stack
-	currentItem.loc.row = loc.row; currentItem.loc.col = loc.col;
-	path.Push(currentItem);
+	}//end first progress
 
-	//If we are at an exit point, we have a solution
-	if ((loc.row == gb.GetHeight() - 1 &&
-		loc.col == gb.GetLength() - 1))
+	for (; progress.unit < int(units.size()); progress.unit++)
 	{
-		
-		counter++;
-		WriteSolutionToFile(outdat, path, counter);
+		const ShardUnit &unit = units[progress.unit];
+		const Direction *prefix = unit.moves.empty() ? nullptr : &unit.moves[0];
+
+		//A solution shorter than the prefixes is a unit of its own. Stopping here keeps the last checkpoint
+		if (unit.solution)
+		{
+			progress.counter++;
+			writer.Submit(prefix, int(unit.moves.size()), progress.counter);
+			if (reporter != nullptr)
+				reporter->SetSolutions(progress.counter);
+			if (options.budget.bytes > 0)
+				bytes += MovesSize(prefix, int(unit.moves.size()), progress.counter);
+
+			reason = CheckBudget(options.budget, 0, 0, progress.counter - startCounter, bytes);
+			if (reason != STOP_NONE)
+				break;
+			continue;
+
+		}//end solution unit
+
+		//A loaded search is already partway through its unit
+		if (!resumed)
+			search.SetPrefix(prefix, int(unit.moves.size()));
+		resumed = false;
+
+		while ((status = search.Next()) != SEARCH_DONE)
+		{
+			//Hand each solution to the writer. Only the solution and output limits move with a solution,
+			//and the bytes are only counted when limited
+			if (status == SEARCH_SOLUTION)
+			{
+				progress.counter++;
+				writer.Submit(search.GetMoves(), search.GetNumMoves(), progress.counter);
+				if (reporter != nullptr)
+					reporter->SetSolutions(progress.counter);
+				if (options.budget.bytes > 0)
+					bytes += MovesSize(search.GetMoves(), search.GetNumMoves(), progress.counter);
+
+				reason = CheckBudget(options.budget, 0, 0, progress.counter - startCounter, bytes);
+				if (reason == STOP_NONE)
+					continue;
+
+			}//end solution
+
+			chrono::steady_clock::time_point now = chrono::steady_clock::now();
+
+			//Paused, the reporter's sampling thread reads where the search has got to
+			if (reporter != nullptr)
+				reporter->SetSearch(doneNodes + search.GetNodes(), search.GetDepth(), search.GetMoves(),
+									search.GetDepth() - 1, (progress.unit + search.EstimateDone()) / units.size());
+
+			//Paused, either the token was cancelled or it is time to look at the budget
+			if (reason == STOP_NONE)
+				reason = token.GetReason();
+
+			if (reason == STOP_NONE)
+				reason = CheckBudget(options.budget, chrono::duration<double>(now - startTime).count(),
+									 doneNodes + search.GetNodes() - startNodes, progress.counter - startCounter, bytes);
+
+			//Save a checkpoint once either interval has passed, or where the search stopped
+			if ((options.checkpoint && reason != STOP_NONE) ||
+				(options.checkpointNodes > 0 && doneNodes + search.GetNodes() - savedNodes >= options.checkpointNodes) ||
+				(options.checkpointSecs > 0 && now - savedTime >= chrono::seconds(options.checkpointSecs)))
+			{
+				//The checkpoint must not get ahead of the file
+				writer.Flush();
+				progress.outputOffset = (long long)outdat.tellp();
 
-	}//end solution
+				if (!SaveCheckpoint(options.checkpointFile, search, progress))
+					cout << CHECKPOINT_ERR << endl;
 
+				savedNodes = doneNodes + search.GetNodes();
+				savedTime = now;
 
-	//If the current space is available
-	else if (gb.IsOpen(loc))
-	{
+			}//end checkpoint
 
-		//Set it as marked
-		gb.SetOpen(loc, false);
+			if (reason != STOP_NONE)
+				break;
 
-		//South movement
-		if (FindPaths(gb, ModifyLocation(loc, SOUTH), path, counter, outdat, currentItem))
-			return true;
-		
-		//East movement
-		if (FindPaths(gb, ModifyLocation(loc, EAST), path, counter, outdat, currentItem))
-			return true;
+		}//end while
+
+		//Stopped partway through the unit, which stays the current one
+		if (reason != STOP_NONE)
+			break;
+
+		doneNodes += search.GetNodes();
+
+	}//end for
+
+	//The last sample shows where the search ended
+	if (reporter != nullptr && reason == STOP_NONE)
+		reporter->SetSearch(doneNodes, 0, nullptr, 0, 1.0);
 
-		//North movement
-		if (FindPaths(gb, ModifyLocation(loc, NORTH), path, counter, outdat, currentItem))
-			return true;
+	else if (reporter != nullptr)
+		reporter->SetSearch(doneNodes + search.GetNodes(), search.GetDepth(), search.GetMoves(),
+							search.GetDepth() - 1, (progress.unit + search.EstimateDone()) / units.size());
 
-		//West movement
-		if (FindPaths(gb, ModifyLocation(loc, WEST), path, counter, outdat, currentItem))
-			return true;
+	return reason;
 
-		//No possible movements, set the space as open, backtrack
-		gb.SetOpen(loc, true);
+}//end EnumeratePaths
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, every door is within its bounds, nothing has been submitted to writer
+//post: every path from every open entry door to every open exit door has been handed to the writer,
+//		entry by entry, written between the entry line and the exit line of its doors, and counter
+//		holds their number. pairPaths holds the number of paths of each pair, entry e to exit x at
+//		e * exits.size() + x. Each entry is searched once for the paths to every exit: a path reaching
+//		an exit carries on through it to the others, and reaching a cell with many exit doors is a
+//		path to each of them. If a limit of options.budget was reached or token was cancelled first,
+//		the paths handed over by then are counted. Why the search stopped, or STOP_NONE, is returned
+//		to the caller
+/*out*/StopReason EnumerateDoorPaths(					//reason returned to the caller
+						/*in*/Board &gb,						//board to search
+						/*in*/const vector<Door> &entries,		//entry doors
+						/*in*/const vector<Door> &exits,		//exit doors
+						/*inout*/AsyncWriter &writer,		//writer to hand solutions to
+						/*in*/const RunOptions &options,	//budget of the search
+						/*in*/const CancelToken &token,		//token that stops the search
+						/*out*/vector<long long> &pairPaths,	//paths between each pair of doors
+						/*out*/int &counter)				//paths handed over
+{
+	vector<string> starts(entries.size() * exits.size());		//entry line of each pair
+	vector<string> ends(entries.size() * exits.size());		//exit line of each pair
+	vector<Location> exitCells;									//open cells with exit doors
+	vector<vector<int> > cellDoors;								//exit doors of each of those cells
+	SearchStatus status;
+	StopReason reason = STOP_NONE;								//why the search stopped early
+	long long pauseNodes = 0;									//expanded cells between pauses
+	long long doneNodes = 0;									//expanded cells of finished entries
+	long long bytes = 0;										//bytes of solutions handed over
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();	//time the search started
+
+	pairPaths.assign(entries.size() * exits.size(), 0);
+	counter = 0;
+
+	for (size_t e = 0; e < entries.size(); e++)
+	{
+		for (size_t x = 0; x < exits.size(); x++)
+		{
+			starts[e * exits.size() + x] = EntryLine(entries[e]);
+			ends[e * exits.size() + x] = ExitLine(exits[x]);
+		}
 	}
 
+	writer.SetLabels(starts, ends);
+
+	//A corner cell may have a door on either side, a path reaching it leaves by both. A blocked door is never reached
+	for (size_t x = 0; x < exits.size(); x++)
+	{
+		size_t cell = 0;
+
+		if (!gb.IsOpen(exits[x].cell))
+			continue;
+
+		while (cell < exitCells.size() && !(exitCells[cell].row == exits[x].cell.row &&
+											exitCells[cell].col == exits[x].cell.col))
+			cell++;
+
+		if (cell == exitCells.size())
+		{
+			exitCells.push_back(exits[x].cell);
+			cellDoors.push_back(vector<int>());
+		}
+		cellDoors[cell].push_back(int(x));
+
+	}//end for
+
+	//Pause often enough to look at the clock, or exactly on the node limit
+	if (options.budget.seconds > 0)
+		pauseNodes = CLOCK_CHECK_NODES;
+
+	if (options.budget.nodes > 0 && (pauseNodes == 0 || options.budget.nodes < pauseNodes))
+		pauseNodes = options.budget.nodes;
+
+	for (size_t e = 0; e < entries.size() && reason == STOP_NONE && !exitCells.empty(); e++)
+	{
+		if (!gb.IsOpen(entries[e].cell))
+			continue;
+
+		PathEnumerator search(gb, entries[e].cell, exitCells[0]);
+
+		for (size_t cell = 1; cell < exitCells.size(); cell++)
+			search.AddExit(exitCells[cell]);
+
+		search.SetCancelToken(&token);
+		search.SetPauseInterval(pauseNodes);
+
+		while ((status = search.Next()) != SEARCH_DONE)
+		{
+			//A path to a cell of many exit doors is a path to each of them
+			if (status == SEARCH_SOLUTION)
+			{
+				const vector<int> &reached = cellDoors[search.GetExit()];
+
+				for (size_t i = 0; i < reached.size() && reason == STOP_NONE; i++)
+				{
+					int pair = int(e * exits.size()) + reached[i];
+
+					counter++;
+					pairPaths[pair]++;
+					writer.Submit(search.GetMoves(), search.GetNumMoves(), counter, pair);
+					if (options.budget.bytes > 0)
+						bytes += MovesSize(search.GetMoves(), search.GetNumMoves(), counter, starts[pair], ends[pair]);
+
+					reason = CheckBudget(options.budget, 0, 0, counter, bytes);
+
+				}//end for
+
+				if (reason == STOP_NONE)
+					continue;
+
+			}//end solution
+
+			//Paused, either the token was cancelled or it is time to look at the budget
+			if (reason == STOP_NONE)
+				reason = token.GetReason();
+
+			if (reason == STOP_NONE)
+				reason = CheckBudget(options.budget,
+									 chrono::duration<double>(chrono::steady_clock::now() - startTime).count(),
+									 doneNodes + search.GetNodes(), counter, bytes);
+
+			if (reason != STOP_NONE)
+				break;
+
+		}//end while
 
-	//Base case: current location is not available
-	path.Pop();
-	return false;
+		doneNodes += search.GetNodes();
 
-}
+	}//end for
+
+	return reason;
+
+}//end EnumerateDoorPaths
 
 
 /***************************************************************************************************/
 
 
-//pre: loc is a valid initalized Location
-//post: loc has been modified appropriately given a direction
-//		If moving north, row is decremented
-//		If moving south, row is incremented
-//		If moving east, col is incremented
-//		If moving west, col is decremented
-//		The modified location has been returned to the caller
+//pre: options.tiledFile names a tiled board file, or options.mazeFile a maze file to write to it
+//post: a shortest path from the top left to the bottom right of the tiled board, or why there is
+//		none, has been written to the output file. The tile traffic of the reachability check and
+//		of the search has been written to the console. Returns true to the caller if the board could
+//		be read, false otherwise
+/*out*/bool SolveTiledBoard(/*in*/const RunOptions &options)	//command line options
+{
+	size_t cacheBytes = (options.tileCacheMb << 20) / 2;	//memory for board tiles, and as much for state
+	string stateFile = options.tiledFile + TILED_STATE_SUFFIX;
+	vector<Direction> moves;
+	TileStats stats;
+	Location start, exit;
+	ofstream outdat;
+
+	//A maze file given as well is written to the tiled board first
+	if (!options.mazeFile.empty() && !ImportMazeFile(options.mazeFile, options.tiledFile))
+	{
+		cout << FILE_READ_ERR << endl;
+		return false;
+
+	}//end import
+
+	TiledBoard board(options.tiledFile, cacheBytes);
+
+	if (!board.IsGood())
+	{
+		cout << TILED_READ_ERR << endl;
+		return false;
+
+	}//end bad tiled board
+
+	remove(IndexFileName(FILE_OUT).c_str());
+	outdat.open(FILE_OUT.c_str());
+	cout << SUCCESS_STR << endl;
+
+	start.row = 0; start.col = 0;
+	exit.row = int(board.GetHeight() - 1); exit.col = int(board.GetLength() - 1);
+
+	if (!board.IsOpen(exit.row, exit.col))
+		outdat << EXIT_BLOCKED << endl;
+
+	else if (!board.IsOpen(start.row, start.col))
+		outdat << ENTRY_BLOCKED << endl;
+
+	else
+	{
+		bool reachable = TiledExitReachable(board, start, exit, stateFile, cacheBytes, stats);
+
+		cout << "Reachability:" << endl;
+		WriteTileStats(stats, cout);
+
+		if (reachable && TiledShortestPath(board, start, exit, stateFile, cacheBytes, moves, stats))
+		{
+			cout << "Shortest path:" << endl;
+			WriteTileStats(stats, cout);
+			WriteMovesToFile(outdat, moves.empty() ? nullptr : &moves[0], int(moves.size()), 1);
+		}
+		else
+			outdat << NO_SOLUTIONS << endl;
+
+	}//end search
+
+	return true;
+
+}//end SolveTiledBoard
+
+
+/***************************************************************************************************/
 
-/*out*/ Location ModifyLocation						//Modified location to return to caller
-						(/*in*/Location loc,		//The given location to be modified 
-						/*in*/Direction direction)	//Desired direction of movement
+
+//pre: options.batchFile is the batch file to solve
+//post: a line giving the fewest moves from the top left to the bottom right of each maze of the
+//		batch file, or that there is no path, has been written to the output file in the order of the
+//		file, and a summary to the console. Returns true to the caller if the batch file could be
+//		read, false otherwise
+/*out*/bool SolveMazeBatch(/*in*/const RunOptions &options)	//command line options
 {
-	switch (direction)
+	MazeBatch batch;
+	vector<int> moves;
+	Location start, exit;
+	ofstream outdat;
+	int reachable = 0;
+
+	if (!batch.Load(options.batchFile))
 	{
-	case NORTH:
-		loc.row--;
-		break;
+		cout << BATCH_READ_ERR << endl;
+		return false;
+
+	}//end bad batch file
 
-	case SOUTH:
-		loc.row++;
-		break;
+	remove(IndexFileName(FILE_OUT).c_str());
+	outdat.open(FILE_OUT.c_str());
+	cout << SUCCESS_STR << endl;
 
-	case EAST:
-		loc.col++;
-		break;
+	start.row = 0; start.col = 0;
+	exit.row = batch.GetHeight() - 1; exit.col = batch.GetLength() - 1;
+	batch.Solve(start, exit, SelectFrontierKernel(), moves);
 
-	case WEST:
-		loc.col--;
-		break;
+	for (size_t i = 0; i < moves.size(); i++)
+	{
+		outdat << BATCH_MAZE_STR << i + 1 << ": ";
+		if (moves[i] == UNREACHABLE)
+			outdat << NO_SOLUTIONS << endl;
+		else
+		{
+			outdat << moves[i] << endl;
+			reachable++;
+		}
 
-	}//end switch
+	}//end for
 
-	return loc;
+	cout << BATCH_STR << moves.size() << BATCH_REACHABLE_STR << reachable << endl;
+	return true;
 
-}//end ModifyLocation
+}//end SolveMazeBatch
 
 
 /***************************************************************************************************/
 
 
-//pre: outdat has been bound to an output file
-//		solution is a valid StackClass containing a solution path
-//		solutionNum is the current number of solutions for the board
-//post: The solution contained in StackClass has been written to outdat
-void WriteSolutionToFile(	/*inout*/ofstream &outdat, //output file to be written to
-							/*in*/StackClass solution, //solution stack. passed by copy to 
-													   //preserve the original stack
-							/*in*/int solutionNum)	   //current solution number
+//pre: options.gridFile is the grid file to solve
+//post: a shortest path from the first cell of the grid to the last if options.shortest, or every
+//		path between them, has been written to the output file in the solution file format, each
+//		movement by the grid's name for it, and a summary to the console. If a limit of
+//		options.budget was reached or a signal stopped the search first, the file keeps the paths
+//		found by then and ends with why it stopped. The exit status of the run is returned to the caller
+/*out*/int SolveGrid(/*in*/const RunOptions &options)	//command line options
 {
+	FlatGrid grid;
+	vector<int> coords;				//coordinates of the entry and exit points
+	vector<string> names;			//name of each movement
+	vector<int> path;				//movements of a shortest path
+	size_t entry, exit;
+	ofstream outdat;
+	string buffer;					//paths not yet written to the file
+	CancelToken token;
+	StopReason reason = STOP_NONE;	//why the search stopped early
+	int counter = 0;
+	long long bytes = 0;			//bytes of paths written
+	long long pauseNodes = 0;		//expanded cells between pauses
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();	//time the search started
+
+	if (!grid.Load(options.gridFile))
+	{
+		cout << GRID_READ_ERR << endl;
+		return EXIT_FAILED;
 
-	
+	}//end bad grid file
+
+	remove(IndexFileName(FILE_OUT).c_str());
+	outdat.open(FILE_OUT.c_str());
+	cout << SUCCESS_STR << endl;
 
-	ItemType current, next;			//Used to compare current and next stack items
-	StackClass reverse;				//Stack initally is 'backwards'
+	//The entry point is the first cell of the grid and the exit point the last, as on a board
+	coords.assign(grid.GetNumDims(), 0);
+	grid.CellOf(coords, entry);
+	for (int dim = 0; dim < grid.GetNumDims(); dim++)
+		coords[dim] = grid.GetDim(dim) - 1;
+	grid.CellOf(coords, exit);
 
-	//get the soltion in the correct order
-	while (!solution.IsEmpty())
+	if (!grid.IsOpen(exit))
 	{
-		reverse.Push(solution.Retrieve());
-		solution.Pop();
+		outdat << EXIT_BLOCKED << endl;
+		return EXIT_OK;
 
-	}//end while
+	}//end exit point check
 
-	solution = reverse;
+	if (!grid.IsOpen(entry))
+	{
+		outdat << ENTRY_BLOCKED << endl;
+		return EXIT_OK;
 
+	}//end entry point check
 
-	//Write the path to the file
-	outdat << PATH_NUM << solutionNum << endl;
-	outdat << START << endl;
+	for (int move = 0; move < grid.GetNumSteps() + grid.GetNumPortals(); move++)
+		names.push_back(grid.MoveName(move));
 
-	//While the solution stack is not empty, compare each location to see which direction it moved
-	while (!solution.IsEmpty())
+	//Only a shortest path was asked for
+	if (options.shortest)
 	{
-		current = solution.Retrieve();
-		solution.Pop();
-		if (!solution.IsEmpty())
+		if (GridShortestPath(grid, entry, exit, path))
 		{
-			next = solution.Retrieve();
-			if (current.loc.row < next.loc.row)
-				outdat << SOUTH_STR;
-			else if (current.loc.row > next.loc.row)
-				outdat << NORTH_STR;
-			else if (current.loc.col < next.loc.col)
-				outdat << EAST_STR;
-			else if (current.loc.col > next.loc.col)
-				outdat << WEST_STR;
-			outdat << endl;
-
-		}//end if
-		
-	}//end while
+			counter = 1;
+			AppendMoves(buffer, path.empty() ? nullptr : &path[0], int(path.size()), counter, names);
+		}
 
-	outdat << END << endl << endl;
+	}//end find a shortest path
 
-}//end WriteSolutionToFile
+	else
+	{
+		GridEnumerator search(grid, entry, exit);
+		SearchStatus status;
+
+		//Pause often enough to look at the clock, or exactly on the node limit
+		if (options.budget.seconds > 0)
+			pauseNodes = CLOCK_CHECK_NODES;
+
+		if (options.budget.nodes > 0 && (pauseNodes == 0 || options.budget.nodes < pauseNodes))
+			pauseNodes = options.budget.nodes;
+
+		//A scheduler stopping the run gets the paths found so far rather than nothing
+		CancelOnSignal(token);
+		search.SetCancelToken(&token);
+		search.SetPauseInterval(pauseNodes);
+
+		while (reason == STOP_NONE && (status = search.Next()) != SEARCH_DONE)
+		{
+			if (status == SEARCH_SOLUTION)
+			{
+				size_t before = buffer.size();
+
+				counter++;
+				AppendMoves(buffer, search.GetMoves(), search.GetNumMoves(), counter, names);
+				bytes += (long long)(buffer.size() - before);
+
+				//The file is written a block at a time rather than a path at a time
+				if (buffer.size() >= GRID_BLOCK_BYTES)
+				{
+					outdat << buffer;
+					buffer.clear();
+				}
+
+				reason = CheckBudget(options.budget, 0, 0, counter, bytes);
+				continue;
+
+			}//end solution
+
+			//Paused, either the token was cancelled or it is time to look at the budget
+			reason = token.GetReason();
+			if (reason == STOP_NONE)
+				reason = CheckBudget(options.budget,
+									 chrono::duration<double>(chrono::steady_clock::now() - startTime).count(),
+									 search.GetNodes(), counter, bytes);
+
+		}//end while
+
+	}//end find every path
+
+	outdat << buffer;
+
+	//The search stopped early, the file ends with why
+	if (reason != STOP_NONE)
+	{
+		outdat << STOPPED_STR << StopReasonName(reason) << WRITTEN_STR << counter << endl;
+		cout << STOPPED_STR << StopReasonName(reason) << WRITTEN_STR << counter << endl;
+		return StopExitStatus(reason);
+
+	}//end stopped search
+
+	//If no paths were found, there are no solutions
+	if (counter == 0)
+		outdat << NO_SOLUTIONS << endl;
+
+	cout << GRID_STR << counter << endl;
+	return EXIT_OK;
+
+}//end SolveGrid
+
+
+/***************************************************************************************************/
+
+
+//pre: options.pathFirst and options.pathLast are the first and last paths to print
+//post: paths pathFirst to pathLast of solutionFile have been written to the console, and true
+//		returned to the caller. If the file has no index, or one that no longer fits it, it has been
+//		indexed first, every options.indexStride paths. If the file does not hold the paths, false
+//		is returned
+/*out*/bool PrintPaths(	/*in*/const string &solutionFile,		//file to print paths from
+						/*in*/const RunOptions &options)		//command line options
+{
+	SolutionIndex index;
+	const char *text;
+	size_t length;
+
+	if (!index.Open(solutionFile))
+	{
+		//The old index is unmapped before it is written over
+		index.Close();
+		if (!BuildSolutionIndex(solutionFile, options.indexStride > 0 ? options.indexStride : DEFAULT_INDEX_STRIDE) ||
+			!index.Open(solutionFile))
+		{
+			cout << INDEX_READ_ERR << endl;
+			return false;
+		}
+
+	}//end index the file
+
+	if (!index.FindPaths(options.pathFirst, options.pathLast, text, length))
+	{
+		cout << PATH_RANGE_ERR << index.GetNumPaths() << endl;
+		return false;
+
+	}//end no such path
+
+	cout.write(text, length);
+	return true;
+
+}//end PrintPaths
+
+
+/***************************************************************************************************/
+
+
+//pre: context is a SolutionFile whose writer has been initialized
+//		moves contains numMoves valid movements, starting from the entry point
+//post: The solution has been handed to the SolutionFile's writer and its solution number incremented
+void WriteSmallMazeSolution(	/*in*/const Direction moves[],	//movements taken from the entry point
+								/*in*/int numMoves,				//number of movements in moves
+								/*inout*/void *context)			//SolutionFile to write to
+{
+	SolutionFile *solutionFile = static_cast<SolutionFile*>(context);
+
+	solutionFile->counter++;
+	solutionFile->writer->Submit(moves, numMoves, solutionFile->counter);
+
+}//end WriteSmallMazeSolution
 
 
 /***************************************************************************************************/
@@ -403,11 +1632,13 @@ void WriteSolutionToFile(	/*inout*/ofstream &outdat, //output file to be written
 
 //pre: fileIn is a properly formatted maze file. The file at minimum contains the dimensions of the board
 //post: a new Board is returned to the caller. The board has been initialized and walls 
-//		have been set appropriately
+//		have been set appropriately. entries and exits hold the doors the file declares, if any
 /*out*/Board CreateBoardFromFile(							//Board to be returned to the caller
 								/*in*/string fileIn,		//file name of the maze file
-								/*inout*/bool &goodFile)	//boolean passed by ref 
+								/*inout*/bool &goodFile,	//boolean passed by ref 
 															//representing a bad file read
+								/*out*/vector<Door> &entries,	//entry doors of the maze
+								/*out*/vector<Door> &exits)		//exit doors of the maze
 {
 	fstream indat;		//In file
 	Location loc;		//Location of walls
@@ -434,17 +1665,68 @@ void WriteSolutionToFile(	/*inout*/ofstream &outdat, //output file to be written
 			indat >> loc.row;
 			indat >> loc.col;
 
+			//Something other than a coordinate, the walls have ended
+			if (indat.fail() && !indat.eof())
+				break;
+
 			board.SetOpen(loc, false);
 		}
 
+		//The walls may be followed by a cost layer, a line reading COST and then row col cost lines, and
+		//by the doors, a line reading ENTRY or EXIT and then row col side lines, in any order
+		while (goodFile && indat.fail() && !indat.eof())
+		{
+			string header;		//Section header
+			int cost;			//Cost of a location
+			Door door;			//Door of the maze
+			string side;		//Side the door opens onto
+
+			indat.clear();
+			indat >> header;
+
+			if (header == COST_HEADER)
+			{
+				while (goodFile && indat >> loc.row >> loc.col >> cost)
+				{
+					if (loc.row < 0 || loc.row >= board.GetHeight() || loc.col < 0 || loc.col >= board.GetLength()
+						|| cost < DEFAULT_COST || cost > MAX_COST)
+						goodFile = false;
+					else
+						board.SetCost(loc, cost);
+				}
+
+			}//end cost layer
+
+			//A door must be on the edge of the maze it opens onto
+			else if (header == ENTRY_HEADER || header == EXIT_HEADER)
+			{
+				while (goodFile && indat >> door.cell.row >> door.cell.col >> side)
+				{
+					if (!ReadSide(side, door.side) || !IsOnEdge(door, board.GetHeight(), board.GetLength()))
+						goodFile = false;
+					else if (header == ENTRY_HEADER)
+						entries.push_back(door);
+					else
+						exits.push_back(door);
+				}
+
+			}//end doors
+
+			else
+				goodFile = false;
+
+		}//end sections
+
+		//Anything left over is not a line of a section
+		if (goodFile && !indat.eof())
+			goodFile = false;
+
 		return board;
 	}
 	
-	//File was not read properly
-	else
-		goodFile = false;
-
-	indat.close();
+	//File was not read properly, the caller only looks at goodFile
+	goodFile = false;
+	return Board();
 
 }//end CreateBoardFromFile
 
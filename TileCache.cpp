@@ -0,0 +1,170 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: TileCache.cpp
+Purpose: Provides the implementation of a tile cache.
+*/
+
+#include "TileCache.h"
+#include <algorithm>			//fill
+
+using namespace std;
+
+
+//pre: fileName names an existing file, tileBytes is greater than zero
+//post: A cache holding up to cacheBytes of tiles, at least one, has been created over the
+//		file. Tile i starts headerBytes + i * tileBytes into the file
+TileCache::TileCache(	/*in*/const string &fileName,	//file of tiles
+						/*in*/long long inHeaderBytes,	//bytes before the first tile
+						/*in*/size_t inTileBytes,		//bytes in a tile
+						/*in*/size_t cacheBytes)		//most bytes of tiles to hold
+{
+	file.open(fileName.c_str(), ios::in | ios::out | ios::binary);
+	headerBytes = inHeaderBytes;
+	tileBytes = inTileBytes;
+	maxSlots = cacheBytes / tileBytes;
+	hits = 0;
+	misses = 0;
+
+	if (maxSlots == 0)
+		maxSlots = 1;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: TileCache has been initialized
+//post: every changed tile has been written back and the file closed
+TileCache::~TileCache()
+{
+	Flush();
+	file.close();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: TileCache has been initialized
+//post: returns true to the caller if the file was opened, false otherwise
+/*out*/bool TileCache::IsGood() const			//boolean value returned to the caller
+{
+	return file.is_open();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: tile is not negative
+//post: the tile is the most recently used and its bytes have been returned to the caller.
+//		If write is true it will be written back before it is put out. The bytes are valid
+//		until the next call to GetTile
+/*out*/unsigned char* TileCache::GetTile(		//bytes of the tile
+					/*in*/long long tile,		//index of the tile
+					/*in*/bool write)			//the caller will change the tile
+{
+	unordered_map<long long, list<Slot>::iterator>::iterator found = held.find(tile);
+
+	//Held already, move it to the front
+	if (found != held.end())
+	{
+		hits++;
+
+		if (found->second != slots.begin())
+			slots.splice(slots.begin(), slots, found->second);
+
+		slots.front().dirty = slots.front().dirty || write;
+		return &slots.front().data[0];
+
+	}//end hit
+
+	misses++;
+
+	//Reuse the least recently used slot once the budget is spent
+	if (slots.size() >= maxSlots)
+	{
+		WriteBack(slots.back());
+		held.erase(slots.back().tile);
+		slots.splice(slots.begin(), slots, --slots.end());
+	}
+	else
+	{
+		slots.push_front(Slot());
+		slots.front().data.resize(tileBytes);
+	}
+
+	Slot &slot = slots.front();
+	slot.tile = tile;
+	slot.dirty = write;
+	held[tile] = slots.begin();
+
+	//Whatever the file does not reach is zeros
+	file.clear();
+	file.seekg(headerBytes + tile * (long long)tileBytes);
+	file.read(reinterpret_cast<char*>(&slot.data[0]), tileBytes);
+
+	size_t count = size_t(file.gcount());
+	fill(slot.data.begin() + count, slot.data.end(), (unsigned char)0);
+	file.clear();
+
+	return &slot.data[0];
+
+}//end GetTile
+
+
+/***************************************************************************************************/
+
+
+//pre: TileCache has been initialized
+//post: every changed tile has been written back to the file
+void TileCache::Flush()
+{
+	for (list<Slot>::iterator it = slots.begin(); it != slots.end(); it++)
+		WriteBack(*it);
+
+	file.flush();
+
+}//end Flush
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of tile requests that found the tile held
+/*out*/long long TileCache::GetHits() const		//number of hits
+{
+	return hits;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of tile requests that had to read the tile in
+/*out*/long long TileCache::GetMisses() const	//number of misses
+{
+	return misses;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: slot holds a tile
+//post: the slot's tile has been written to the file if it was changed
+void TileCache::WriteBack(/*inout*/Slot &slot)	//slot to write back
+{
+	if (!slot.dirty)
+		return;
+
+	file.clear();
+	file.seekp(headerBytes + slot.tile * (long long)tileBytes);
+	file.write(reinterpret_cast<const char*>(&slot.data[0]), tileBytes);
+	slot.dirty = false;
+
+}//end WriteBack
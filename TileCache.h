@@ -0,0 +1,133 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: TileCache.h
+Purpose: Provides the specification for a TileCache. A tile cache keeps a file of fixed-size tiles,
+			found after a header, and holds the most recently used of them in memory up to a budget
+			of bytes. A tile that is needed and not held is read in, putting out the least recently
+			used one, which is written back first if it was changed. A tile the file does not yet
+			reach reads as zeros, so a new file need not be filled in before it is used.
+*/
+
+#ifndef TILECACHE_H
+#define TILECACHE_H
+
+#include <fstream>				//Tile file
+#include <list>					//Recency order
+#include <string>				//File names
+#include <unordered_map>		//Held tiles
+#include <vector>				//Tile data
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+TileCache(const string &fileName, long long headerBytes, size_t tileBytes, size_t cacheBytes);
+	Creates a new TileCache over an existing file
+
+~TileCache();
+	Writes back changed tiles and closes the file
+
+bool IsGood() const;
+	Returns true if the file could be opened
+
+unsigned char* GetTile(long long tile, bool write);
+	Returns the bytes of the given tile, reading it in if it is not held
+
+void Flush();
+	Writes every changed tile back to the file
+
+long long GetHits() const;
+	Returns the number of tile requests that found the tile held
+
+long long GetMisses() const;
+	Returns the number of tile requests that had to read the tile in
+*/
+
+class TileCache
+{
+
+	public:
+
+		//pre: fileName names an existing file, tileBytes is greater than zero
+		//post: A cache holding up to cacheBytes of tiles, at least one, has been created over the
+		//		file. Tile i starts headerBytes + i * tileBytes into the file
+		TileCache(	/*in*/const string &fileName,	//file of tiles
+					/*in*/long long headerBytes,	//bytes before the first tile
+					/*in*/size_t tileBytes,			//bytes in a tile
+					/*in*/size_t cacheBytes);		//most bytes of tiles to hold
+
+		/***************************************************************************************************/
+
+		//pre: TileCache has been initialized
+		//post: every changed tile has been written back and the file closed
+		~TileCache();
+
+		/***************************************************************************************************/
+
+		//pre: TileCache has been initialized
+		//post: returns true to the caller if the file was opened, false otherwise
+		/*out*/bool IsGood() const;					//boolean value returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: tile is not negative
+		//post: the tile is the most recently used and its bytes have been returned to the caller.
+		//		If write is true it will be written back before it is put out. The bytes are valid
+		//		until the next call to GetTile
+		/*out*/unsigned char* GetTile(				//bytes of the tile
+					/*in*/long long tile,			//index of the tile
+					/*in*/bool write);				//the caller will change the tile
+
+		/***************************************************************************************************/
+
+		//pre: TileCache has been initialized
+		//post: every changed tile has been written back to the file
+		void Flush();
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of tile requests that found the tile held
+		/*out*/long long GetHits() const;			//number of hits
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of tile requests that had to read the tile in
+		/*out*/long long GetMisses() const;			//number of misses
+
+		/***************************************************************************************************/
+
+	private:
+
+		//A tile held in memory
+		struct Slot
+		{
+			long long tile;					//index of the tile
+			bool dirty;						//changed since it was read in
+			vector<unsigned char> data;		//bytes of the tile
+		};
+
+		//pre: slot holds a tile
+		//post: the slot's tile has been written to the file if it was changed
+		void WriteBack(/*inout*/Slot &slot);		//slot to write back
+
+		TileCache(const TileCache &orig);			//not copyable
+		void operator=(const TileCache &orig);		//not assignable
+
+		//PDM's
+		fstream file;									//file of tiles
+		long long headerBytes;							//bytes before the first tile
+		size_t tileBytes;								//bytes in a tile
+		size_t maxSlots;								//most tiles held
+		list<Slot> slots;								//held tiles, most recently used first
+		unordered_map<long long, list<Slot>::iterator> held;	//where each held tile is
+		long long hits;									//requests that found the tile held
+		long long misses;								//requests that read the tile in
+};
+
+#endif
@@ -0,0 +1,238 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: TiledBoard.cpp
+Purpose: Provides the implementation of a tiled board.
+*/
+
+#include "TiledBoard.h"
+#include <cstring>				//memcpy
+
+using namespace std;
+
+//Tiled board file identification
+const unsigned int TILED_MAGIC = 0x42545A4D;		//"MZTB"
+const unsigned int TILED_VERSION = 1;
+
+
+//pre: height and length are greater than zero
+//post: fileName holds a tiled board of the given size with every cell open. Returns true to
+//		the caller if it could be written, false otherwise
+/*out*/bool TiledBoard::Create(						//boolean value returned to the caller
+				/*in*/const string &fileName,		//file to write
+				/*in*/long long inHeight,			//height of the board
+				/*in*/long long inLength)			//length of the board
+{
+	ofstream outdat(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+	char header[TILED_HEADER_BYTES] = {0};
+
+	//Tiles are left out, a tile the file does not reach is all open
+	memcpy(header, &TILED_MAGIC, sizeof(TILED_MAGIC));
+	memcpy(header + 4, &TILED_VERSION, sizeof(TILED_VERSION));
+	memcpy(header + 8, &inHeight, sizeof(inHeight));
+	memcpy(header + 16, &inLength, sizeof(inLength));
+	outdat.write(header, TILED_HEADER_BYTES);
+	outdat.close();
+
+	return !outdat.fail();
+
+}//end Create
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: the board in fileName has been opened, holding up to cacheBytes of tiles in memory
+TiledBoard::TiledBoard(	/*in*/const string &fileName,	//tiled board file
+						/*in*/size_t cacheBytes)		//most bytes of tiles to hold
+	: tiles(fileName, TILED_HEADER_BYTES, TILE_WORDS * sizeof(unsigned long long), cacheBytes)
+{
+	ifstream indat(fileName.c_str(), ios::in | ios::binary);
+	unsigned int magic = 0, version = 0;
+
+	height = 0;
+	length = 0;
+
+	indat.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+	indat.read(reinterpret_cast<char*>(&version), sizeof(version));
+	indat.read(reinterpret_cast<char*>(&height), sizeof(height));
+	indat.read(reinterpret_cast<char*>(&length), sizeof(length));
+
+	good = indat.good() && tiles.IsGood() && magic == TILED_MAGIC && version == TILED_VERSION &&
+			height > 0 && length > 0;
+	tileCols = (length + TILE_SIDE - 1) / TILE_SIDE;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns true to the caller if the file held a tiled board, false otherwise
+/*out*/bool TiledBoard::IsGood() const			//boolean value returned to the caller
+{
+	return good;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: TiledBoard is good
+//post: returns true to the caller if the cell is within the board and open, false otherwise
+/*out*/bool TiledBoard::IsOpen(					//boolean value returned to the caller
+					/*in*/long long row,		//row of the cell
+					/*in*/long long col)		//col of the cell
+{
+	if (row < 0 || row >= height || col < 0 || col >= length)
+		return false;
+
+	const unsigned long long *walls = ReadTile((row / TILE_SIDE) * tileCols + col / TILE_SIDE);
+	int bit = int(row % TILE_SIDE) * TILE_SIDE + int(col % TILE_SIDE);
+
+	return ((walls[bit / 64] >> (bit % 64)) & 1) == 0;
+
+}//end IsOpen
+
+
+/***************************************************************************************************/
+
+
+//pre: TiledBoard is good, the cell is within the board
+//post: the cell's open value has been set
+void TiledBoard::SetOpen(	/*in*/long long row,		//row of the cell
+							/*in*/long long col,		//col of the cell
+							/*in*/bool open)			//desired open value
+{
+	unsigned long long *walls = reinterpret_cast<unsigned long long*>(
+								tiles.GetTile((row / TILE_SIDE) * tileCols + col / TILE_SIDE, true));
+	int bit = int(row % TILE_SIDE) * TILE_SIDE + int(col % TILE_SIDE);
+
+	if (open)
+		walls[bit / 64] &= ~(1ULL << (bit % 64));
+	else
+		walls[bit / 64] |= 1ULL << (bit % 64);
+
+}//end SetOpen
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the height of the board
+/*out*/long long TiledBoard::GetHeight() const	//height is returned to the caller
+{
+	return height;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the length of the board
+/*out*/long long TiledBoard::GetLength() const	//length is returned to the caller
+{
+	return length;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of tiles across the board. The cell (row, col) is in tile
+//		(row / TILE_SIDE) * GetTileCols() + col / TILE_SIDE
+/*out*/long long TiledBoard::GetTileCols() const	//tiles across the board
+{
+	return tileCols;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: TiledBoard is good, tile is a tile of the board
+//post: the wall bits of the tile have been returned to the caller, cell (r, c) of the tile
+//		in bit r * TILE_SIDE + c. They are valid until the next use of the board
+/*out*/const unsigned long long* TiledBoard::ReadTile(	//wall bits of the tile
+					/*in*/long long tile)				//index of the tile
+{
+	return reinterpret_cast<const unsigned long long*>(tiles.GetTile(tile, false));
+
+}//end ReadTile
+
+
+/***************************************************************************************************/
+
+
+//pre: TiledBoard is good
+//post: every changed tile has been written back to the file
+void TiledBoard::Flush()
+{
+	tiles.Flush();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of tile requests that found the tile in memory
+/*out*/long long TiledBoard::GetHits() const		//number of hits
+{
+	return tiles.GetHits();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: none
+//post: returns the number of tile requests that read the tile from the file
+/*out*/long long TiledBoard::GetMisses() const		//number of misses
+{
+	return tiles.GetMisses();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: mazeFile is a properly formatted maze file
+//post: fileName holds a tiled board with the size and walls of the maze, read the same way
+//		CreateBoardFromFile reads them. Returns true to the caller if both files could be
+//		used, false otherwise
+/*out*/bool ImportMazeFile(						//boolean value returned to the caller
+				/*in*/const string &mazeFile,	//maze file to read
+				/*in*/const string &fileName)	//tiled board file to write
+{
+	ifstream indat(mazeFile.c_str());
+	long long row, col;
+
+	//The first number is the length of a Board and the second its height
+	if (!(indat >> row >> col) || row <= 0 || col <= 0)
+		return false;
+
+	if (!TiledBoard::Create(fileName, col, row))
+		return false;
+
+	TiledBoard board(fileName, DEFAULT_TILE_CACHE_MB << 20);
+
+	if (!board.IsGood())
+		return false;
+
+	//Walls are read a pair at a time, without holding the maze
+	while (indat >> row >> col)
+	{
+		if (row >= 0 && row < board.GetHeight() && col >= 0 && col < board.GetLength())
+			board.SetOpen(row, col, false);
+	}
+
+	board.Flush();
+	return true;
+
+}//end ImportMazeFile
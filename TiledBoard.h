@@ -0,0 +1,184 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: TiledBoard.h
+Purpose: Provides the specification for a TiledBoard. A tiled board is a board kept in a file rather than
+			in memory, for mazes too large to hold. The board is cut into square tiles of TILE_SIDE x
+			TILE_SIDE cells, each bit-packed with a set bit for a wall, and only the tiles in a
+			TileCache are in memory. A tile that has never been written is all open. Cells are
+			addressed by row and col as on a Board, without the border.
+*/
+
+#ifndef TILEDBOARD_H
+#define TILEDBOARD_H
+
+#include "TileCache.h"			//Tiles in memory
+#include <string>				//File names
+
+using namespace std;
+
+//int constants
+const int TILE_SIDE = 256;										//Rows and cols of cells in a tile
+const int TILE_CELLS = TILE_SIDE * TILE_SIDE;					//Cells in a tile
+const int TILE_WORDS = TILE_CELLS / 64;							//Words of wall bits in a tile
+const long long TILED_HEADER_BYTES = 4096;						//Bytes before the first tile
+const size_t DEFAULT_TILE_CACHE_MB = 256;						//Default memory budget for tiles
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+static bool Create(const string &fileName, long long height, long long length);
+	Writes a new all open tiled board file
+
+TiledBoard(const string &fileName, size_t cacheBytes);
+	Opens a tiled board file, holding up to cacheBytes of tiles in memory
+
+bool IsGood() const;
+	Returns true if the file was a tiled board
+
+bool IsOpen(long long row, long long col);
+	Returns true if the given cell is within the board and open
+
+void SetOpen(long long row, long long col, bool open);
+	Sets the given cell's open value
+
+long long GetHeight() const;
+	Returns the height of the board
+
+long long GetLength() const;
+	Returns the length of the board
+
+long long GetTileCols() const;
+	Returns the number of tiles across the board
+
+const unsigned long long* ReadTile(long long tile);
+	Returns the wall bits of a tile
+
+void Flush();
+	Writes every changed tile back to the file
+
+long long GetHits() const;
+	Returns the number of tile requests that found the tile in memory
+
+long long GetMisses() const;
+	Returns the number of tile requests that read the tile from the file
+
+bool ImportMazeFile(const string &mazeFile, const string &fileName);
+	Given: a maze file and a tiled board file name
+		-> writes the maze to a new tiled board file, returns false if either file could not be used
+*/
+
+class TiledBoard
+{
+
+	public:
+
+		//pre: height and length are greater than zero
+		//post: fileName holds a tiled board of the given size with every cell open. Returns true to
+		//		the caller if it could be written, false otherwise
+		static /*out*/bool Create(					//boolean value returned to the caller
+					/*in*/const string &fileName,	//file to write
+					/*in*/long long height,			//height of the board
+					/*in*/long long length);		//length of the board
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: the board in fileName has been opened, holding up to cacheBytes of tiles in memory
+		TiledBoard(	/*in*/const string &fileName,	//tiled board file
+					/*in*/size_t cacheBytes);		//most bytes of tiles to hold
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns true to the caller if the file held a tiled board, false otherwise
+		/*out*/bool IsGood() const;					//boolean value returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: TiledBoard is good
+		//post: returns true to the caller if the cell is within the board and open, false otherwise
+		/*out*/bool IsOpen(							//boolean value returned to the caller
+					/*in*/long long row,			//row of the cell
+					/*in*/long long col);			//col of the cell
+
+		/***************************************************************************************************/
+
+		//pre: TiledBoard is good, the cell is within the board
+		//post: the cell's open value has been set
+		void SetOpen(	/*in*/long long row,		//row of the cell
+						/*in*/long long col,		//col of the cell
+						/*in*/bool open);			//desired open value
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the height of the board
+		/*out*/long long GetHeight() const;		//height is returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the length of the board
+		/*out*/long long GetLength() const;		//length is returned to the caller
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of tiles across the board. The cell (row, col) is in tile
+		//		(row / TILE_SIDE) * GetTileCols() + col / TILE_SIDE
+		/*out*/long long GetTileCols() const;		//tiles across the board
+
+		/***************************************************************************************************/
+
+		//pre: TiledBoard is good, tile is a tile of the board
+		//post: the wall bits of the tile have been returned to the caller, cell (r, c) of the tile
+		//		in bit r * TILE_SIDE + c. They are valid until the next use of the board
+		/*out*/const unsigned long long* ReadTile(	//wall bits of the tile
+					/*in*/long long tile);			//index of the tile
+
+		/***************************************************************************************************/
+
+		//pre: TiledBoard is good
+		//post: every changed tile has been written back to the file
+		void Flush();
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of tile requests that found the tile in memory
+		/*out*/long long GetHits() const;			//number of hits
+
+		/***************************************************************************************************/
+
+		//pre: none
+		//post: returns the number of tile requests that read the tile from the file
+		/*out*/long long GetMisses() const;			//number of misses
+
+		/***************************************************************************************************/
+
+	private:
+
+		TiledBoard(const TiledBoard &orig);			//not copyable
+		void operator=(const TiledBoard &orig);		//not assignable
+
+		//PDM's
+		TileCache tiles;		//tiles in memory
+		long long height;		//height of the board
+		long long length;		//length of the board
+		long long tileCols;		//tiles across the board
+		bool good;				//the file held a tiled board
+};
+
+
+//pre: mazeFile is a properly formatted maze file
+//post: fileName holds a tiled board with the size and walls of the maze, read the same way
+//		CreateBoardFromFile reads them. Returns true to the caller if both files could be
+//		used, false otherwise
+/*out*/bool ImportMazeFile(						//boolean value returned to the caller
+				/*in*/const string &mazeFile,	//maze file to read
+				/*in*/const string &fileName);	//tiled board file to write
+
+#endif
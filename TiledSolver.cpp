@@ -0,0 +1,323 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: TiledSolver.cpp
+Purpose: Provides the implementation of the solvers of a tiled board.
+*/
+
+#include "TiledSolver.h"
+#include "TileCache.h"			//Solver state
+#include <algorithm>			//reverse
+#include <cstdio>				//remove
+#include <deque>				//Tiles waiting to be worked
+#include <fstream>				//State files
+#include <map>					//Frontier by tile
+#include <unordered_map>		//Cells waiting by tile
+
+using namespace std;
+
+//Movements are attempted south, east, north, west, respectively
+const Direction ORDER[NUM_DIRECTIONS] = {SOUTH, EAST, NORTH, WEST};
+const int ROW_STEP[NUM_DIRECTIONS] = {1, 0, -1, 0};			//row change of each movement
+const int COL_STEP[NUM_DIRECTIONS] = {0, 1, 0, -1};			//col change of each movement
+
+//Frontier entries carry the movement into the cell, or START for the entry point
+const int START = NUM_DIRECTIONS;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool CreateStateFile(const string &stateFile);
+	Writes a new empty state file, returns false if it could not be written
+
+long long TileOf(TiledBoard &board, long long row, long long col);
+	Returns the tile the cell is in
+
+int LocalOf(long long row, long long col);
+	Returns the cell's index within its tile
+*/
+
+
+//pre: none
+//post: stateFile is an empty file. Returns true to the caller if it could be written
+static /*out*/bool CreateStateFile(				//boolean value returned to the caller
+				/*in*/const string &stateFile)	//file to write
+{
+	ofstream outdat(stateFile.c_str(), ios::out | ios::binary | ios::trunc);
+
+	return outdat.good();
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: the cell is within the board
+//post: the index of the tile the cell is in has been returned to the caller
+static inline /*out*/long long TileOf(			//index of the tile
+				/*in*/TiledBoard &board,		//board of the cell
+				/*in*/long long row,			//row of the cell
+				/*in*/long long col)			//col of the cell
+{
+	return (row / TILE_SIDE) * board.GetTileCols() + col / TILE_SIDE;
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: row and col are not negative
+//post: the index of the cell within its tile has been returned to the caller
+static inline /*out*/int LocalOf(				//index within the tile
+				/*in*/long long row,			//row of the cell
+				/*in*/long long col)			//col of the cell
+{
+	return int(row % TILE_SIDE) * TILE_SIDE + int(col % TILE_SIDE);
+}
+
+
+/***************************************************************************************************/
+
+
+//pre: board is good, entry and exit are within it
+//post: returns true to the caller if the exit can be reached from the entry. The solver's state
+//		was kept in stateFile, holding up to cacheBytes of it in memory, and stateFile removed.
+//		stats holds the tile traffic of the search
+/*out*/bool TiledExitReachable(						//boolean value returned to the caller
+				/*inout*/TiledBoard &board,			//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*in*/const string &stateFile,		//file for the solver's state
+				/*in*/size_t cacheBytes,			//most bytes of state to hold
+				/*out*/TileStats &stats)			//tile traffic
+{
+	long long boardHits = board.GetHits();
+	long long boardMisses = board.GetMisses();
+	unordered_map<long long, vector<int> > pending;		//cells waiting, by tile
+	deque<long long> waiting;							//tiles with cells waiting
+	vector<int> work;									//cells waiting in the current tile
+	bool found = false;
+
+	stats.cellsVisited = 0;
+	CreateStateFile(stateFile);
+
+	{
+		//A set bit for each visited cell
+		TileCache visited(stateFile, 0, TILE_WORDS * sizeof(unsigned long long), cacheBytes);
+
+		pending[TileOf(board, entry.row, entry.col)].push_back(LocalOf(entry.row, entry.col));
+		waiting.push_back(TileOf(board, entry.row, entry.col));
+
+		while (!waiting.empty() && !found)
+		{
+			long long tile = waiting.front();
+			long long baseRow = (tile / board.GetTileCols()) * TILE_SIDE;
+			long long baseCol = (tile % board.GetTileCols()) * TILE_SIDE;
+
+			waiting.pop_front();
+			work.swap(pending[tile]);
+			pending.erase(tile);
+
+			const unsigned long long *walls = board.ReadTile(tile);
+			unsigned long long *seen = reinterpret_cast<unsigned long long*>(visited.GetTile(tile, true));
+
+			//Flood the tile, leaving steps out of it for their own tile
+			while (!work.empty() && !found)
+			{
+				int local = work.back();
+				work.pop_back();
+
+				if (((seen[local / 64] | walls[local / 64]) >> (local % 64)) & 1)
+					continue;
+
+				seen[local / 64] |= 1ULL << (local % 64);
+				stats.cellsVisited++;
+
+				long long row = baseRow + local / TILE_SIDE;
+				long long col = baseCol + local % TILE_SIDE;
+
+				if (row == exit.row && col == exit.col)
+				{
+					found = true;
+					continue;
+
+				}//end exit reached
+
+				for (int d = 0; d < NUM_DIRECTIONS; d++)
+				{
+					long long nextRow = row + ROW_STEP[d];
+					long long nextCol = col + COL_STEP[d];
+
+					if (nextRow < 0 || nextRow >= board.GetHeight() || nextCol < 0 || nextCol >= board.GetLength())
+						continue;
+
+					long long nextTile = TileOf(board, nextRow, nextCol);
+
+					if (nextTile == tile)
+						work.push_back(LocalOf(nextRow, nextCol));
+					else
+					{
+						vector<int> &cells = pending[nextTile];
+
+						if (cells.empty())
+							waiting.push_back(nextTile);
+						cells.push_back(LocalOf(nextRow, nextCol));
+					}
+
+				}//end for
+
+			}//end while
+
+			work.clear();
+
+		}//end while
+
+		stats.stateHits = visited.GetHits();
+		stats.stateMisses = visited.GetMisses();
+
+	}//end state
+
+	remove(stateFile.c_str());
+	stats.boardHits = board.GetHits() - boardHits;
+	stats.boardMisses = board.GetMisses() - boardMisses;
+	return found;
+
+}//end TiledExitReachable
+
+
+/***************************************************************************************************/
+
+
+//pre: board is good, entry and exit are within it
+//post: if the exit can be reached from the entry, moves holds the movements of a shortest path
+//		from the entry to the exit and true is returned to the caller, otherwise false is
+//		returned. The solver's state was kept in stateFile, holding up to cacheBytes of it in
+//		memory, and stateFile removed. stats holds the tile traffic of the search
+/*out*/bool TiledShortestPath(						//boolean value returned to the caller
+				/*inout*/TiledBoard &board,			//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*in*/const string &stateFile,		//file for the solver's state
+				/*in*/size_t cacheBytes,			//most bytes of state to hold
+				/*out*/vector<Direction> &moves,	//movements of the path
+				/*out*/TileStats &stats)			//tile traffic
+{
+	long long boardHits = board.GetHits();
+	long long boardMisses = board.GetMisses();
+	map<long long, vector<int> > current, next;		//frontier by tile, in tile order
+	bool found = false;
+
+	moves.clear();
+	stats.cellsVisited = 0;
+	CreateStateFile(stateFile);
+
+	{
+		//A byte for each cell, zero until reached, then one more than the movement into it
+		TileCache parents(stateFile, 0, TILE_CELLS, cacheBytes);
+
+		current[TileOf(board, entry.row, entry.col)].push_back(LocalOf(entry.row, entry.col) * 8 + START);
+
+		//Each layer is one movement further from the entry, worked a tile at a time
+		while (!current.empty() && !found)
+		{
+			for (map<long long, vector<int> >::iterator it = current.begin(); it != current.end() && !found; it++)
+			{
+				long long tile = it->first;
+				long long baseRow = (tile / board.GetTileCols()) * TILE_SIDE;
+				long long baseCol = (tile % board.GetTileCols()) * TILE_SIDE;
+				const unsigned long long *walls = board.ReadTile(tile);
+				unsigned char *parent = parents.GetTile(tile, true);
+
+				for (size_t i = 0; i < it->second.size() && !found; i++)
+				{
+					int local = it->second[i] / 8;
+					int into = it->second[i] % 8;
+
+					if (parent[local] != 0 || ((walls[local / 64] >> (local % 64)) & 1))
+						continue;
+
+					parent[local] = (unsigned char)(into + 1);
+					stats.cellsVisited++;
+
+					long long row = baseRow + local / TILE_SIDE;
+					long long col = baseCol + local % TILE_SIDE;
+
+					if (row == exit.row && col == exit.col)
+					{
+						found = true;
+						continue;
+
+					}//end exit reached
+
+					for (int d = 0; d < NUM_DIRECTIONS; d++)
+					{
+						long long nextRow = row + ROW_STEP[d];
+						long long nextCol = col + COL_STEP[d];
+
+						if (nextRow >= 0 && nextRow < board.GetHeight() && nextCol >= 0 && nextCol < board.GetLength())
+							next[TileOf(board, nextRow, nextCol)].push_back(LocalOf(nextRow, nextCol) * 8 + d);
+
+					}//end for
+
+				}//end for
+
+			}//end for
+
+			current.swap(next);
+			next.clear();
+
+		}//end while
+
+		//Walk back from the exit to the entry, one movement at a time
+		if (found)
+		{
+			long long row = exit.row;
+			long long col = exit.col;
+			int into = parents.GetTile(TileOf(board, row, col), false)[LocalOf(row, col)] - 1;
+
+			while (into != START)
+			{
+				moves.push_back(ORDER[into]);
+				row -= ROW_STEP[into];
+				col -= COL_STEP[into];
+				into = parents.GetTile(TileOf(board, row, col), false)[LocalOf(row, col)] - 1;
+
+			}//end while
+
+			reverse(moves.begin(), moves.end());
+
+		}//end path
+
+		stats.stateHits = parents.GetHits();
+		stats.stateMisses = parents.GetMisses();
+
+	}//end state
+
+	remove(stateFile.c_str());
+	stats.boardHits = board.GetHits() - boardHits;
+	stats.boardMisses = board.GetMisses() - boardMisses;
+	return found;
+
+}//end TiledShortestPath
+
+
+/***************************************************************************************************/
+
+
+//pre: out is a valid output stream
+//post: the tile hits, misses and hit rates of stats have been written to out
+void WriteTileStats(	/*in*/const TileStats &stats,	//tile traffic
+						/*inout*/ostream &out)			//stream to write to
+{
+	long long board = stats.boardHits + stats.boardMisses;
+	long long state = stats.stateHits + stats.stateMisses;
+
+	out << "Cells visited: " << stats.cellsVisited << endl;
+	out << "Board tiles: " << stats.boardHits << " hits, " << stats.boardMisses << " misses, "
+		<< (board > 0 ? 100.0 * stats.boardHits / board : 0.0) << "% hit rate" << endl;
+	out << "State tiles: " << stats.stateHits << " hits, " << stats.stateMisses << " misses, "
+		<< (state > 0 ? 100.0 * stats.stateHits / state : 0.0) << "% hit rate" << endl;
+
+}//end WriteTileStats
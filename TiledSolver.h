@@ -0,0 +1,88 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: TiledSolver.h
+Purpose: Provides the specification for the solvers of a TiledBoard. Their state is as large as the board,
+			so it is kept in a tiled file of its own beside it. Both solvers work a tile at a time:
+			cells waiting to be searched are kept in a list for the tile they are in, and a tile's
+			list is worked through in one go while the tile is in memory. A step into another tile
+			only adds the cell to that tile's list, so tiles are read in far less often than cells
+			are visited.
+*/
+
+#ifndef TILEDSOLVER_H
+#define TILEDSOLVER_H
+
+#include "TiledBoard.h"			//Board in a file
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include <ostream>				//Reporting
+#include <string>				//File names
+#include <vector>				//Path movements
+
+using namespace std;
+
+
+//Tile traffic of a solver
+struct TileStats
+{
+	long long boardHits;		//board tile requests that found the tile in memory
+	long long boardMisses;		//board tile requests that read the tile in
+	long long stateHits;		//state tile requests that found the tile in memory
+	long long stateMisses;		//state tile requests that read the tile in
+	long long cellsVisited;		//cells the solver reached
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool TiledExitReachable(TiledBoard &board, Location entry, Location exit, const string &stateFile,
+						size_t cacheBytes, TileStats &stats);
+	Given: a tiled board, an entry and exit point and a file for the solver's state
+		-> returns true if the exit can be reached from the entry
+
+bool TiledShortestPath(TiledBoard &board, Location entry, Location exit, const string &stateFile,
+						size_t cacheBytes, vector<Direction> &moves, TileStats &stats);
+	Given: a tiled board, an entry and exit point and a file for the solver's state
+		-> finds the movements of a shortest path from the entry to the exit, returns false if there is none
+
+void WriteTileStats(const TileStats &stats, ostream &out);
+	Given: a solver's tile traffic and an output stream
+		-> writes the hits, misses and hit rates to out
+*/
+
+
+//pre: board is good, entry and exit are within it
+//post: returns true to the caller if the exit can be reached from the entry. The solver's state
+//		was kept in stateFile, holding up to cacheBytes of it in memory, and stateFile removed.
+//		stats holds the tile traffic of the search
+/*out*/bool TiledExitReachable(						//boolean value returned to the caller
+				/*inout*/TiledBoard &board,			//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*in*/const string &stateFile,		//file for the solver's state
+				/*in*/size_t cacheBytes,			//most bytes of state to hold
+				/*out*/TileStats &stats);			//tile traffic
+
+//pre: board is good, entry and exit are within it
+//post: if the exit can be reached from the entry, moves holds the movements of a shortest path
+//		from the entry to the exit and true is returned to the caller, otherwise false is
+//		returned. The solver's state was kept in stateFile, holding up to cacheBytes of it in
+//		memory, and stateFile removed. stats holds the tile traffic of the search
+/*out*/bool TiledShortestPath(						//boolean value returned to the caller
+				/*inout*/TiledBoard &board,			//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*in*/const string &stateFile,		//file for the solver's state
+				/*in*/size_t cacheBytes,			//most bytes of state to hold
+				/*out*/vector<Direction> &moves,	//movements of the path
+				/*out*/TileStats &stats);			//tile traffic
+
+//pre: out is a valid output stream
+//post: the tile hits, misses and hit rates of stats have been written to out
+void WriteTileStats(	/*in*/const TileStats &stats,	//tile traffic
+						/*inout*/ostream &out);			//stream to write to
+
+#endif
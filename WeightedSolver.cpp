@@ -0,0 +1,281 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: WeightedSolver.cpp
+Purpose: Provides the implementation of the cheapest path solver.
+*/
+
+#include "WeightedSolver.h"
+#include "RadixHeap.h"			//Monotone open list
+#include <algorithm>			//reverse
+#include <functional>			//greater
+#include <queue>				//Binary heap open list
+
+using namespace std;
+
+//Movements are attempted south, east, north, west, respectively
+const Direction WEIGHTED_ORDER[NUM_DIRECTIONS] = {SOUTH, EAST, NORTH, WEST};
+
+//Total cost a search may use 32 bit keys up to
+const unsigned long long NARROW_KEY_LIMIT = 0xFFFFFFFFULL;
+
+
+//The board laid out for the search. Cells are numbered over the board with a border of closed
+//cells, (row+1)*width+(col+1), so a neighbor is always a fixed offset away
+struct WeightedGrid
+{
+	vector<unsigned short> costs;				//cost of moving into each cell, zero for closed cells
+	vector<unsigned char> via;					//movement into each cell on its cheapest path, index into WEIGHTED_ORDER
+	long long offset[NUM_DIRECTIONS];			//index change moving in each direction of WEIGHTED_ORDER
+	size_t entryCell;							//cell of the entry point
+	size_t exitCell;							//cell of the exit point
+	unsigned long long costLimit;				//most any path can cost, the total over every open cell
+};
+
+
+//Binary heap open list with the interface of RadixHeap
+template <class Key>
+class BinaryHeapList
+{
+	public:
+
+		void Push(Key key, unsigned int value)	{ heap.push(Entry(key, value)); }
+
+		bool Pop(Key &key, unsigned int &value)
+		{
+			if (heap.empty())
+				return false;
+			key = heap.top().first;
+			value = heap.top().second;
+			heap.pop();
+			return true;
+		}
+
+	private:
+
+		typedef pair<Key, unsigned int> Entry;
+		priority_queue<Entry, vector<Entry>, greater<Entry> > heap;		//entries, smallest key on top
+};
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Private Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+void BuildGrid(Board &gb, Location entry, Location exit, WeightedGrid &grid);
+	Lays the board and its costs out for the search
+
+bool RunDijkstra(WeightedGrid &grid, vector<Key> &best, OpenList &openList);
+	Finds the cheapest cost to each cell until the exit is taken off the open list
+
+bool SolveGrid(Board &gb, Location entry, Location exit, vector<Direction> &moves, long long &cost);
+	Lays out the board, searches it with the narrowest keys its costs fit in, and traces the path
+
+void TracePath(const WeightedGrid &grid, vector<Direction> &moves);
+	Follows the movements into each cell back from the exit
+*/
+
+
+//pre: gb is a valid gameboard, entry and exit are within its bounds
+//post: grid holds the open cells and costs of gb with a closed border, and no cell reached
+static void BuildGrid(	/*in*/Board &gb,				//board to search
+						/*in*/Location entry,			//starting location
+						/*in*/Location exit,			//location to reach
+						/*out*/WeightedGrid &grid)		//board laid out for the search
+{
+	int height = gb.GetHeight();
+	int length = gb.GetLength();
+	size_t width = size_t(length) + 2;
+	size_t cells = (size_t(height) + 2) * width;
+	bool weighted = gb.HasCosts();
+	Location loc;
+
+	grid.costs.assign(cells, 0);
+	grid.via.assign(cells, 0);
+	grid.costLimit = 0;
+
+	for (loc.row = 0; loc.row < height; loc.row++)
+	{
+		size_t rowStart = (size_t(loc.row) + 1) * width + 1;
+
+		for (loc.col = 0; loc.col < length; loc.col++)
+		{
+			if (gb.IsOpen(loc))
+			{
+				grid.costs[rowStart + loc.col] = (unsigned short)(weighted ? gb.GetCost(loc) : DEFAULT_COST);
+				grid.costLimit += grid.costs[rowStart + loc.col];
+			}
+		}
+
+	}//end for
+
+	grid.offset[0] = (long long)width;		//South
+	grid.offset[1] = 1;						//East
+	grid.offset[2] = -(long long)width;		//North
+	grid.offset[3] = -1;					//West
+
+	grid.entryCell = (size_t(entry.row) + 1) * width + entry.col + 1;
+	grid.exitCell = (size_t(exit.row) + 1) * width + exit.col + 1;
+
+}//end BuildGrid
+
+
+/***************************************************************************************************/
+
+
+//pre: grid has been built, best holds the largest key for every cell, openList is empty
+//post: best holds the cheapest cost to every cell settled before the exit, and via the movement
+//		into each of them. Returns true to the caller if the exit was reached
+template <class Key, class OpenList>
+static /*out*/bool RunDijkstra(					//boolean value returned to the caller
+				/*inout*/WeightedGrid &grid,		//board laid out for the search
+				/*inout*/vector<Key> &best,			//cheapest cost found to each cell
+				/*inout*/OpenList &openList)		//cells waiting to be settled
+{
+	Key key;
+	unsigned int cell;
+
+	if (grid.costs[grid.entryCell] == 0 || grid.costs[grid.exitCell] == 0)
+		return false;
+
+	best[grid.entryCell] = 0;
+	openList.Push(0, (unsigned int)grid.entryCell);
+
+	while (openList.Pop(key, cell))
+	{
+		//A cheaper way to the cell was already settled, this entry is out of date
+		if (key != best[cell])
+			continue;
+
+		if (cell == grid.exitCell)
+			return true;
+
+		for (int dir = 0; dir < NUM_DIRECTIONS; dir++)
+		{
+			size_t next = size_t(cell + grid.offset[dir]);
+			unsigned int step = grid.costs[next];
+			Key through = Key(key + step);
+
+			if (step != 0 && through < best[next])
+			{
+				best[next] = through;
+				grid.via[next] = (unsigned char)dir;
+				openList.Push(through, (unsigned int)next);
+			}
+
+		}//end for
+
+	}//end while
+
+	return false;
+
+}//end RunDijkstra
+
+
+/***************************************************************************************************/
+
+
+//pre: RunDijkstra reached the exit
+//post: moves holds the movements of the cheapest path from the entry to the exit
+static void TracePath(	/*in*/const WeightedGrid &grid,		//board laid out for the search
+						/*out*/vector<Direction> &moves)	//movements of the path
+{
+	size_t cell = grid.exitCell;
+
+	moves.clear();
+	while (cell != grid.entryCell)
+	{
+		int dir = grid.via[cell];
+
+		moves.push_back(WEIGHTED_ORDER[dir]);
+		cell = size_t(cell - grid.offset[dir]);
+	}
+
+	reverse(moves.begin(), moves.end());
+
+}//end TracePath
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, entry and exit are within its bounds
+//post: the same as CheapestPath, searched with open lists of the given kind. The costs are 32 bit
+//		if every path is sure to fit in them, halving the memory the search walks through
+template <template <class> class OpenList>
+static /*out*/bool SolveGrid(						//boolean value returned to the caller
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*out*/vector<Direction> &moves,	//movements of the path
+				/*out*/long long &cost)				//total cost of the path
+{
+	WeightedGrid grid;
+	bool found;
+
+	BuildGrid(gb, entry, exit, grid);
+	moves.clear();
+	cost = 0;
+
+	if (grid.costLimit < NARROW_KEY_LIMIT)
+	{
+		vector<unsigned int> best(grid.costs.size(), ~0U);
+		OpenList<unsigned int> openList;
+
+		found = RunDijkstra(grid, best, openList);
+		if (found)
+			cost = (long long)best[grid.exitCell];
+	}
+	else
+	{
+		vector<unsigned long long> best(grid.costs.size(), ~0ULL);
+		OpenList<unsigned long long> openList;
+
+		found = RunDijkstra(grid, best, openList);
+		if (found)
+			cost = (long long)best[grid.exitCell];
+
+	}//end wide costs
+
+	if (found)
+		TracePath(grid, moves);
+
+	return found;
+
+}//end SolveGrid
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, entry and exit are within its bounds
+//post: if the exit can be reached from the entry, moves holds the movements of a path whose cells,
+//		not counting the entry, cost the least in total, cost holds that total, and true is returned
+//		to the caller. Otherwise moves is empty and false is returned
+/*out*/bool CheapestPath(							//boolean value returned to the caller
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*out*/vector<Direction> &moves,	//movements of the path
+				/*out*/long long &cost)				//total cost of the path
+{
+	return SolveGrid<RadixHeap>(gb, entry, exit, moves, cost);
+
+}//end CheapestPath
+
+
+/***************************************************************************************************/
+
+
+//pre: gb is a valid gameboard, entry and exit are within its bounds
+//post: the same as CheapestPath, found with a binary heap for the open list instead of a radix heap
+/*out*/bool CheapestPathBinaryHeap(					//boolean value returned to the caller
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*out*/vector<Direction> &moves,	//movements of the path
+				/*out*/long long &cost)				//total cost of the path
+{
+	return SolveGrid<BinaryHeapList>(gb, entry, exit, moves, cost);
+
+}//end CheapestPathBinaryHeap
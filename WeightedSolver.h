@@ -0,0 +1,56 @@
+/*
+Author: John Lahut
+Date: 10.19.2026
+Project: TheMaze
+Filename: WeightedSolver.h
+Purpose: Provides the specification for the cheapest path solver of boards with a cost layer. Moving into
+			a cell costs that cell's cost, and the cheapest path is found with Dijkstra's algorithm. Its
+			costs are whole numbers and never go down as the search goes on, so the open list is a radix
+			heap rather than a binary heap. The binary heap version is kept to check and time it against.
+*/
+
+#ifndef WEIGHTEDSOLVER_H
+#define WEIGHTEDSOLVER_H
+
+#include "Board.h"				//For use of a board
+#include "Direction.h"			//Direction enum
+#include "Location.h"			//Location struct
+#include <vector>				//Path movements
+
+using namespace std;
+
+
+/*
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ Public Methods ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bool CheapestPath(Board &gb, Location entry, Location exit, vector<Direction> &moves, long long &cost);
+	Given: a board, an entry and exit point
+		-> finds the movements of a cheapest path from the entry to the exit and its cost, returns false if there is none
+
+bool CheapestPathBinaryHeap(Board &gb, Location entry, Location exit, vector<Direction> &moves, long long &cost);
+	Given: a board, an entry and exit point
+		-> the same as CheapestPath, with a binary heap for the open list
+*/
+
+
+//pre: gb is a valid gameboard, entry and exit are within its bounds
+//post: if the exit can be reached from the entry, moves holds the movements of a path whose cells,
+//		not counting the entry, cost the least in total, cost holds that total, and true is returned
+//		to the caller. Otherwise moves is empty and false is returned
+/*out*/bool CheapestPath(							//boolean value returned to the caller
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*out*/vector<Direction> &moves,	//movements of the path
+				/*out*/long long &cost);			//total cost of the path
+
+//pre: gb is a valid gameboard, entry and exit are within its bounds
+//post: the same as CheapestPath, found with a binary heap for the open list instead of a radix heap
+/*out*/bool CheapestPathBinaryHeap(					//boolean value returned to the caller
+				/*in*/Board &gb,					//board to search
+				/*in*/Location entry,				//starting location
+				/*in*/Location exit,				//location to reach
+				/*out*/vector<Direction> &moves,	//movements of the path
+				/*out*/long long &cost);			//total cost of the path
+
+#endif